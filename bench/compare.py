@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+Compares the JSON output of eerosBench against a stored baseline.
+
+Create the results with
+  eerosBench --benchmark_out=results.json --benchmark_out_format=json
+and store them as baseline with --update. Later results are compared benchmark by
+benchmark, a benchmark is a regression if its time grew by more than the threshold
+relative to the baseline. The script exits with 1 if there is any regression, so it
+can be used as a gate in a build.
+
+If the results contain aggregates (--benchmark_repetitions), the median is compared.
+Benchmarks missing in either file are reported but are no regressions.
+
+Examples:
+  compare.py baseline.json results.json
+  compare.py baseline.json results.json --threshold 0.05 --threshold-for 'coreExecutor.*=1.0'
+  compare.py baseline.json results.json --update
+"""
+
+import argparse
+import json
+import re
+import shutil
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        return json.load(f)
+
+
+def times(results, metric):
+    """Returns the time of each benchmark in ns, preferring the median aggregate."""
+    scale = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+    plain = {}
+    median = {}
+    for b in results.get('benchmarks', []):
+        if b.get('error_occurred'):
+            continue
+        value = b[metric] * scale[b.get('time_unit', 'ns')]
+        if b.get('run_type') == 'aggregate':
+            if b.get('aggregate_name') == 'median':
+                median[b['run_name']] = value
+        else:
+            # the first repetition is kept if there are no aggregates
+            plain.setdefault(b.get('run_name', b['name']), value)
+    plain.update(median)
+    return plain
+
+
+def thresholds(args):
+    specific = []
+    for t in args.threshold_for:
+        pattern, _, value = t.rpartition('=')
+        if not pattern:
+            sys.exit("invalid threshold '" + t + "', expected REGEX=VALUE")
+        specific.append((re.compile(pattern), float(value)))
+
+    def threshold(name):
+        for pattern, value in specific:
+            if pattern.search(name):
+                return value
+        return args.threshold
+    return threshold
+
+
+def check_context(baseline, results):
+    keys = ['num_cpus', 'mhz_per_cpu', 'library_build_type']
+    b = baseline.get('context', {})
+    r = results.get('context', {})
+    for k in keys:
+        if k in b and k in r and b[k] != r[k]:
+            print('warning: ' + k + ' differs, baseline ' + str(b[k]) + ', results ' + str(r[k]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares eerosBench results against a baseline.')
+    parser.add_argument('baseline', help='stored baseline in JSON format')
+    parser.add_argument('results', help='new results in JSON format')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='allowed relative increase of the time, default 0.1')
+    parser.add_argument('--threshold-for', action='append', default=[], metavar='REGEX=VALUE',
+                        help='allowed relative increase for the benchmarks matching REGEX, the first match is used')
+    parser.add_argument('--metric', choices=['real_time', 'cpu_time'], default='real_time',
+                        help='time which is compared, default real_time')
+    parser.add_argument('--filter', default='', metavar='REGEX',
+                        help='compare only the benchmarks matching REGEX')
+    parser.add_argument('--update', action='store_true',
+                        help='store the results as new baseline instead of comparing')
+    args = parser.parse_args()
+
+    if args.update:
+        load(args.results)
+        shutil.copyfile(args.results, args.baseline)
+        print('baseline ' + args.baseline + ' updated')
+        return 0
+
+    baseline = load(args.baseline)
+    results = load(args.results)
+    check_context(baseline, results)
+    threshold = thresholds(args)
+    selected = re.compile(args.filter)
+    old = times(baseline, args.metric)
+    new = times(results, args.metric)
+
+    regressions = 0
+    width = max([len(n) for n in set(old) | set(new)] + [9])
+    print('%-*s %12s %12s %8s %8s' % (width, 'benchmark', 'baseline', 'result', 'change', 'allowed'))
+    for name in sorted(set(old) | set(new)):
+        if not selected.search(name):
+            continue
+        if name not in new:
+            print('%-*s %12.1f %12s' % (width, name, old[name], 'missing'))
+            continue
+        if name not in old:
+            print('%-*s %12s %12.1f' % (width, name, 'missing', new[name]))
+            continue
+        change = new[name] / old[name] - 1.0 if old[name] > 0 else 0.0
+        allowed = threshold(name)
+        failed = change > allowed
+        regressions += failed
+        print('%-*s %12.1f %12.1f %+7.1f%% %+7.1f%%%s' % (width, name, old[name], new[name],
+              change * 100, allowed * 100, '  REGRESSION' if failed else ''))
+
+    if regressions > 0:
+        print(str(regressions) + ' regression(s), times in ns')
+        return 1
+    print('no regressions, times in ns')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,99 @@
+#include <eeros/control/Arena.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/I.hpp>
+#include <eeros/control/Saturation.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+/*
+ * One axis of blocks, constant -> gain -> saturation -> integrator.
+ */
+struct Axis {
+  Constant<>* c;
+  Gain<>* g;
+  Saturation<>* s;
+  I<>* i;
+  void connect() {
+    g->getIn().connect(c->getOut());
+    s->getIn().connect(g->getOut());
+    i->getIn().connect(s->getOut());
+    i->setLimit(1e6, -1e6);
+    i->enable();
+  }
+  void addTo(TimeDomain& td) {
+    td.addBlock(c);
+    td.addBlock(g);
+    td.addBlock(s);
+    td.addBlock(i);
+  }
+};
+
+/*
+ * state.range(0) axes created on the heap in random order, with allocations of other
+ * objects in between, as happens when blocks are members of different objects of an
+ * application. The time domain runs them axis by axis.
+ */
+void controlArenaHeap(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  std::vector<Axis> axes(state.range(0));
+  std::vector<std::function<void()>> create;
+  std::vector<std::unique_ptr<Block>> blocks;
+  std::vector<std::unique_ptr<char[]>> others;
+  std::mt19937 random(1);
+  for (auto& a : axes) {
+    create.push_back([&]() { a.c = new Constant<>(1.0); blocks.emplace_back(a.c); });
+    create.push_back([&]() { a.g = new Gain<>(2.0); blocks.emplace_back(a.g); });
+    create.push_back([&]() { a.s = new Saturation<>(10.0); blocks.emplace_back(a.s); });
+    create.push_back([&]() { a.i = new I<>(); blocks.emplace_back(a.i); });
+  }
+  std::shuffle(create.begin(), create.end(), random);
+  for (auto& f : create) {
+    f();
+    others.emplace_back(new char[64 + random() % 4096]);
+  }
+  TimeDomain td("benchHeap", 0.001, false);
+  for (auto& a : axes) {
+    a.connect();
+    a.addTo(td);
+  }
+  for (auto _ : state) td.run();
+  state.SetItemsProcessed(state.iterations() * blocks.size());
+}
+BENCHMARK(controlArenaHeap)->Arg(64)->Arg(512)->Arg(4096);
+
+/*
+ * The same axes created in an arena in schedule order.
+ */
+void controlArenaContiguous(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  std::vector<Axis> axes(state.range(0));
+  TimeDomain td("benchArena", 0.001, false);
+  Arena arena(td, state.range(0) * 4096);
+  for (auto& a : axes) {
+    a.c = &arena.create<Constant<>>(1.0);
+    a.g = &arena.create<Gain<>>(2.0);
+    a.s = &arena.create<Saturation<>>(10.0);
+    a.i = &arena.create<I<>>();
+    a.connect();
+  }
+  for (auto _ : state) td.run();
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+  state.counters["bytesPerAxis"] = static_cast<double>(arena.getUsed()) / state.range(0);
+  state.counters["locked"] = arena.isLocked();
+}
+BENCHMARK(controlArenaContiguous)->Arg(64)->Arg(512)->Arg(4096);
+
+}
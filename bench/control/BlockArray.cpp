@@ -0,0 +1,88 @@
+#include <eeros/control/BlockArray.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+constexpr uint8_t channels = 64;
+
+/*
+ * One gain, saturation and integrator per channel, each a block of its own.
+ */
+struct ScalarBlocks {
+  ScalarBlocks() : td("benchScalar", 0.001, false) {
+    for (uint8_t i = 0; i < channels; i++) {
+      c.emplace_back(new Constant<>(i));
+      g.emplace_back(new Gain<>(2.0));
+      s.emplace_back(new Saturation<>(-10.0, 10.0));
+      in.emplace_back(new I<>());
+      g[i]->getIn().connect(c[i]->getOut());
+      s[i]->getIn().connect(g[i]->getOut());
+      in[i]->getIn().connect(s[i]->getOut());
+      in[i]->setLimit(100.0, -100.0);
+      in[i]->enable();
+    }
+    for (auto& b : c) td.addBlock(*b);
+    for (auto& b : g) td.addBlock(*b);
+    for (auto& b : s) td.addBlock(*b);
+    for (auto& b : in) td.addBlock(*b);
+  }
+  std::vector<std::unique_ptr<Constant<>>> c;
+  std::vector<std::unique_ptr<Gain<>>> g;
+  std::vector<std::unique_ptr<Saturation<>>> s;
+  std::vector<std::unique_ptr<I<>>> in;
+  TimeDomain td;
+};
+
+/*
+ * The same controller with one block array per kind.
+ */
+struct ArrayBlocks {
+  ArrayBlocks() : s(-10.0, 10.0), g(2.0), td("benchArray", 0.001, false) {
+    Matrix<channels,1> v;
+    for (uint8_t i = 0; i < channels; i++) v[i] = i;
+    c.setValue(v);
+    g.getIn().connect(c.getOut());
+    s.getIn().connect(g.getOut());
+    in.getIn().connect(s.getOut());
+    for (uint8_t i = 0; i < channels; i++) in.setLimit(i, 100.0, -100.0);
+    in.enable();
+    td.addBlock(c);
+    td.addBlock(g);
+    td.addBlock(s);
+    td.addBlock(in);
+  }
+  Constant<Matrix<channels,1>> c;
+  BlockArray<Saturation<>, channels> s;
+  BlockArray<Gain<>, channels> g;
+  BlockArray<I<>, channels> in;
+  TimeDomain td;
+};
+
+void controlScalarBlocks(benchmark::State& state) {
+  ScalarBlocks sys;
+  for (auto _ : state) {
+    sys.td.run();
+    benchmark::DoNotOptimize(sys.in.back()->getOut().getSignal().getValue());
+  }
+  state.counters["channelRate"] = benchmark::Counter(state.iterations() * channels, benchmark::Counter::kIsRate);
+}
+BENCHMARK(controlScalarBlocks);
+
+void controlBlockArray(benchmark::State& state) {
+  ArrayBlocks sys;
+  for (auto _ : state) {
+    sys.td.run();
+    benchmark::DoNotOptimize(sys.in.getOut().getSignal().getValue());
+  }
+  state.counters["channelRate"] = benchmark::Counter(state.iterations() * channels, benchmark::Counter::kIsRate);
+}
+BENCHMARK(controlBlockArray);
+
+}
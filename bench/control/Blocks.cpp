@@ -0,0 +1,131 @@
+#include <eeros/core/System.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/D.hpp>
+#include <eeros/control/DeMux.hpp>
+#include <eeros/control/Delay.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/I.hpp>
+#include <eeros/control/Mux.hpp>
+#include <eeros/control/RateLimiter.hpp>
+#include <eeros/control/Saturation.hpp>
+#include <eeros/control/Sum.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::math;
+
+namespace {
+
+constexpr uint64_t periodNs = 1000000;
+
+/*
+ * Runs a source and a block once per cycle with an advancing cycle time.
+ * The cost of the source alone is measured by controlBlockConstant.
+ */
+template < typename S, typename B >
+void run(benchmark::State& state, S& source, B& block) {
+  uint64_t time = 0;
+  for (auto _ : state) {
+    System::Cycle cycle(time += periodNs);
+    source.run();
+    block.run();
+  }
+}
+
+void controlBlockConstant(benchmark::State& state) {
+  Constant<> c(0.5);
+  uint64_t time = 0;
+  for (auto _ : state) {
+    System::Cycle cycle(time += periodNs);
+    c.run();
+  }
+}
+BENCHMARK(controlBlockConstant);
+
+void controlBlockGain(benchmark::State& state) {
+  Constant<> c(0.5);
+  Gain<> g(2.0);
+  g.getIn().connect(c.getOut());
+  run(state, c, g);
+}
+BENCHMARK(controlBlockGain);
+
+void controlBlockGainMatrix(benchmark::State& state) {
+  Constant<Matrix<3,1>> c(Matrix<3,1>{0.1, 0.2, 0.3});
+  Gain<Matrix<3,1>, Matrix<3,3>> g(Matrix<3,3>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+  g.getIn().connect(c.getOut());
+  run(state, c, g);
+}
+BENCHMARK(controlBlockGainMatrix);
+
+void controlBlockSum(benchmark::State& state) {
+  Constant<> c(0.5);
+  Sum<2> s;
+  s.getIn(0).connect(c.getOut());
+  s.getIn(1).connect(c.getOut());
+  s.negateInput(1);
+  run(state, c, s);
+}
+BENCHMARK(controlBlockSum);
+
+void controlBlockI(benchmark::State& state) {
+  Constant<> c(0.5);
+  I<> i;
+  i.getIn().connect(c.getOut());
+  i.setLimit(1e6, -1e6);
+  i.enable();
+  run(state, c, i);
+}
+BENCHMARK(controlBlockI);
+
+void controlBlockD(benchmark::State& state) {
+  Constant<> c(0.5);
+  D<> d;
+  d.getIn().connect(c.getOut());
+  run(state, c, d);
+}
+BENCHMARK(controlBlockD);
+
+void controlBlockSaturation(benchmark::State& state) {
+  Constant<> c(0.5);
+  Saturation<> s(-0.2, 0.2);
+  s.getIn().connect(c.getOut());
+  run(state, c, s);
+}
+BENCHMARK(controlBlockSaturation);
+
+void controlBlockRateLimiter(benchmark::State& state) {
+  Constant<> c(0.5);
+  RateLimiter<> r(0.1);
+  r.getIn().connect(c.getOut());
+  r.enable();
+  run(state, c, r);
+}
+BENCHMARK(controlBlockRateLimiter);
+
+void controlBlockDelay(benchmark::State& state) {
+  Constant<> c(0.5);
+  Delay<> d(0.01, 0.001);
+  d.getIn().connect(c.getOut());
+  run(state, c, d);
+}
+BENCHMARK(controlBlockDelay);
+
+void controlBlockMux(benchmark::State& state) {
+  Constant<> c(0.5);
+  Mux<3> m;
+  for (int i = 0; i < 3; i++) m.getIn(i).connect(c.getOut());
+  run(state, c, m);
+}
+BENCHMARK(controlBlockMux);
+
+void controlBlockDeMux(benchmark::State& state) {
+  Constant<Matrix<3,1>> c(Matrix<3,1>{0.1, 0.2, 0.3});
+  DeMux<3> d;
+  d.getIn().connect(c.getOut());
+  run(state, c, d);
+}
+BENCHMARK(controlBlockDeMux);
+
+}
@@ -0,0 +1,41 @@
+#include <eeros/core/System.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+constexpr int blocks = 64;
+
+void coreSystemGetTimeNs(benchmark::State& state) {
+  for (auto _ : state) benchmark::DoNotOptimize(System::getTimeNs());
+}
+BENCHMARK(coreSystemGetTimeNs);
+
+void coreSystemGetCycleTimeNs(benchmark::State& state) {
+  System::Cycle cycle;
+  for (auto _ : state) benchmark::DoNotOptimize(System::getCycleTimeNs());
+}
+BENCHMARK(coreSystemGetCycleTimeNs);
+
+/*
+ * A time domain with 64 constants, each stamps its output once per cycle.
+ */
+void controlTimeDomainTimestamps(benchmark::State& state) {
+  TimeDomain td("benchTimestamps", 0.001, false);
+  std::vector<std::unique_ptr<Constant<>>> c;
+  for (int i = 0; i < blocks; i++) {
+    c.emplace_back(new Constant<>(i));
+    td.addBlock(*c.back());
+  }
+  for (auto _ : state) td.run();
+  state.counters["blockRate"] = benchmark::Counter(state.iterations() * blocks, benchmark::Counter::kIsRate);
+}
+BENCHMARK(controlTimeDomainTimestamps);
+
+}
@@ -0,0 +1,49 @@
+#include <eeros/control/InputRecorder.hpp>
+#include <eeros/control/PeripheralInput.hpp>
+#include <eeros/hal/HAL.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+constexpr int channels = 200;
+
+class BenchInput : public hal::Input<double> {
+ public:
+  BenchInput(const std::string& id) : hal::Input<double>(id, nullptr) { hal::HAL::instance().addInput(this); }
+  ~BenchInput() { hal::HAL::instance().removeInput(this); }
+  virtual double get() { return 1.5; }
+};
+
+/*
+ * Records one frame of 200 inputs per iteration, the writer thread appends the frames to a file.
+ * The number of iterations fits into the buffer, so no frame is dropped.
+ */
+void controlInputRecorder(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  std::vector<std::unique_ptr<BenchInput>> hw;
+  std::vector<std::unique_ptr<PeripheralInput<>>> in;
+  for (int i = 0; i < channels; i++) {
+    hw.emplace_back(new BenchInput("benchRec" + std::to_string(i)));
+    in.emplace_back(new PeripheralInput<>("benchRec" + std::to_string(i)));
+    in.back()->run();
+  }
+  {
+    InputRecorder rec("benchRecording.bin", 4096);
+    for (auto& i : in) rec.add(*i);
+    for (auto _ : state) rec.run();
+    state.counters["dropped"] = rec.getDroppedCount();
+    state.counters["frameSize"] = rec.getFrameSize();
+  }
+  std::remove("benchRecording.bin");
+}
+BENCHMARK(controlInputRecorder)->Iterations(4000);
+
+}
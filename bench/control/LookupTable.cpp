@@ -0,0 +1,107 @@
+#include <eeros/control/LookupTable.hpp>
+#include <eeros/config/FileConfig.hpp>
+#include <eeros/config/TableFile.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::config;
+using namespace eeros::math;
+
+namespace {
+
+constexpr std::size_t samples = 2000000;
+
+/*
+ * Configuration holding an encoder linearization table either as array or as table file.
+ */
+class CalibrationConfig : public FileConfig {
+ public:
+  CalibrationConfig(const char* name) : FileConfig(name), values(samples) {
+    add("linearization", samples, values.data(), values.data() + samples);
+    add("linearizationTable", table);
+  }
+  std::vector<double> values;
+  std::shared_ptr<TableFile> table;
+};
+
+/*
+ * Writes a table with two million samples as text configuration and as table file.
+ */
+struct Files {
+  Files() : text("benchCalibration.txt"), binary("benchCalibration.bin") {
+    CalibrationConfig config(text.c_str());
+    for (std::size_t i = 0; i < samples; i++) config.values[i] = i + 1e-3 * std::sin(i * 1e-3);
+    config.table = std::make_shared<TableFile>(std::vector<std::size_t>{samples}, std::vector<double>{0},
+                                               std::vector<double>{samples - 1.0}, config.values);
+    config.table->save(binary);
+    config.save();
+  }
+  ~Files() {
+    std::remove(text.c_str());
+    std::remove(binary.c_str());
+  }
+  std::string text, binary;
+};
+
+Files& files() {
+  static Files f;
+  return f;
+}
+
+void configTableText(benchmark::State& state) {
+  CalibrationConfig config(files().text.c_str());
+  for (auto _ : state) {
+    config.load();
+    benchmark::DoNotOptimize(config.values[samples - 1]);
+  }
+  state.counters["sampleRate"] = benchmark::Counter(state.iterations() * samples, benchmark::Counter::kIsRate);
+}
+BENCHMARK(configTableText)->Unit(benchmark::kMillisecond)->Iterations(3);
+
+void configTableBinary(benchmark::State& state) {
+  const std::string& name = files().binary;
+  for (auto _ : state) {
+    TableFile t(name);
+    benchmark::DoNotOptimize(t.data()[samples - 1]);
+  }
+  state.counters["sampleRate"] = benchmark::Counter(state.iterations() * samples, benchmark::Counter::kIsRate);
+}
+BENCHMARK(configTableBinary)->Unit(benchmark::kMillisecond);
+
+std::shared_ptr<TableFile> table(std::size_t dims, std::size_t size) {
+  std::size_t n = 1;
+  for (std::size_t d = 0; d < dims; d++) n *= size;
+  std::vector<double> v(n);
+  for (std::size_t i = 0; i < n; i++) v[i] = std::sin(i * 1e-3);
+  return std::make_shared<TableFile>(std::vector<std::size_t>(dims, size), std::vector<double>(dims, 0.0),
+                                     std::vector<double>(dims, 1.0), v);
+}
+
+/*
+ * Looks up a pseudo random coordinate per iteration.
+ */
+template < uint8_t N, Interpolation I >
+void controlLookupTable(benchmark::State& state) {
+  LookupTable<N, I> l(table(N, state.range(0)));
+  typename LookupTable<N, I>::Tin x;
+  double u = 0.1234;
+  for (auto _ : state) {
+    u += 0.618034;
+    u -= std::floor(u);
+    if constexpr (N == 1) x = u;
+    else for (uint8_t d = 0; d < N; d++) x[d] = u * (d + 1) - std::floor(u * (d + 1));
+    benchmark::DoNotOptimize(l.get(x));
+  }
+}
+BENCHMARK_TEMPLATE(controlLookupTable, 1, Interpolation::linear)->Arg(samples);
+BENCHMARK_TEMPLATE(controlLookupTable, 1, Interpolation::cubic)->Arg(samples);
+BENCHMARK_TEMPLATE(controlLookupTable, 2, Interpolation::linear)->Arg(1000);
+BENCHMARK_TEMPLATE(controlLookupTable, 2, Interpolation::cubic)->Arg(1000);
+BENCHMARK_TEMPLATE(controlLookupTable, 3, Interpolation::linear)->Arg(100);
+BENCHMARK_TEMPLATE(controlLookupTable, 3, Interpolation::cubic)->Arg(100);
+
+}
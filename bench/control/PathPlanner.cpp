@@ -0,0 +1,99 @@
+#include <eeros/control/PathPlannerConstAcc.hpp>
+#include <eeros/control/PathPlannerConstJerk.hpp>
+#include <eeros/control/PathPlannerOnline.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::math;
+
+namespace {
+
+constexpr uint8_t axes = 12;
+using Axes = Matrix<axes,1,double>;
+
+/*
+ * Runs a planner for twelve axes back and forth, every iteration is one sampling period.
+ * A new trajectory is dispatched whenever the last one has ended.
+ */
+template < typename P, std::size_t N >
+void runPlanner(benchmark::State& state, P& planner) {
+  std::array<Axes, N> a, b;
+  for (auto& e : a) e = 0;
+  for (auto& e : b) e = 0;
+  for (uint8_t i = 0; i < axes; i++) {
+    a[0][i] = i;
+    b[0][i] = 2.0 * i + 1;
+  }
+  bool forward = true;
+  planner.setStart(a);
+  for (auto _ : state) {
+    if (planner.endReached()) {
+      planner.move(forward ? a : b, forward ? b : a);
+      forward = !forward;
+    }
+    planner.run();
+    benchmark::DoNotOptimize(planner.getPosOut().getSignal().getValue());
+  }
+  state.counters["axisRate"] = benchmark::Counter(state.iterations() * axes, benchmark::Counter::kIsRate);
+}
+
+void controlPathPlannerConstAcc(benchmark::State& state) {
+  Axes velMax, acc;
+  velMax = 1;
+  acc = 2;
+  PathPlannerConstAcc<Axes> planner(velMax, acc, acc, 0.001);
+  runPlanner<PathPlannerConstAcc<Axes>, 3>(state, planner);
+}
+BENCHMARK(controlPathPlannerConstAcc);
+
+void controlPathPlannerConstJerk(benchmark::State& state) {
+  Axes velMax, jerk;
+  velMax = 1;
+  jerk = 20;
+  PathPlannerConstJerk<Axes> planner(velMax, jerk, 0.001);
+  runPlanner<PathPlannerConstJerk<Axes>, 4>(state, planner);
+}
+BENCHMARK(controlPathPlannerConstJerk);
+
+void controlPathPlannerOnline(benchmark::State& state) {
+  Axes velMax, accMax, jerk;
+  velMax = 1;
+  accMax = 100;
+  jerk = 20;
+  PathPlannerOnline<Axes> planner(velMax, accMax, jerk, 0.001);
+  runPlanner<PathPlannerOnline<Axes>, 4>(state, planner);
+}
+BENCHMARK(controlPathPlannerOnline);
+
+/*
+ * Sets a new target for twelve axes before every sampling period, so every run replans
+ * from the current state. Reports the worst case time of a run in addition to the mean.
+ */
+void controlPathPlannerOnlineReplan(benchmark::State& state) {
+  Axes velMax, accMax, jerk, target;
+  velMax = 1;
+  accMax = 2;
+  jerk = 20;
+  PathPlannerOnline<Axes> planner(velMax, accMax, jerk, 0.001);
+  uint32_t seed = 1;
+  double worst = 0;
+  for (auto _ : state) {
+    for (uint8_t i = 0; i < axes; i++) {
+      seed = seed * 1664525 + 1013904223;
+      target[i] = (seed >> 8) * (1.0 / (1 << 24)) - 0.5;
+    }
+    planner.setTarget(target);
+    auto start = std::chrono::steady_clock::now();
+    planner.run();
+    worst = std::max(worst, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    benchmark::DoNotOptimize(planner.getPosOut().getSignal().getValue());
+  }
+  state.counters["worstRunUs"] = worst * 1e6;
+}
+BENCHMARK(controlPathPlannerOnlineReplan);
+
+}
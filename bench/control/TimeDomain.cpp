@@ -0,0 +1,72 @@
+#include <eeros/core/System.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+/*
+ * A constant followed by a chain of state.range(0) gains.
+ */
+struct Chain {
+  Chain(int length) : c(0.5) {
+    for (int i = 0; i < length; i++) {
+      g.emplace_back(new Gain<>(1.0));
+      g.back()->getIn().connect(i == 0 ? c.getOut() : g[i - 1]->getOut());
+    }
+  }
+  Constant<> c;
+  std::vector<std::unique_ptr<Gain<>>> g;
+};
+
+/*
+ * The blocks run by a time domain, including reading the clock, the fault check and the monitors.
+ */
+void controlTimeDomainRun(benchmark::State& state) {
+  Chain chain(state.range(0));
+  TimeDomain td("benchRun", 0.001, false);
+  td.addBlock(chain.c);
+  for (auto& g : chain.g) td.addBlock(*g);
+  for (auto _ : state) td.run();
+  state.SetItemsProcessed(state.iterations() * (state.range(0) + 1));
+}
+BENCHMARK(controlTimeDomainRun)->Arg(0)->Arg(1)->Arg(16)->Arg(256);
+
+/*
+ * The same blocks run directly, the difference to controlTimeDomainRun is the overhead of the time domain.
+ */
+void controlTimeDomainDirect(benchmark::State& state) {
+  Chain chain(state.range(0));
+  for (auto _ : state) {
+    System::Cycle cycle;
+    chain.c.run();
+    for (auto& g : chain.g) g->run();
+  }
+  state.SetItemsProcessed(state.iterations() * (state.range(0) + 1));
+}
+BENCHMARK(controlTimeDomainDirect)->Arg(0)->Arg(1)->Arg(16)->Arg(256);
+
+/*
+ * 16 independent chains of 16 gains, run serially or by state.range(0) threads.
+ */
+void controlTimeDomainParallel(benchmark::State& state) {
+  std::vector<std::unique_ptr<Chain>> chains;
+  TimeDomain td("benchParallel", 0.001, false);
+  for (int i = 0; i < 16; i++) {
+    chains.emplace_back(new Chain(16));
+    td.addBlock(chains.back()->c);
+    for (auto& g : chains.back()->g) td.addBlock(*g);
+  }
+  td.setParallel(state.range(0));
+  for (auto _ : state) td.run();
+  state.counters["groups"] = td.getParallelGroups();
+}
+BENCHMARK(controlTimeDomainParallel)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+}
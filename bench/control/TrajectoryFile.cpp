@@ -0,0 +1,81 @@
+#include <eeros/control/PathPlannerCubic.hpp>
+#include <eeros/control/TrajectoryFile.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+constexpr std::size_t segments = 1000000;
+
+/*
+ * Writes a trajectory with one million segments of alternating jerk in both formats.
+ */
+struct Files {
+  Files() : text("benchTrajectory.txt"), binary("benchTrajectory.bin") {
+    std::ofstream file(text);
+    double dt = 0.001, j = 1000, acc = 0, vel = 0, pos = 0;
+    for (std::size_t i = 0; i < segments; i++) {
+      double jerk = (i % 4 == 0 || i % 4 == 3) ? j : -j;
+      file << dt << ' ' << jerk << ' ' << acc << ' ' << vel << ' ' << pos << '\n';
+      pos += vel * dt + acc * dt * dt / 2 + jerk * dt * dt * dt / 6;
+      vel += acc * dt + jerk * dt * dt / 2;
+      acc += jerk * dt;
+    }
+    file.close();
+    TrajectoryFile::convert(text, binary);
+  }
+  ~Files() {
+    std::remove(text.c_str());
+    std::remove(binary.c_str());
+  }
+  std::string text, binary;
+};
+
+Files& files() {
+  static Files f;
+  return f;
+}
+
+void controlTrajectoryFileText(benchmark::State& state) {
+  const std::string& name = files().text;
+  for (auto _ : state) {
+    TrajectoryFile f(name);
+    benchmark::DoNotOptimize(f[f.size() - 1].end);
+  }
+  state.counters["segmentRate"] = benchmark::Counter(state.iterations() * segments, benchmark::Counter::kIsRate);
+}
+BENCHMARK(controlTrajectoryFileText)->Unit(benchmark::kMillisecond);
+
+void controlTrajectoryFileBinary(benchmark::State& state) {
+  const std::string& name = files().binary;
+  for (auto _ : state) {
+    TrajectoryFile f(name);
+    benchmark::DoNotOptimize(f[f.size() - 1].end);
+  }
+  state.counters["segmentRate"] = benchmark::Counter(state.iterations() * segments, benchmark::Counter::kIsRate);
+}
+BENCHMARK(controlTrajectoryFileBinary)->Unit(benchmark::kMillisecond);
+
+/*
+ * Restarts the trajectory at a different time every sampling period.
+ */
+void controlPathPlannerCubicSeek(benchmark::State& state) {
+  PathPlannerCubic planner(0.001);
+  planner.init(files().binary);
+  planner.move(0);
+  double time = 0;
+  for (auto _ : state) {
+    time += 123.456;
+    if (time > segments * 0.001) time -= segments * 0.001;
+    planner.seek(time);
+    planner.run();
+    benchmark::DoNotOptimize(planner.getPosOut().getSignal().getValue());
+  }
+}
+BENCHMARK(controlPathPlannerCubicSeek);
+
+}
@@ -0,0 +1,75 @@
+#include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/task/Periodic.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+using namespace eeros;
+
+namespace {
+
+constexpr double period = 0.001;
+constexpr int cycles = 2000;
+
+// upper bounds of the histogram buckets in us, the last bucket counts all larger deviations
+constexpr int buckets[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000};
+
+/*
+ * Jitter of the main task of the executor, which runs in the benchmark thread. The start
+ * of each cycle is recorded, the deviation of the intervals from the period is reported
+ * as percentiles and as histogram in us. The reported time is the 99th percentile of the
+ * deviation, so comparing against a baseline tracks the jitter and not the duration.
+ * The executor can only be run once per process, so this benchmark runs a single iteration.
+ */
+void coreExecutorJitter(benchmark::State& state) {
+  static bool done = false;
+  if (done) {
+    state.SkipWithError("the executor can only be run once per process");
+    for (auto _ : state) { }
+    return;
+  }
+  done = true;
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  std::vector<uint64_t> starts;
+  starts.reserve(cycles + 1);
+  task::Lambda record([&starts]() {
+    starts.push_back(System::getTimeNs());
+    if (starts.size() > cycles) Executor::stop();
+  });
+  task::Periodic main("benchJitter", period, record);
+  auto& executor = Executor::instance();
+  executor.setMainTask(main);
+  std::vector<double> jitter;
+  for (auto _ : state) {
+    executor.run();
+    for (std::size_t i = 1; i < starts.size(); i++) jitter.push_back(std::fabs((starts[i] - starts[i - 1]) * 1e-9 - period) * 1e6);
+    std::sort(jitter.begin(), jitter.end());
+    state.SetIterationTime(jitter.empty() ? 0 : jitter[jitter.size() * 99 / 100] * 1e-6);
+  }
+  if (jitter.empty()) {
+    state.SkipWithError("no cycles recorded");
+    return;
+  }
+  auto percentile = [&jitter](int p) { return jitter[std::min(jitter.size() - 1, jitter.size() * p / 100)]; };
+  state.counters["p50us"] = percentile(50);
+  state.counters["p99us"] = percentile(99);
+  state.counters["maxus"] = jitter.back();
+  auto begin = jitter.begin();
+  char name[16];
+  for (int b : buckets) {
+    auto end = std::upper_bound(begin, jitter.end(), static_cast<double>(b));
+    std::snprintf(name, sizeof(name), "hist%04dus", b);
+    state.counters[name] = end - begin;
+    begin = end;
+  }
+  state.counters["histMore"] = jitter.end() - begin;
+}
+BENCHMARK(coreExecutorJitter)->Iterations(1)->Repetitions(1)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+}
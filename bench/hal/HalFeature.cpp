@@ -0,0 +1,60 @@
+#include <eeros/hal/HAL.hpp>
+#include <benchmark/benchmark.h>
+#include <dlfcn.h>
+
+using namespace eeros;
+using namespace eeros::hal;
+
+/*
+ * The executable itself acts as hardware wrapper library, the feature
+ * function below is resolved with dlsym on the handle of the main program.
+ */
+extern "C" void benchSetValue(InputInterface* obj, int value) {
+  benchmark::DoNotOptimize(obj);
+  benchmark::DoNotOptimize(value);
+}
+
+namespace {
+
+class BenchInput : public Input<double> {
+ public:
+  BenchInput(std::string id, void* libHandle) : Input<double>(id, libHandle) { }
+  virtual double get() { return 0.0; }
+};
+
+BenchInput& benchInput() {
+  static BenchInput input("benchFeatureIn", dlopen(nullptr, RTLD_NOW));
+  static bool added = HAL::instance().addInput(&input);
+  (void)added;
+  return input;
+}
+
+void halFeatureDlsym(benchmark::State& state) {
+  BenchInput& input = benchInput();
+  std::string featureName = "benchSetValue";
+  for (auto _ : state) {
+    auto f = reinterpret_cast<void(*)(InputInterface*, int)>(dlsym(input.getLibHandle(), featureName.c_str()));
+    f(&input, 1);
+  }
+}
+BENCHMARK(halFeatureDlsym);
+
+void halCallInputFeature(benchmark::State& state) {
+  HAL& hal = HAL::instance();
+  BenchInput& input = benchInput();
+  for (auto _ : state) {
+    hal.callInputFeature(&input, "benchSetValue", 1);
+  }
+}
+BENCHMARK(halCallInputFeature);
+
+void halFeatureHandle(benchmark::State& state) {
+  BenchInput& input = benchInput();
+  auto setValue = HAL::instance().feature<void(int)>(&input, "benchSetValue");
+  for (auto _ : state) {
+    setValue(1);
+  }
+}
+BENCHMARK(halFeatureHandle);
+
+}
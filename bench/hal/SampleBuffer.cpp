@@ -0,0 +1,40 @@
+#include <eeros/hal/SampleBuffer.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace eeros;
+using namespace eeros::hal;
+using namespace eeros::math;
+
+namespace {
+
+// scan of a laser scanner as handed over by hal::RPLidar
+struct Scan {
+  Matrix<380,1,double> angles, ranges, intensities;
+};
+
+// control cycle copying the scan from the driver every cycle, as the sensor blocks used to
+void halSampleCopy(benchmark::State& state) {
+  Scan driver, block;
+  driver.ranges.fill(1.0);
+  for (auto _ : state) {
+    block = driver;
+    benchmark::DoNotOptimize(block);
+  }
+}
+BENCHMARK(halSampleCopy);
+
+// control cycle picking up the latest scan, one new scan every state.range(0) cycles
+void halSampleBuffer(benchmark::State& state) {
+  SampleBuffer<Scan> buf;
+  Scan block;
+  int64_t cycle = 0;
+  for (auto _ : state) {
+    if (cycle++ % state.range(0) == 0) buf.publish(0);
+    if (buf.update()) block = buf.get().value;
+    benchmark::DoNotOptimize(block);
+  }
+}
+BENCHMARK(halSampleBuffer)->Arg(1)->Arg(100);
+
+}
@@ -0,0 +1,254 @@
+#include <eeros/hal/HAL.hpp>
+#include <eeros/hal/sim/Channels.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/control/PeripheralInput.hpp>
+#include <eeros/control/PeripheralOutput.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/I.hpp>
+#include <eeros/control/Switch.hpp>
+#include <eeros/control/Mux.hpp>
+#include <eeros/control/DeMux.hpp>
+#include <eeros/control/PathPlannerConstAcc.hpp>
+#include <eeros/safety/SafetySystem.hpp>
+#include <eeros/safety/SafetyProperties.hpp>
+#include <eeros/safety/InputAction.hpp>
+#include <eeros/safety/OutputAction.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::hal;
+using namespace eeros::hal::sim;
+using namespace eeros::math;
+using namespace eeros::safety;
+
+namespace {
+
+constexpr double period = 0.0001;  // 10 kHz
+constexpr int pacedCycles = 10000;
+
+// stream without buffer, the log messages of the level transitions are formatted and discarded
+std::ostream& nullStream() {
+  static std::ostream os(nullptr);
+  return os;
+}
+
+/*
+ * Simulated hardware of the mock robot: two motors whose positions are read back by
+ * encoders 200 us later, an emergency stop button and an enable output. The channels
+ * are created and added to the HAL only once, as the HAL cannot remove outputs.
+ */
+struct SimHardware {
+  SimHardware()
+      : mot0("benchRobotMot0", nullptr, 1, 0, -30, 30, "m"),
+        mot1("benchRobotMot1", nullptr, 1, 0, -30, 30, "m"),
+        enc0("benchRobotEnc0", nullptr, 1, 0, -30, 30, "m", "loopback source=benchRobotMot0 delay=0.0002"),
+        enc1("benchRobotEnc1", nullptr, 1, 0, -30, 30, "m", "loopback source=benchRobotMot1 delay=0.0002"),
+        emergency("benchRobotEmergency", nullptr, false, "constant value=0"),
+        enable("benchRobotEnable", nullptr, false) {
+    HAL& hal = HAL::instance();
+    hal.addOutput(&mot0);
+    hal.addOutput(&mot1);
+    hal.addInput(&enc0);
+    hal.addInput(&enc1);
+    hal.addInput(&emergency);
+    hal.addOutput(&enable);
+  }
+  SimAnalogOut mot0, mot1;
+  SimAnalogIn enc0, enc1;
+  SimDigIn emergency;
+  SimDigOut enable;
+};
+
+SimHardware& hardware() {
+  static SimHardware hw;
+  return hw;
+}
+
+/*
+ * The control system of examples/system/MockRobotControlSystem.hpp, with the output of
+ * the switch driving the motors and the encoders fed back as measured position.
+ */
+struct RobotControlSystem {
+  RobotControlSystem()
+      : setpoint({0, 0}), pp({10, 20}, {0.5, 1.0}, {0.2, 0.5}, period),
+        mot0("benchRobotMot0", false), mot1("benchRobotMot1", false),
+        enc0("benchRobotEnc0", false), enc1("benchRobotEnc1", false),
+        td("benchRobotTd", period, true) {
+    i.setInitCondition({0.3, -0.2});
+    i.enable();
+    sw.switchToInput(0);
+    i.getIn().connect(setpoint.getOut());
+    sw.getIn(0).connect(i.getOut());
+    sw.getIn(1).connect(pp.getPosOut());
+    motors.getIn().connect(sw.getOut());
+    mot0.getIn().connect(motors.getOut(0));
+    mot1.getIn().connect(motors.getOut(1));
+    position.getIn(0).connect(enc0.getOut());
+    position.getIn(1).connect(enc1.getOut());
+    td.addBlock(enc0);
+    td.addBlock(enc1);
+    td.addBlock(position);
+    td.addBlock(setpoint);
+    td.addBlock(i);
+    td.addBlock(pp);
+    td.addBlock(sw);
+    td.addBlock(motors);
+    td.addBlock(mot0);
+    td.addBlock(mot1);
+  }
+
+  Constant<Matrix<2,1,double>> setpoint;
+  I<Matrix<2,1,double>> i;
+  PathPlannerConstAcc<Matrix<2,1,double>> pp;
+  Switch<2, Matrix<2,1,double>> sw;
+  DeMux<2, double> motors;
+  PeripheralOutput<double> mot0, mot1;
+  PeripheralInput<double> enc0, enc1;
+  Mux<2, double> position;
+  TimeDomain td;
+};
+
+/*
+ * The safety properties of examples/system/MockRobotSafetyProperties.hpp with the
+ * emergency input checked and the enable output set in every level. The homing and the
+ * up and down moves of MockRobotSequencer.hpp are done by level actions, so that the
+ * whole system runs in the thread of the benchmark.
+ */
+class RobotSafetyProperties : public SafetyProperties {
+ public:
+  RobotSafetyProperties(RobotControlSystem& cs)
+      : slOff("off"), slHoming("homing"), slReady("ready"), slMoving("moving"),
+        abort("abort"), homingDone("homing done"), startMoving("start moving"), cs(cs), up(true) {
+    HAL& hal = HAL::instance();
+    emergency = hal.getLogicInput("benchRobotEmergency", false);
+    enable = hal.getLogicOutput("benchRobotEnable", false);
+    criticalInputs = { emergency };
+    criticalOutputs = { enable };
+
+    addLevel(slOff);
+    addLevel(slHoming);
+    addLevel(slReady);
+    addLevel(slMoving);
+
+    slHoming.addEvent(homingDone, slReady, kPublicEvent);
+    slReady.addEvent(startMoving, slMoving, kPublicEvent);
+    addEventToLevelAndAbove(slHoming, abort, slOff, kPrivateEvent);
+
+    slOff.setInputActions({ ignore(emergency) });
+    slHoming.setInputActions({ check(emergency, false, abort) });
+    slReady.setInputActions({ check(emergency, false, abort) });
+    slMoving.setInputActions({ check(emergency, false, abort) });
+
+    slOff.setOutputActions({ set(enable, false) });
+    slHoming.setOutputActions({ set(enable, true) });
+    slReady.setOutputActions({ set(enable, true) });
+    slMoving.setOutputActions({ set(enable, true) });
+
+    slHoming.setLevelAction([this](SafetyContext* privateContext) {
+      auto pos = this->cs.position.getOut().getSignal().getValue();
+      this->cs.setpoint.setValue({pos[0] < 1.0 ? 10.0 : 0.0, pos[1] < 1.0 ? 10.0 : 0.0});
+      if (pos[0] >= 1.0 && pos[1] >= 1.0) privateContext->triggerEvent(homingDone);
+    });
+    slReady.setLevelAction([this](SafetyContext* privateContext) {
+      if (slReady.getNofActivations() < 100) return;
+      this->cs.sw.switchToInput(1);
+      privateContext->triggerEvent(startMoving);
+    });
+    slMoving.setLevelAction([this](SafetyContext* privateContext) {
+      if (!this->cs.pp.endReached()) return;
+      this->cs.pp.move(up ? Matrix<2,1,double>{8.2, 27.0} : Matrix<2,1,double>{-5, 3});
+      up = !up;
+    });
+
+    setEntryLevel(slHoming);
+  }
+
+  SafetyLevel slOff, slHoming, slReady, slMoving;
+  SafetyEvent abort, homingDone, startMoving;
+  RobotControlSystem& cs;
+  hal::Input<bool>* emergency;
+  hal::Output<bool>* enable;
+  bool up;
+};
+
+/*
+ * The mock robot on the simulated hardware library. One cycle runs the time domain and
+ * then the safety system, in the order the executor runs a time domain and its main task.
+ */
+struct SimRobot {
+  SimRobot() : hw(hardware()), sp(cs), ss(sp, period) { }
+  void cycle() {
+    cs.td.run();
+    ss.run();
+  }
+  SimHardware& hw;
+  RobotControlSystem cs;
+  RobotSafetyProperties sp;
+  SafetySystem ss;
+};
+
+/*
+ * Cycles of the mock robot back to back, including homing and moving. Reports the cycles
+ * per second and the load, the fraction of the 100 us period of a 10 kHz system used.
+ */
+void simRobotCycle(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(nullStream());
+  SimRobot robot;
+  for (auto _ : state) {
+    robot.cycle();
+  }
+  if (robot.ss.getCurrentLevel() == robot.sp.slOff) state.SkipWithError("emergency stop of the mock robot");
+  state.counters["cycleRate"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+  state.counters["load10kHz"] = benchmark::Counter(state.iterations() * period, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  logger::Logger::setDefaultStreamLogger(std::cout);
+}
+BENCHMARK(simRobotCycle);
+
+/*
+ * The mock robot paced at 10 kHz for one second, waiting for each period like the executor
+ * does. The executor itself can only run once per process and is used by coreExecutorJitter.
+ * The reported time is the 99th percentile of the lateness of the cycle starts, missed
+ * counts the cycles which started later than one period after their deadline.
+ */
+void simRobot10kHz(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(nullStream());
+  using clock = std::chrono::steady_clock;
+  SimRobot robot;
+  std::vector<double> late;
+  late.reserve(pacedCycles);
+  bool moving = false;
+  for (auto _ : state) {
+    auto next = clock::now();
+    for (int k = 0; k < pacedCycles; k++) {
+      next += std::chrono::nanoseconds(static_cast<int64_t>(period * 1e9));
+      std::this_thread::sleep_until(next);
+      late.push_back(std::chrono::duration<double, std::micro>(clock::now() - next).count());
+      robot.cycle();
+      moving = moving || robot.ss.getCurrentLevel() == robot.sp.slMoving;
+    }
+    std::vector<double> sorted(late);
+    std::sort(sorted.begin(), sorted.end());
+    state.SetIterationTime(sorted[sorted.size() * 99 / 100] * 1e-6);
+  }
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  if (!moving) {
+    state.SkipWithError("the mock robot did not reach the moving level");
+    return;
+  }
+  std::sort(late.begin(), late.end());
+  state.counters["p50us"] = late[late.size() / 2];
+  state.counters["p99us"] = late[late.size() * 99 / 100];
+  state.counters["maxus"] = late.back();
+  state.counters["missed"] = late.end() - std::upper_bound(late.begin(), late.end(), period * 1e6);
+}
+BENCHMARK(simRobot10kHz)->Iterations(1)->Repetitions(1)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+}
@@ -0,0 +1,42 @@
+#include <eeros/logger/Logger.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+#include <benchmark/benchmark.h>
+#include <iostream>
+
+using namespace eeros::logger;
+
+namespace {
+
+// stream without buffer, the messages are formatted and discarded
+std::ostream& nullStream() {
+  static std::ostream os(nullptr);
+  return os;
+}
+
+/*
+ * A message with a number formatted and written by a stream log writer.
+ */
+void loggerInfo(benchmark::State& state) {
+  Logger::setDefaultStreamLogger(nullStream());
+  Logger log = Logger::getLogger('B');
+  log.show(LogLevel::TRACE);
+  int i = 0;
+  for (auto _ : state) log.info() << "cycle " << i++ << ": " << 0.5;
+  Logger::setDefaultStreamLogger(std::cout);
+}
+BENCHMARK(loggerInfo);
+
+/*
+ * A message below the visible level, which is suppressed by the writer.
+ */
+void loggerSuppressed(benchmark::State& state) {
+  Logger::setDefaultStreamLogger(nullStream());
+  Logger log = Logger::getLogger('B');
+  log.show(LogLevel::WARN);
+  int i = 0;
+  for (auto _ : state) log.trace() << "cycle " << i++ << ": " << 0.5;
+  Logger::setDefaultStreamLogger(std::cout);
+}
+BENCHMARK(loggerSuppressed);
+
+}
@@ -0,0 +1,81 @@
+#include <eeros/math/Matrix.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace eeros::math;
+
+namespace {
+
+template < unsigned int M, unsigned int N >
+Matrix<M,N> filled(double offset) {
+  Matrix<M,N> m;
+  for (unsigned int i = 0; i < M; i++) {
+    for (unsigned int j = 0; j < N; j++) m(i,j) = offset + i * 0.7 - j * 0.3 + (i == j ? 2.0 : 0.0);
+  }
+  return m;
+}
+
+template < unsigned int N >
+void mathMatrixMultiply(benchmark::State& state) {
+  auto a = filled<N,N>(0.1);
+  auto b = filled<N,N>(0.5);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+BENCHMARK_TEMPLATE(mathMatrixMultiply, 3);
+BENCHMARK_TEMPLATE(mathMatrixMultiply, 6);
+
+template < unsigned int N >
+void mathMatrixVector(benchmark::State& state) {
+  auto a = filled<N,N>(0.1);
+  auto v = filled<N,1>(0.5);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(a * v);
+  }
+}
+BENCHMARK_TEMPLATE(mathMatrixVector, 3);
+BENCHMARK_TEMPLATE(mathMatrixVector, 6);
+
+template < unsigned int N >
+void mathMatrixInverse(benchmark::State& state) {
+  auto a = filled<N,N>(0.1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(!a);
+  }
+}
+BENCHMARK_TEMPLATE(mathMatrixInverse, 2);
+BENCHMARK_TEMPLATE(mathMatrixInverse, 3);
+BENCHMARK_TEMPLATE(mathMatrixInverse, 4);
+
+void mathMatrixDet4(benchmark::State& state) {
+  auto a = filled<4,4>(0.1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.det());
+  }
+}
+BENCHMARK(mathMatrixDet4);
+
+void mathMatrixTranspose6(benchmark::State& state) {
+  auto a = filled<6,6>(0.1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.transpose());
+  }
+}
+BENCHMARK(mathMatrixTranspose6);
+
+void mathVectorAdd3(benchmark::State& state) {
+  auto a = filled<3,1>(0.1);
+  auto b = filled<3,1>(0.5);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a + b);
+  }
+}
+BENCHMARK(mathVectorAdd3);
+
+}
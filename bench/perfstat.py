@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""
+Compares hardware counters of benchmarks of eerosBench with perf stat.
+
+Each benchmark filter is run in its own eerosBench process under perf stat.
+The counters are divided by the number of iterations of the benchmark and
+printed side by side, relative to the first filter. The setup of a benchmark
+is counted as well, so the filters should select benchmarks with a similar
+setup and the minimum time should be large enough to make the setup negligible.
+
+Examples:
+  perfstat.py
+  perfstat.py 'controlArenaHeap/4096$' 'controlArenaContiguous/4096$'
+  perfstat.py --events cycles,LLC-load-misses 'controlTimeDomainRun/256$' 'controlTimeDomainDirect/256$'
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+DEFAULT_EVENTS = 'cycles,instructions,cache-references,cache-misses,L1-dcache-load-misses,dTLB-load-misses'
+DEFAULT_FILTERS = ['controlArenaHeap/512$', 'controlArenaContiguous/512$']
+
+
+def run(args, benchmark_filter):
+    command = [args.perf, 'stat', '-x', ',', '-e', args.events, '--',
+               args.bench, '--benchmark_filter=' + benchmark_filter, '--benchmark_format=json',
+               '--benchmark_min_time=' + args.min_time]
+    p = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    if p.returncode != 0:
+        sys.exit("'" + ' '.join(command) + "' failed:\n" + p.stderr)
+    benchmarks = [b for b in json.loads(p.stdout).get('benchmarks', []) if b.get('run_type') != 'aggregate']
+    if not benchmarks:
+        sys.exit("no benchmark matches '" + benchmark_filter + "'")
+    iterations = sum(b['iterations'] for b in benchmarks)
+    counters = {}
+    for line in p.stderr.splitlines():
+        fields = line.split(',')
+        if len(fields) < 3 or not fields[2]:
+            continue
+        try:
+            counters[fields[2].split(':')[0]] = float(fields[0]) / iterations
+        except ValueError:
+            counters[fields[2].split(':')[0]] = None  # <not supported> or <not counted>
+    return iterations, counters
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares hardware counters of eerosBench benchmarks per iteration.')
+    parser.add_argument('filters', nargs='*', default=DEFAULT_FILTERS,
+                        help='benchmark filters, each run in its own process, default ' + ' '.join(DEFAULT_FILTERS))
+    parser.add_argument('--bench', default=os.path.join(os.getcwd(), 'eerosBench'),
+                        help='benchmark executable, default ./eerosBench')
+    parser.add_argument('--perf', default='perf', help='perf executable')
+    parser.add_argument('--events', default=DEFAULT_EVENTS, help='comma separated perf events')
+    parser.add_argument('--min-time', default='1', help='minimum time of each benchmark in s, default 1')
+    args = parser.parse_args()
+
+    results = [run(args, f) for f in args.filters]
+    events = args.events.split(',')
+    width = max(len(e) for e in events + ['per iteration'])
+    column = max([24] + [len(f) for f in args.filters])
+    print('%-*s' % (width, 'per iteration') + ''.join(' %*s' % (column, f) for f in args.filters))
+    print('%-*s' % (width, 'iterations') + ''.join(' %*d' % (column, r[0]) for r in results))
+    for e in events:
+        line = '%-*s' % (width, e)
+        base = results[0][1].get(e)
+        for _, counters in results:
+            value = counters.get(e)
+            if value is None:
+                line += ' %*s' % (column, 'n/a')
+            elif base:
+                line += ' %*.1f (%6.2fx)' % (column - 10, value, value / base)
+            else:
+                line += ' %*.1f' % (column, value)
+        print(line)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
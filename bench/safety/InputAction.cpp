@@ -0,0 +1,57 @@
+#include <eeros/safety/SafetySystem.hpp>
+#include <eeros/safety/InputAction.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::safety;
+
+namespace {
+
+template < typename T >
+class BenchInput : public hal::Input<T> {
+ public:
+  BenchInput(std::string id, T value) : hal::Input<T>(id, nullptr), value(value) { }
+  virtual T get() { return value; }
+  T value;
+};
+
+class BenchProperties : public SafetyProperties {
+ public:
+  BenchProperties() : e("e"), sl1("1"), sl2("2") {
+    addLevel(sl1);
+    addLevel(sl2);
+    sl1.addEvent(e, sl2, kPublicEvent);
+    setEntryLevel(sl1);
+  }
+  SafetyEvent e;
+  SafetyLevel sl1, sl2;
+};
+
+// one safety system cycle checking state.range(0) inputs, half digital and half analog
+void safetyInputActions(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  BenchProperties sp;
+  std::vector<std::unique_ptr<BenchInput<bool>>> digital;
+  std::vector<std::unique_ptr<BenchInput<double>>> analog;
+  std::vector<std::unique_ptr<InputAction>> actions;
+  std::vector<InputAction*> list;
+  for (int i = 0; i < state.range(0) / 2; i++) {
+    digital.emplace_back(new BenchInput<bool>("d" + std::to_string(i), true));
+    analog.emplace_back(new BenchInput<double>("a" + std::to_string(i), 0.5));
+    actions.emplace_back(check(*digital.back(), true, sp.e));
+    actions.emplace_back(range(*analog.back(), 0.0, 1.0, sp.e));
+  }
+  for (auto& a : actions) list.push_back(a.get());
+  sp.sl1.setInputActions(list);
+  SafetySystem ss(sp, 0.001);
+  for (auto _ : state) {
+    ss.run();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(safetyInputActions)->Arg(20)->Arg(200);
+
+}
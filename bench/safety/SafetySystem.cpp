@@ -0,0 +1,63 @@
+#include <eeros/safety/SafetySystem.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <benchmark/benchmark.h>
+#include <iostream>
+
+using namespace eeros;
+using namespace eeros::safety;
+
+namespace {
+
+// stream without buffer, the log messages of the transitions are formatted and discarded
+std::ostream& nullStream() {
+  static std::ostream os(nullptr);
+  return os;
+}
+
+class BenchProperties : public SafetyProperties {
+ public:
+  BenchProperties() : up("up"), down("down"), sl1("1"), sl2("2") {
+    addLevel(sl1);
+    addLevel(sl2);
+    sl1.addEvent(up, sl2, kPublicEvent);
+    sl2.addEvent(down, sl1, kPublicEvent);
+    setEntryLevel(sl1);
+  }
+  SafetyEvent up, down;
+  SafetyLevel sl1, sl2;
+};
+
+/*
+ * One safety system cycle without inputs, outputs and events.
+ */
+void safetySystemRun(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(nullStream());
+  BenchProperties sp;
+  SafetySystem ss(sp, 0.001);
+  ss.run();
+  for (auto _ : state) ss.run();
+  logger::Logger::setDefaultStreamLogger(std::cout);
+}
+BENCHMARK(safetySystemRun);
+
+/*
+ * Latency from triggering an event until the safety system is in the new level,
+ * the event is handled by the next run, including the log message of the transition.
+ */
+void safetySystemEventLatency(benchmark::State& state) {
+  logger::Logger::setDefaultStreamLogger(nullStream());
+  BenchProperties sp;
+  SafetySystem ss(sp, 0.001);
+  ss.run();
+  bool high = false;
+  for (auto _ : state) {
+    ss.triggerEvent(high ? sp.down : sp.up);
+    ss.run();
+    high = !high;
+  }
+  if (ss.getCurrentLevel() != (high ? sp.sl2 : sp.sl1)) state.SkipWithError("safety level not changed");
+  logger::Logger::setDefaultStreamLogger(std::cout);
+}
+BENCHMARK(safetySystemEventLatency);
+
+}
@@ -9,6 +9,9 @@
 #include <chrono>
 #include <thread>
 #include <arpa/inet.h>
+#include <eeros/sockets/Frame.hpp>	/* header only, wire format of the socket data blocks */
+
+using namespace eeros::sockets;
 
 
 int main(int argc, char **argv) {
@@ -38,9 +41,8 @@ int main(int argc, char **argv) {
 		auto next_cycle = std::chrono::steady_clock::now() + seconds(period);
 		bool connected = true;
 		
-		double readBuf[4];
-		double writeBuf[6]; 
-		int n;
+		FrameBuffer<std::array<double, 6>> tx;	// matches Matrix<6,1,double> on the server
+		FrameBuffer<std::array<double, 4>> rx;	// matches Vector4 on the server
 		
 		double dataToSend = 0.1;
 
@@ -49,25 +51,29 @@ int main(int argc, char **argv) {
 			
 			// write
 			std::cout << "w: ";
-			for (uint32_t i = 0; i < sizeof(writeBuf)/sizeof(writeBuf[0]); i++) {
+			std::array<double, 6>& writeBuf = tx.data();
+			for (uint32_t i = 0; i < writeBuf.size(); i++) {
 				writeBuf[i] = dataToSend;
 				dataToSend += 0.1;
 				std::cout << writeBuf[i] << "\t";
 			}
 			std::cout << std::endl;
-			n = write(sockfd, writeBuf, sizeof(writeBuf));
-			if (n < 0) {
+			tx.publish(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+			if (!tx.send(sockfd)) {
 				std::cout << "ERROR writing to socket" << std::endl;
 				connected = false;
 			}
 			
 			// read
-			n = read(sockfd, readBuf, sizeof(readBuf));
-			if (n < 0) std::cout << "ERROR reading from socket" << std::endl;
+			if (!rx.receive(sockfd, 1.0)) {
+				std::cout << "ERROR reading from socket" << std::endl;
+				connected = false;
+			}
 			
-			std::cout << "rec: ";
-			for (uint32_t i = 0; i < sizeof(readBuf)/sizeof(readBuf[0]); i++) {
-				std::cout << readBuf[i] << "\t";
+			const Frame<std::array<double, 4>>& frame = rx.latest();
+			std::cout << "rec #" << frame.header.sequence << " (lost " << rx.lost << "): ";
+			for (uint32_t i = 0; i < frame.data.size(); i++) {
+				std::cout << frame.data[i] << "\t";
 			}
 			std::cout << std::endl;
 			next_cycle += seconds(period);
@@ -1,9 +1,11 @@
 #ifndef ORG_EEROS_CORE_CONFIG_HPP_
 #define ORG_EEROS_CORE_CONFIG_HPP_
 
+#include <eeros/config/TableFile.hpp>
 #include <cmath>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -67,6 +69,14 @@ protected:
                    double *start, double *end, double defaultValue = NAN);
   virtual void add(std::string name, std::string &value);
 
+  /**
+   * Adds a table, see \ref TableFile. The configuration holds the name of the
+   * table file, the table itself is mapped from that file when loading.
+   * @param name Name of the property.
+   * @param table Table, empty if the property holds no file name.
+   */
+  virtual void add(std::string name, std::shared_ptr<TableFile> &table);
+
   template <typename T, std::size_t N>
   void add(std::string name, std::array<T, N> &value);
 
@@ -0,0 +1,154 @@
+#ifndef ORG_EEROS_CONFIG_TABLEFILE_HPP_
+#define ORG_EEROS_CONFIG_TABLEFILE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eeros {
+namespace config {
+
+/**
+ * A table file holds calibration data, the samples of a function on an equidistant grid
+ * of one, two or three dimensions, e.g. for encoder linearization or thermal compensation.
+ * The grid of each dimension is given by the number of samples and the coordinates of the
+ * first and the last sample. The samples are stored in row major order, the last dimension
+ * varies fastest.
+ *
+ * The binary format starts with a header holding a magic number, a version, the grid
+ * and a checksum of the samples, followed by the samples as written by \ref save().
+ * Table files are mapped into memory instead of being read, so tables with millions of
+ * samples are loaded without parsing.
+ *
+ * A table file is immutable once constructed. Tables are added to a \ref Config by the
+ * name of their file.
+ *
+ * @since v1.4
+ */
+class TableFile {
+ public:
+  /**
+   * Maximum number of dimensions.
+   */
+  static constexpr std::size_t maxDims = 3;
+
+  /**
+   * Version of the binary format written by \ref save().
+   */
+  static constexpr uint32_t version = 1;
+
+  /**
+   * Maps a table from a file.
+   * Throws a Fault if the file cannot be opened or is corrupt.
+   *
+   * @param filename - name of the table file
+   */
+  explicit TableFile(const std::string& filename);
+
+  /**
+   * Constructs a table from samples held in memory.
+   * Throws a Fault if the number of samples does not match the grid.
+   *
+   * @param size - number of samples of each dimension, at least 2
+   * @param min - coordinate of the first sample of each dimension
+   * @param max - coordinate of the last sample of each dimension
+   * @param samples - samples in row major order
+   */
+  TableFile(std::vector<std::size_t> size, std::vector<double> min, std::vector<double> max, std::vector<double> samples);
+
+  TableFile(const TableFile&) = delete;
+  TableFile& operator=(const TableFile&) = delete;
+
+  /**
+   * Unmaps the file.
+   */
+  ~TableFile();
+
+  /**
+   * Writes the table in binary format.
+   * Throws a Fault if the file cannot be written.
+   *
+   * @param filename - name of the table file
+   */
+  void save(const std::string& filename);
+
+  /**
+   * Returns the name of the file the table was loaded from or last saved to.
+   *
+   * @return file name, empty if the table was never saved
+   */
+  const std::string& getFilename() const { return filename; }
+
+  /**
+   * Returns the number of dimensions.
+   *
+   * @return number of dimensions
+   */
+  std::size_t getDims() const { return dims; }
+
+  /**
+   * Returns the number of samples of a dimension.
+   *
+   * @param d - dimension
+   * @return number of samples
+   */
+  std::size_t getSize(std::size_t d) const { return size[d]; }
+
+  /**
+   * Returns the coordinate of the first sample of a dimension.
+   *
+   * @param d - dimension
+   * @return coordinate
+   */
+  double getMin(std::size_t d) const { return min[d]; }
+
+  /**
+   * Returns the coordinate of the last sample of a dimension.
+   *
+   * @param d - dimension
+   * @return coordinate
+   */
+  double getMax(std::size_t d) const { return max[d]; }
+
+  /**
+   * Returns the total number of samples.
+   *
+   * @return number of samples
+   */
+  std::size_t count() const { return total; }
+
+  /**
+   * Returns the samples in row major order.
+   *
+   * @return samples
+   */
+  const double* data() const { return samples; }
+
+  /**
+   * Returns true if the table was mapped from a file.
+   *
+   * @return file is mapped
+   */
+  bool isMapped() const { return map != nullptr; }
+
+ private:
+  void setGrid(const uint64_t* size, const double* min, const double* max, std::size_t dims);
+
+  std::string filename;
+  std::size_t dims;
+  std::array<std::size_t, maxDims> size;
+  std::array<double, maxDims> min;
+  std::array<double, maxDims> max;
+  std::size_t total;
+  std::vector<double> storage;
+  const double* samples;
+  void* map;
+  std::size_t mapSize;
+};
+
+}
+}
+
+#endif // ORG_EEROS_CONFIG_TABLEFILE_HPP_
@@ -0,0 +1,140 @@
+#ifndef ORG_EEROS_CONTROL_ARENA_HPP_
+#define ORG_EEROS_CONTROL_ARENA_HPP_
+
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eeros {
+namespace control {
+
+/**
+ * An arena holds the blocks of a control system in one contiguous, page locked
+ * memory region. The blocks are constructed one after another in the order they
+ * are created. Their inputs, outputs and signals are part of the blocks, so the
+ * data read and written by a cycle lies in the arena in the order it is accessed.
+ * Created with a timedomain, the arena adds every block to it, so the schedule
+ * order is the memory order. This results in fewer cache and TLB misses for
+ * timedomains with many blocks.
+ *
+ * Names and other data only needed for configuration and fault reports are kept
+ * apart from the blocks, see \ref Block. Memory allocated by a block on its own,
+ * e.g. the buffer of a \ref Delay, stays on the heap.
+ *
+ * The blocks live as long as the arena and are destroyed in reverse order of creation.
+ * An arena created with a timedomain removes each block from it before destroying it,
+ * so the timedomain must outlive the arena and must not run while the arena is destroyed.
+ *
+ * Usage:
+ * Arena arena(td, 65536);
+ * auto& c = arena.create<Constant<>>(1.0);
+ * auto& g = arena.create<Gain<>>(2.0);
+ * g.getIn().connect(c.getOut());
+ *
+ * @since v1.4
+ */
+class Arena {
+ public:
+  /**
+   * Creates an arena. The size is rounded up to full pages.
+   * Throws a Fault if the memory cannot be mapped.
+   *
+   * @param size - size in bytes
+   */
+  explicit Arena(std::size_t size);
+
+  /**
+   * Creates an arena which adds the created blocks to a timedomain.
+   *
+   * @param td - timedomain running the blocks in the order of creation
+   * @param size - size in bytes
+   */
+  Arena(TimeDomain& td, std::size_t size);
+
+  /**
+   * Removes the blocks from the timedomain, destroys them and releases the memory.
+   */
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /**
+   * Constructs a block in the arena.
+   * Throws a Fault if the arena is full.
+   *
+   * @tparam B - type of the block
+   * @param args - arguments of the constructor of the block
+   * @return block
+   */
+  template < typename B, typename ... Args >
+  B& create(Args&& ... args) {
+    void* p = allocate(sizeof(B), alignof(B));
+    B* b;
+    try {
+      b = new (p) B(std::forward<Args>(args)...);
+    } catch (...) {
+      used = static_cast<char*>(p) - region;
+      throw;
+    }
+    objects.push_back(Object{b, b, [](void* o) { static_cast<B*>(o)->~B(); }});
+    if (td != nullptr) td->addBlock(*b);
+    return *b;
+  }
+
+  /**
+   * Returns true if the memory is locked in RAM.
+   * Locking needs the permission to lock memory, e.g. CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK.
+   *
+   * @return true if locked
+   */
+  bool isLocked() const;
+
+  /**
+   * Returns the size of the arena.
+   *
+   * @return size in bytes
+   */
+  std::size_t getSize() const;
+
+  /**
+   * Returns the memory used by the blocks.
+   *
+   * @return size in bytes
+   */
+  std::size_t getUsed() const;
+
+  /**
+   * Returns true if an object lies in the arena.
+   *
+   * @param object - address of the object
+   * @return true if in the arena
+   */
+  bool contains(const void* object) const;
+
+ private:
+  struct Object {
+    void* object;
+    Runnable* block;
+    void (*destroy)(void*);
+  };
+  Arena(TimeDomain* td, std::size_t size);
+  void* allocate(std::size_t size, std::size_t align);
+  TimeDomain* td;
+  char* region;
+  std::size_t size;
+  std::size_t used;
+  bool locked;
+  std::vector<Object> objects;
+  logger::Logger log;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_ARENA_HPP_ */
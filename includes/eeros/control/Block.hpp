@@ -1,20 +1,92 @@
 #ifndef ORG_EEROS_CONTROL_BLOCK_HPP_
 #define ORG_EEROS_CONTROL_BLOCK_HPP_
 
+#include <memory>
 #include <string>
+#include <vector>
 #include <eeros/core/Runnable.hpp>
 
 namespace eeros {
 namespace control {
 
+class Block;
+
+/**
+ * Type independent view of an input. A time domain uses it to find out
+ * which blocks are connected to each other.
+ * 
+ * @since v1.4
+ */
+
+class InputBase {
+ public:
+  virtual ~InputBase() { }
+
+  /**
+   * Queries the connection state of this input.
+   * 
+   * @return true, if connection exists to output of another block 
+   */
+  virtual bool isConnected() const = 0;
+
+  /**
+   * Returns the block which produces the signal this input is connected to.
+   * 
+   * @return source block, nullptr if not connected or unknown
+   */
+  virtual Block* getSourceBlock() const = 0;
+
+  /**
+   * Returns the number of connected inputs without owner. The blocks reading
+   * from such inputs are unknown, see \ref TimeDomain::setParallel().
+   * 
+   * @return number of connected inputs without owner
+   */
+  static unsigned int getConnectedWithoutOwner();
+
+  /**
+   * Returns the source blocks of all connected inputs without owner. A time 
+   * domain containing one of these blocks cannot know which blocks read from it.
+   * 
+   * @return source blocks, nullptr for inputs connected to an output without owner
+   */
+  static std::vector<Block*> getSourcesWithoutOwner();
+
+ protected:
+  static void trackWithoutOwner(InputBase* input, bool connected);
+};
+
 /**
  * This is the base class for all blocks used in a control system.
  * 
+ * The name and the registered inputs are only needed to configure the control 
+ * system and to report faults. They are kept apart from the block, so that the 
+ * data read every cycle of blocks created one after another lies close together, 
+ * see \ref Arena.
+ * 
  * @since v0.4
  */
 
 class Block : public Runnable {
  public:
+  Block() { }
+
+  /**
+   * Copies the name of the block. The inputs are not registered at the copy,
+   * copied inputs and outputs keep the original block as owner. A copied block 
+   * has to set itself as owner of its inputs and outputs before it is run by a 
+   * parallel time domain, see \ref Input::setOwner().
+   */
+  Block(const Block& b) {
+    if (b.meta) setName(b.meta->name);
+  }
+
+  Block& operator=(const Block& b) {
+    if (b.meta) setName(b.meta->name);
+    else if (meta) meta->name.clear();
+    return *this;
+  }
+
   /**
    * Sets the name of the block.
    * 
@@ -28,9 +100,29 @@ class Block : public Runnable {
    * @return name
    */
   virtual std::string getName() const;
+
+  /**
+   * Registers an input of this block. Inputs do this on their own
+   * as soon as their owner is set.
+   * 
+   * @param input - input owned by this block
+   */
+  void registerInput(InputBase* input);
+
+  /**
+   * Gets all registered inputs of this block.
+   * 
+   * @return inputs
+   */
+  const std::vector<InputBase*>& getInputs() const;
   
  private:
-  std::string name;
+  struct Metadata {
+    std::string name;
+    std::vector<InputBase*> inputs;
+  };
+  Metadata& metadata();
+  std::unique_ptr<Metadata> meta;
 };
 
 };
@@ -0,0 +1,695 @@
+#ifndef ORG_EEROS_CONTROL_BLOCKARRAY_HPP_
+#define ORG_EEROS_CONTROL_BLOCKARRAY_HPP_
+
+#include <eeros/control/Block.hpp>
+#include <eeros/control/Input.hpp>
+#include <eeros/control/Output.hpp>
+#include <eeros/control/Parameter.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/Saturation.hpp>
+#include <eeros/control/I.hpp>
+#include <eeros/control/D.hpp>
+#include <eeros/control/RateLimiter.hpp>
+#include <eeros/control/IndexOutOfBoundsFault.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+namespace eeros {
+namespace control {
+
+using namespace math;
+
+/**
+ * A block array runs N instances of the same scalar block as one block. Parameters
+ * and states of all instances are stored as arrays, one element per channel, and all
+ * channels are calculated in one loop which the compiler can vectorize. This replaces
+ * many small blocks, e.g. one gain per axis, by a single block with one run call per cycle.
+ *
+ * The block reads a Matrix<N,1,T> from its input and writes a Matrix<N,1,T> to its output.
+ * For compatibility each channel can also be connected on its own with \ref getIn(uint8_t)
+ * and \ref getOut(uint8_t). The channel inputs are read if the vector input is not connected,
+ * the channel outputs are only written if one of them was requested.
+ * Parameters are picked up by the block without locking, see \ref Parameter.
+ *
+ * Available kinds are Gain<T> and Saturation<T> with an arithmetic type T and I<T>, D<T>
+ * and RateLimiter<T> with a floating point type T, e.g. BlockArray<Gain<>, 6> holds six gains.
+ *
+ * @tparam Kind - type of the scalar block
+ * @tparam N - number of channels
+ *
+ * @since v1.4
+ */
+template < typename Kind, uint8_t N >
+class BlockArray;
+
+/**
+ * Inputs and outputs of a block array, see \ref BlockArray.
+ *
+ * @tparam N - number of channels
+ * @tparam T - value type of a channel
+ *
+ * @since v1.4
+ */
+template < uint8_t N, typename T >
+class BlockArrayio : public Block {
+  static_assert(std::is_arithmetic<T>::value, "BlockArray needs an arithmetic value type");
+
+ public:
+  using Values = std::array<T, N>;
+
+  BlockArrayio() : in(this), out(this), channelOut(false) {
+    for (uint8_t i = 0; i < N; i++) {
+      chIn[i].setOwner(this);
+      chOut[i].setOwner(this);
+      chOut[i].getSignal().clear();
+    }
+    out.getSignal().clear();
+  }
+
+  /**
+   * Disabling use of copy constructor because the block should never be copied unintentionally.
+   */
+  BlockArrayio(const BlockArrayio& s) = delete;
+
+  /**
+   * Getter function for the input carrying all channels.
+   *
+   * @return vector input
+   */
+  virtual Input<Matrix<N,1,T>>& getIn() {
+    return in;
+  }
+
+  /**
+   * Getter function for the output carrying all channels.
+   *
+   * @return vector output
+   */
+  virtual Output<Matrix<N,1,T>>& getOut() {
+    return out;
+  }
+
+  /**
+   * Getter function for the input of a single channel.
+   * It is only read if the vector input is not connected.
+   *
+   * @param index - channel
+   * @return channel input
+   */
+  virtual Input<T>& getIn(uint8_t index) {
+    if (index >= N) throw IndexOutOfBoundsFault("Trying to get inexistent channel input in Block " + this->getName() + ".");
+    return chIn[index];
+  }
+
+  /**
+   * Getter function for the output of a single channel.
+   * Requesting a channel output makes the block write all channel outputs.
+   *
+   * @param index - channel
+   * @return channel output
+   */
+  virtual Output<T>& getOut(uint8_t index) {
+    if (index >= N) throw IndexOutOfBoundsFault("Trying to get inexistent channel output in Block " + this->getName() + ".");
+    channelOut = true;
+    return chOut[index];
+  }
+
+ protected:
+  /*
+   * Reads all channels, returns the timestamp of the input.
+   */
+  timestamp_t read(Values& x) {
+    if (in.isConnected()) {
+      auto& sig = in.getSignal();
+      const Matrix<N,1,T>& v = sig.getValue();
+      for (uint8_t i = 0; i < N; i++) x[i] = v[i];
+      return sig.getTimestamp();
+    }
+    for (uint8_t i = 0; i < N; i++) x[i] = chIn[i].getSignal().getValue();
+    return chIn[0].getSignal().getTimestamp();
+  }
+
+  /*
+   * Writes all channels with a common timestamp.
+   */
+  void write(const Values& y, timestamp_t time) {
+    Matrix<N,1,T> v;
+    for (uint8_t i = 0; i < N; i++) v[i] = y[i];
+    out.getSignal().setValue(v);
+    out.getSignal().setTimestamp(time);
+    if (channelOut) {
+      for (uint8_t i = 0; i < N; i++) {
+        chOut[i].getSignal().setValue(y[i]);
+        chOut[i].getSignal().setTimestamp(time);
+      }
+    }
+  }
+
+  static void fill(Values& a, const Matrix<N,1,T>& m) {
+    for (uint8_t i = 0; i < N; i++) a[i] = m[i];
+  }
+
+  static void check(uint8_t index) {
+    if (index >= N) throw IndexOutOfBoundsFault("Trying to access inexistent channel of block array.");
+  }
+
+  Input<Matrix<N,1,T>> in;
+  Output<Matrix<N,1,T>> out;
+  Input<T> chIn[N];
+  Output<T> chOut[N];
+  bool channelOut;
+};
+
+
+/**
+ * N gains, y[i] = gain[i] * x[i]. A disabled channel passes its input.
+ *
+ * @since v1.4
+ */
+template < uint8_t N, typename T, typename Tgain >
+class BlockArray<Gain<T,Tgain,false>, N> : public BlockArrayio<N,T> {
+  static_assert(std::is_arithmetic<Tgain>::value, "BlockArray of gains needs an arithmetic gain type");
+  using Values = typename BlockArrayio<N,T>::Values;
+  using Gains = std::array<Tgain, N>;
+
+ public:
+  /**
+   * Constructs N gains with the same gain.
+   *
+   * @param gain - initial gain of all channels
+   */
+  BlockArray(Tgain gain = 1) {
+    Params p;
+    p.gain.fill(gain);
+    p.enabled.fill(true);
+    update(p);
+    param.set(p);
+  }
+
+  /**
+   * Constructs N gains.
+   *
+   * @param gain - initial gains
+   */
+  BlockArray(const Matrix<N,1,Tgain>& gain) : BlockArray() {
+    setGain(gain);
+  }
+
+  virtual void run() {
+    param.update();
+    const Gains& k = param.value().k;
+    Values x, y;
+    timestamp_t time = this->read(x);
+    for (uint8_t i = 0; i < N; i++) y[i] = k[i] * x[i];
+    this->write(y, time);
+  }
+
+  /**
+   * Sets the gain of one channel.
+   *
+   * @param index - channel
+   * @param gain - gain
+   */
+  virtual void setGain(uint8_t index, Tgain gain) {
+    this->check(index);
+    param.modify([&](Params& p) { p.gain[index] = gain; update(p); });
+  }
+
+  /**
+   * Sets the gains of all channels.
+   *
+   * @param gain - gains
+   */
+  virtual void setGain(const Matrix<N,1,Tgain>& gain) {
+    param.modify([&](Params& p) {
+      for (uint8_t i = 0; i < N; i++) p.gain[i] = gain[i];
+      update(p);
+    });
+  }
+
+  /**
+   * Returns the gain of one channel.
+   *
+   * @param index - channel
+   * @return gain
+   */
+  virtual Tgain getGain(uint8_t index) {
+    this->check(index);
+    return param.get().gain[index];
+  }
+
+  /**
+   * Enables all channels.
+   */
+  virtual void enable() {
+    param.modify([](Params& p) { p.enabled.fill(true); update(p); });
+  }
+
+  /**
+   * Disables all channels, the inputs are passed unchanged.
+   */
+  virtual void disable() {
+    param.modify([](Params& p) { p.enabled.fill(false); update(p); });
+  }
+
+  /**
+   * Enables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void enable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = true; update(p); });
+  }
+
+  /**
+   * Disables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void disable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = false; update(p); });
+  }
+
+ private:
+  struct Params {
+    Gains gain;
+    std::array<bool, N> enabled;
+    Gains k;   // gain applied by run(), 1 for disabled channels
+  };
+
+  static void update(Params& p) {
+    for (uint8_t i = 0; i < N; i++) p.k[i] = p.enabled[i] ? p.gain[i] : 1;
+  }
+
+  Parameter<Params> param;
+};
+
+
+/**
+ * N saturations, y[i] is x[i] limited to [lower[i], upper[i]]. A disabled channel passes its input.
+ *
+ * @since v1.4
+ */
+template < uint8_t N, typename T >
+class BlockArray<Saturation<T>, N> : public BlockArrayio<N,T> {
+  using Values = typename BlockArrayio<N,T>::Values;
+
+ public:
+  /**
+   * Constructs N saturations with the same limits.
+   *
+   * @param lower - lower limit of all channels
+   * @param upper - upper limit of all channels
+   */
+  BlockArray(T lower, T upper) {
+    Params p;
+    p.lower.fill(lower);
+    p.upper.fill(upper);
+    p.enabled.fill(true);
+    update(p);
+    param.set(p);
+  }
+
+  /**
+   * Constructs N saturations.
+   *
+   * @param lower - lower limits
+   * @param upper - upper limits
+   */
+  BlockArray(const Matrix<N,1,T>& lower, const Matrix<N,1,T>& upper) : BlockArray(0, 0) {
+    setLimit(lower, upper);
+  }
+
+  virtual void run() {
+    param.update();
+    const Params& p = param.value();
+    Values x, y;
+    timestamp_t time = this->read(x);
+    for (uint8_t i = 0; i < N; i++) y[i] = std::min(std::max(x[i], p.lo[i]), p.hi[i]);
+    this->write(y, time);
+  }
+
+  /**
+   * Sets the limits of one channel.
+   *
+   * @param index - channel
+   * @param lower - lower limit
+   * @param upper - upper limit
+   */
+  virtual void setLimit(uint8_t index, T lower, T upper) {
+    this->check(index);
+    param.modify([&](Params& p) { p.lower[index] = lower; p.upper[index] = upper; update(p); });
+  }
+
+  /**
+   * Sets the limits of all channels.
+   *
+   * @param lower - lower limits
+   * @param upper - upper limits
+   */
+  virtual void setLimit(const Matrix<N,1,T>& lower, const Matrix<N,1,T>& upper) {
+    param.modify([&](Params& p) { this->fill(p.lower, lower); this->fill(p.upper, upper); update(p); });
+  }
+
+  /**
+   * Enables all channels.
+   */
+  virtual void enable() {
+    param.modify([](Params& p) { p.enabled.fill(true); update(p); });
+  }
+
+  /**
+   * Disables all channels, the inputs are passed unchanged.
+   */
+  virtual void disable() {
+    param.modify([](Params& p) { p.enabled.fill(false); update(p); });
+  }
+
+  /**
+   * Enables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void enable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = true; update(p); });
+  }
+
+  /**
+   * Disables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void disable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = false; update(p); });
+  }
+
+ private:
+  struct Params {
+    Values lower, upper;
+    std::array<bool, N> enabled;
+    Values lo, hi;   // limits applied by run(), widest range for disabled channels
+  };
+
+  static void update(Params& p) {
+    for (uint8_t i = 0; i < N; i++) {
+      p.lo[i] = p.enabled[i] ? p.lower[i] : std::numeric_limits<T>::lowest();
+      p.hi[i] = p.enabled[i] ? p.upper[i] : std::numeric_limits<T>::max();
+    }
+  }
+
+  Parameter<Params> param;
+};
+
+
+/**
+ * N integrators with limits. The state of a channel is kept if it would leave its limits
+ * or if the channel is disabled. All channels are disabled after construction.
+ *
+ * @since v1.4
+ */
+template < uint8_t N, typename T >
+class BlockArray<I<T>, N> : public BlockArrayio<N,T> {
+  static_assert(std::is_floating_point<T>::value, "BlockArray of integrators needs a floating point type");
+  using Values = typename BlockArrayio<N,T>::Values;
+
+ public:
+  BlockArray() : first(true), prevTime(0) {
+    state.fill(0);
+    initCount.fill(0);
+    Params p;
+    p.upper.fill(std::numeric_limits<T>::max());
+    p.lower.fill(std::numeric_limits<T>::lowest());
+    p.enabled.fill(false);
+    p.init.fill(0);
+    p.initCount.fill(0);
+    param.set(p);
+  }
+
+  virtual void run() {
+    bool changed = param.update();
+    const Params& p = param.value();
+    if (changed) {
+      for (uint8_t i = 0; i < N; i++) {
+        if (p.initCount[i] != initCount[i]) {
+          state[i] = p.init[i];
+          initCount[i] = p.initCount[i];
+        }
+      }
+    }
+    Values x;
+    timestamp_t time = this->read(x);
+    T dt = first ? 0 : (time - prevTime) / 1000000000.0;
+    first = false;
+    prevTime = time;
+    for (uint8_t i = 0; i < N; i++) {
+      T v = state[i] + x[i] * dt;
+      state[i] = (p.enabled[i] && v < p.upper[i] && v > p.lower[i]) ? v : state[i];
+    }
+    this->write(state, time);
+  }
+
+  /**
+   * Sets the state of one channel.
+   *
+   * @param index - channel
+   * @param val - initial state
+   */
+  virtual void setInitCondition(uint8_t index, T val) {
+    this->check(index);
+    param.modify([&](Params& p) {
+      p.init[index] = val;
+      p.initCount[index]++;
+    });
+  }
+
+  /**
+   * Sets the states of all channels.
+   *
+   * @param val - initial states
+   */
+  virtual void setInitCondition(const Matrix<N,1,T>& val) {
+    param.modify([&](Params& p) {
+      this->fill(p.init, val);
+      for (auto& c : p.initCount) c++;
+    });
+  }
+
+  /**
+   * Sets the limits of one channel.
+   *
+   * @param index - channel
+   * @param upper - upper limit
+   * @param lower - lower limit
+   */
+  virtual void setLimit(uint8_t index, T upper, T lower) {
+    this->check(index);
+    param.modify([&](Params& p) { p.upper[index] = upper; p.lower[index] = lower; });
+  }
+
+  /**
+   * Enables all channels.
+   */
+  virtual void enable() {
+    param.modify([](Params& p) { p.enabled.fill(true); });
+  }
+
+  /**
+   * Disables all channels, their states are kept.
+   */
+  virtual void disable() {
+    param.modify([](Params& p) { p.enabled.fill(false); });
+  }
+
+  /**
+   * Enables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void enable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = true; });
+  }
+
+  /**
+   * Disables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void disable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = false; });
+  }
+
+ private:
+  struct Params {
+    Values upper, lower;
+    std::array<bool, N> enabled;
+    Values init;                            // initial states, applied by run()
+    std::array<unsigned int, N> initCount;  // incremented with each new initial state
+  };
+
+  bool first;
+  std::array<unsigned int, N> initCount;
+  timestamp_t prevTime;
+  Values state;
+  Parameter<Params> param;
+};
+
+
+/**
+ * N differentiators. The output timestamp lies between the last two input timestamps.
+ *
+ * @since v1.4
+ */
+template < uint8_t N, typename T >
+class BlockArray<D<T>, N> : public BlockArrayio<N,T> {
+  static_assert(std::is_floating_point<T>::value, "BlockArray of differentiators needs a floating point type");
+  using Values = typename BlockArrayio<N,T>::Values;
+
+ public:
+  BlockArray() : first(true), prevTime(0), outTime(0) {
+    prev.fill(0);
+    y.fill(0);
+  }
+
+  virtual void run() {
+    Values x;
+    timestamp_t time = this->read(x);
+    if (first) {
+      outTime = time;
+      first = false;
+    } else if (time != prevTime) {
+      T dt = (time - prevTime) / 1000000000.0;
+      for (uint8_t i = 0; i < N; i++) y[i] = (x[i] - prev[i]) / dt;
+      outTime = (time + prevTime) / 2;
+    }
+    prev = x;
+    prevTime = time;
+    this->write(y, outTime);
+  }
+
+ private:
+  bool first;
+  timestamp_t prevTime, outTime;
+  Values prev, y;
+};
+
+
+/**
+ * N rate limiters. The change of a channel per second is limited to [falling[i], rising[i]].
+ * All channels are disabled after construction.
+ *
+ * @since v1.4
+ */
+template < uint8_t N, typename T >
+class BlockArray<RateLimiter<T,T>, N> : public BlockArrayio<N,T> {
+  static_assert(std::is_floating_point<T>::value, "BlockArray of rate limiters needs a floating point type");
+  using Values = typename BlockArrayio<N,T>::Values;
+
+ public:
+  /**
+   * Constructs N rate limiters with the same rates.
+   *
+   * @param falling - falling rate of all channels, negative
+   * @param rising - rising rate of all channels, positive
+   */
+  BlockArray(T falling, T rising) : prevTime(0) {
+    prev.fill(0);
+    Params p;
+    p.falling.fill(falling);
+    p.rising.fill(rising);
+    p.enabled.fill(false);
+    param.set(p);
+  }
+
+  virtual void run() {
+    param.update();
+    const Params& p = param.value();
+    Values x, y;
+    timestamp_t time = this->read(x);
+    T dt = (time - prevTime) / 1000000000.0;
+    for (uint8_t i = 0; i < N; i++) {
+      T d = std::min(std::max(x[i] - prev[i], p.falling[i] * dt), p.rising[i] * dt);
+      y[i] = p.enabled[i] ? prev[i] + d : x[i];
+    }
+    prev = y;
+    prevTime = time;
+    this->write(y, time);
+  }
+
+  /**
+   * Sets the rates of one channel.
+   *
+   * @param index - channel
+   * @param falling - falling rate, negative
+   * @param rising - rising rate, positive
+   */
+  virtual void setRate(uint8_t index, T falling, T rising) {
+    this->check(index);
+    param.modify([&](Params& p) { p.falling[index] = falling; p.rising[index] = rising; });
+  }
+
+  /**
+   * Enables all channels.
+   */
+  virtual void enable() {
+    param.modify([](Params& p) { p.enabled.fill(true); });
+  }
+
+  /**
+   * Disables all channels, the inputs are passed unchanged.
+   */
+  virtual void disable() {
+    param.modify([](Params& p) { p.enabled.fill(false); });
+  }
+
+  /**
+   * Enables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void enable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = true; });
+  }
+
+  /**
+   * Disables one channel.
+   *
+   * @param index - channel
+   */
+  virtual void disable(uint8_t index) {
+    this->check(index);
+    param.modify([index](Params& p) { p.enabled[index] = false; });
+  }
+
+ private:
+  struct Params {
+    Values falling, rising;
+    std::array<bool, N> enabled;
+  };
+
+  timestamp_t prevTime;
+  Values prev;
+  Parameter<Params> param;
+};
+
+
+/********** Print functions **********/
+template < typename Kind, uint8_t N >
+std::ostream& operator<<(std::ostream& os, BlockArray<Kind,N>& b) {
+  os << "Block array: '" << b.getName() << "' with " << static_cast<int>(N) << " channels";
+  return os;
+}
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_BLOCKARRAY_HPP_ */
@@ -2,8 +2,8 @@
 #define ORG_EEROS_CONTROL_CONSTANT_HPP_
 
 #include <type_traits>
-#include <mutex>
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/core/System.hpp>
 
 namespace eeros {
@@ -12,6 +12,7 @@ namespace control {
 /**
  * A constant block is used to deliver a constant output signal. Typically its value
  * is set once upon initialization and later altered by the safety system or the sequencer.
+ * A new value is picked up by the block without locking, see \ref Parameter.
  *
  * @tparam T - value type (double - default type)
  *
@@ -27,9 +28,7 @@ class Constant : public Blockio<0,1,T> {
    *
    * @see Constant(T v)
    */
-  Constant() {
-    _clear<T>();
-  }
+  Constant() : value(cleared<T>()) { }
   
   /**
    * Constructs a constant instance with a initial value of v.
@@ -47,9 +46,9 @@ class Constant : public Blockio<0,1,T> {
    * Runs the switch block.
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->out.getSignal().setValue(value);
-    this->out.getSignal().setTimestamp(System::getTimeNs());
+    value.update();
+    this->out.getSignal().setValue(value.value());
+    this->out.getSignal().setTimestamp(System::getCycleTimeNs());
   }
   
   /**
@@ -58,8 +57,7 @@ class Constant : public Blockio<0,1,T> {
    * @param newValue - new value
    */
   virtual void setValue(T newValue) {
-    std::lock_guard<std::mutex> lock(mtx);
-    value = newValue;
+    value.set(newValue);
   }
 
   /**
@@ -68,25 +66,28 @@ class Constant : public Blockio<0,1,T> {
    * @return - current value
    */
   virtual T getValue () const {
-    return value;
+    return value.get();
   }
 
 protected:
-  T value;
-  std::mutex mtx;
+  Parameter<T> value;
   
 private:
-  template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear() {
-    value = std::numeric_limits<int32_t>::min();
+  template <typename S> static typename std::enable_if<std::is_integral<S>::value, S>::type cleared() {
+    return std::numeric_limits<int32_t>::min();
   }
-  template <typename S> typename std::enable_if<std::is_floating_point<S>::value>::type _clear() {
-    value = std::numeric_limits<double>::quiet_NaN();
+  template <typename S> static typename std::enable_if<std::is_floating_point<S>::value, S>::type cleared() {
+    return std::numeric_limits<double>::quiet_NaN();
   }
-  template <typename S> typename std::enable_if<std::is_compound<S>::value && std::is_integral<typename S::value_type>::value>::type _clear() {
-    value.fill(std::numeric_limits<int32_t>::min());
+  template <typename S> static typename std::enable_if<std::is_compound<S>::value && std::is_integral<typename S::value_type>::value, S>::type cleared() {
+    S v;
+    v.fill(std::numeric_limits<int32_t>::min());
+    return v;
   }
-  template <typename S> typename std::enable_if<std::is_compound<S>::value && std::is_floating_point<typename S::value_type>::value>::type _clear() {
-    value.fill(std::numeric_limits<double>::quiet_NaN());
+  template <typename S> static typename std::enable_if<std::is_compound<S>::value && std::is_floating_point<typename S::value_type>::value, S>::type cleared() {
+    S v;
+    v.fill(std::numeric_limits<double>::quiet_NaN());
+    return v;
   }
 };
 
@@ -35,7 +35,7 @@ class D: public Blockio<1,1,T> {
    * its memory. Therefore, the output will be set to zero.
    */
   virtual void run() {
-    Signal<T> sig = this->in.getSignal(); 
+    const Signal<T>& sig = this->in.getSignal();
     double tin = sig.getTimestamp() / 1000000000.0;
     double tprev = prev.getTimestamp() / 1000000000.0;
     T valin = sig.getValue();
@@ -0,0 +1,91 @@
+#ifndef ORG_EEROS_CONTROL_FAULTSTATUS_HPP_
+#define ORG_EEROS_CONTROL_FAULTSTATUS_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace eeros {
+namespace control {
+
+class Block;
+
+/**
+ * Faults a block can report to the time domain running it.
+ * Each fault is one bit of the fault word of a \ref FaultStatus.
+ */
+enum class FaultCode : uint32_t {
+  notConnected = 1 << 0,  // read from an unconnected input
+  nanOutput = 1 << 1,     // NaN or inf written to a peripheral output
+  framesDropped = 1 << 2, // frames dropped because the send queue of a bus was full
+};
+
+/**
+ * A fault status collects the faults of the blocks of a time domain during one cycle.
+ * Instead of throwing an exception, a block raises a fault code and continues. The time
+ * domain checks the fault word once at the end of the cycle and fires its safety event.
+ * Raising a fault sets a bit and never allocates, the message is formatted only when the
+ * time domain reports it.
+ *
+ * A fault status is made current for a thread with a \ref Scope. If a block runs without a
+ * current fault status, e.g. when called directly, \ref raise() returns false and the block
+ * throws the corresponding fault as before.
+ *
+ * @since v1.4
+ */
+class FaultStatus {
+ public:
+  /**
+   * Makes a fault status current for the calling thread while the scope exists.
+   */
+  class Scope {
+   public:
+    Scope(FaultStatus& status);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+   private:
+    FaultStatus* previous;
+  };
+
+  FaultStatus();
+
+  /**
+   * Raises a fault in the fault status current for the calling thread.
+   * Can be called by several threads at the same time.
+   *
+   * @param code - fault code
+   * @param block - block raising the fault, used for the message
+   * @return false, if no fault status is current and the fault must be thrown
+   */
+  static bool raise(FaultCode code, const Block* block);
+
+  /**
+   * Returns the fault word, one bit for each fault code raised since the last clear.
+   *
+   * @return fault word, 0 if no fault was raised
+   */
+  uint32_t get() const;
+
+  /**
+   * Returns the message of the first fault raised since the last clear.
+   *
+   * @return message
+   */
+  std::string getMessage() const;
+
+  /**
+   * Clears all faults.
+   */
+  void clear();
+
+ private:
+  std::atomic<uint32_t> word;
+  std::atomic<uint32_t> firstCode;
+  std::atomic<const Block*> firstBlock;
+};
+
+}
+}
+
+#endif // ORG_EEROS_CONTROL_FAULTSTATUS_HPP_
@@ -2,9 +2,9 @@
 #define ORG_EEROS_CONTROL_GAIN_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <type_traits>
 #include <memory>
-#include <mutex>
 #include <math.h>
 
 
@@ -24,9 +24,9 @@ namespace control {
  * The non-type template argument specifies if the multiplication will be done
  * element wise in case the gain is used with matrices.
  *
- * A gain block is suitable for use with multiple threads. However,
- * enabling/disabling of the gain and the smooth change feature
- * is not synchronized.
+ * A gain block is suitable for use with multiple threads. All settings are
+ * published as one parameter set which the block picks up without locking,
+ * see \ref Parameter.
  *
  * @tparam Tout - output type (double - default type)
  * @tparam Tgain - gain type (double - default type)
@@ -56,7 +56,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param c - initial gain value
    */
   Gain(Tgain c) : Gain(c, 1.0, -1.0) { // 1.0 and -1.0 are temp values only.
-    resetMinMaxGain<Tgain>(); // set limits to smallest/largest value.
+    param.modify([this](Params& p) { resetMinMaxGain<Tgain>(p); }); // set limits to smallest/largest value.
   }
 
 
@@ -70,12 +70,15 @@ class Gain : public Blockio<1,1,Tout> {
    * @param maxGain - initial maximum gain value
    * @param minGain - initial minimum gain value
    */
-  Gain(Tgain c, Tgain maxGain, Tgain minGain) {
-    gain = c;
-    this->maxGain = maxGain;
-    this->minGain = minGain;
-    targetGain = gain;
-    gainDiff = 0;
+  Gain(Tgain c, Tgain maxGain, Tgain minGain) : gain(c), gainCount(0) {
+    Params p;
+    p.gain = c;
+    p.gainCount = 0;
+    p.maxGain = maxGain;
+    p.minGain = minGain;
+    p.targetGain = c;
+    p.gainDiff = 0;
+    param.set(p);
   }
 
   
@@ -105,34 +108,38 @@ class Gain : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lock(mtx);
+    if (param.update() && param.value().gainCount != gainCount) {
+      gain = param.value().gain;
+      gainCount = param.value().gainCount;
+    }
+    const Params& p = param.value();
 
-    if (smoothChange) {
-      if (gain < targetGain) {
-        gain += gainDiff;
-        if (gain > targetGain) { // overshoot case.
-          gain = targetGain;
+    if (p.smoothChange) {
+      if (gain < p.targetGain) {
+        gain += p.gainDiff;
+        if (gain > p.targetGain) { // overshoot case.
+          gain = p.targetGain;
         }
       }
 
-      if (gain > targetGain) {
-        gain -= gainDiff;
-        if (gain < targetGain) {
-          gain = targetGain;
+      if (gain > p.targetGain) {
+        gain -= p.gainDiff;
+        if (gain < p.targetGain) {
+          gain = p.targetGain;
         }
       }
     }
 
-    if (gain > maxGain) { // if diff will cause gain to be too large.
-      gain = maxGain;
+    if (gain > p.maxGain) { // if diff will cause gain to be too large.
+      gain = p.maxGain;
     }
 
-    if (gain < minGain) {
-      gain = minGain;
+    if (gain < p.minGain) {
+      gain = p.minGain;
     }
 
-    if (enabled) {
-      if (parabolic) this->out.getSignal().setValue(calculateParabolic<Tout,Tgain>(this->in.getSignal().getValue()));
+    if (p.enabled) {
+      if (p.parabolic) this->out.getSignal().setValue(calculateParabolic<Tout,Tgain>(this->in.getSignal().getValue(), p.parabolicSwitchPoint));
       else this->out.getSignal().setValue(calculate<Tout>(this->in.getSignal().getValue()));
     } else {
       this->out.getSignal().setValue(this->in.getSignal().getValue());
@@ -153,7 +160,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see enableSmoothChange(bool)
    */
   virtual void enable() {
-    enabled = true;
+    param.modify([&](Params& p) { p.enabled = true; });
   }
 
 
@@ -168,7 +175,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see enableSmoothChange(bool)
    */
   virtual void disable() {
-    enabled = false;
+    param.modify([&](Params& p) { p.enabled = false; });
   }
 
 
@@ -186,7 +193,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void enableSmoothChange(bool enable) {
-    smoothChange = enable;
+    param.modify([&](Params& p) { p.smoothChange = enable; });
   }
   
   
@@ -203,7 +210,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see setParabolicGainParams()
    */
   virtual void enableParabolicGain(bool enable) {
-    parabolic = enable;
+    param.modify([&](Params& p) { p.parabolic = enable; });
   }
 
   
@@ -217,15 +224,16 @@ class Gain : public Blockio<1,1,Tout> {
    * @param c - gain value
    */
   virtual void setGain(Tgain c) {
-    std::lock_guard<std::mutex> lock(mtx);
-
-    if (c <= maxGain && c >= minGain) {
-      if (smoothChange) {
-        targetGain = c;
-      } else {
-        gain = c;
+    param.modify([&](Params& p) {
+      if (c <= p.maxGain && c >= p.minGain) {
+        if (p.smoothChange) {
+          p.targetGain = c;
+        } else {
+          p.gain = c;
+          p.gainCount++;
+        }
       }
-    }
+    });
   }
 
 
@@ -235,8 +243,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param maxGain - maximum allowed gain value
    */
   virtual void setMaxGain(Tgain maxGain) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->maxGain = maxGain;
+    param.modify([&](Params& p) { p.maxGain = maxGain; });
   }
 
 
@@ -246,8 +253,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param minGain - minimum allowed gain value
    */
   virtual void setMinGain(Tgain minGain) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->minGain = minGain;
+    param.modify([&](Params& p) { p.minGain = minGain; });
   }
 
   /**
@@ -256,8 +262,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param gainDiff - gain differential
    */
   virtual void setGainDiff(Tgain gainDiff) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->gainDiff = gainDiff;
+    param.modify([&](Params& p) { p.gainDiff = gainDiff; });
   }
 
   /**
@@ -266,8 +271,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param parabolicSwitchPoint - input limit
    */
   virtual void setParabolicGainParams(Tout parabolicSwitchPoint) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->parabolicSwitchPoint = parabolicSwitchPoint;
+    param.modify([&](Params& p) { p.parabolicSwitchPoint = parabolicSwitchPoint; });
   }
 
   /*
@@ -278,16 +282,22 @@ class Gain : public Blockio<1,1,Tout> {
   friend std::ostream &operator<<(std::ostream &os, Gain<Xout, Xgain> &gain);
 
  protected:
+  struct Params {
+    Tgain gain;               // gain set while smooth change is disabled
+    unsigned int gainCount;   // incremented with each such change
+    Tgain maxGain;
+    Tgain minGain;
+    Tgain targetGain;
+    Tgain gainDiff;
+    bool enabled{true};
+    bool smoothChange{false};
+    bool parabolic{false};
+    Tout parabolicSwitchPoint;
+  };
+
   Tgain gain;
-  Tgain maxGain;
-  Tgain minGain;
-  Tgain targetGain;
-  Tgain gainDiff;
-  bool enabled{true};
-  bool smoothChange{false};
-  bool parabolic{false};
-  Tout parabolicSwitchPoint;
-  std::mutex mtx;
+  unsigned int gainCount;
+  Parameter<Params> param;
 
  private:
   template<typename S>
@@ -302,7 +312,7 @@ class Gain : public Blockio<1,1,Tout> {
   }
   
   template<typename R, typename S>  // Tout, Tgain
-  typename std::enable_if<std::is_arithmetic<R>::value, R>::type calculateParabolic(R value) {
+  typename std::enable_if<std::is_arithmetic<R>::value, R>::type calculateParabolic(R value, const Tout& parabolicSwitchPoint) {
     Tout outVal;
     if (fabs(value) > parabolicSwitchPoint) {
       if (value >= 0) outVal = gain * sqrt(parabolicSwitchPoint * (2 * value - parabolicSwitchPoint));
@@ -314,7 +324,7 @@ class Gain : public Blockio<1,1,Tout> {
   }
   
   template<typename R, typename S>
-  typename std::enable_if<std::is_compound<R>::value && std::is_arithmetic<S>::value, R>::type calculateParabolic(R value) {
+  typename std::enable_if<std::is_compound<R>::value && std::is_arithmetic<S>::value, R>::type calculateParabolic(R value, const Tout& parabolicSwitchPoint) {
     Tout outVal;
     for (unsigned int i = 0; i < value.size(); i++) {
       if (fabs(value[i]) > parabolicSwitchPoint[i]) {
@@ -328,13 +338,13 @@ class Gain : public Blockio<1,1,Tout> {
   }
 
   template<typename R, typename S>
-  typename std::enable_if<std::is_compound<R>::value && std::is_compound<S>::value && !elementWise, R>::type calculateParabolic(R value) {
+  typename std::enable_if<std::is_compound<R>::value && std::is_compound<S>::value && !elementWise, R>::type calculateParabolic(R value, const Tout& parabolicSwitchPoint) {
     Tout outVal;  // multiplication with parabolic gain and gain matrix does not make sense
     return outVal;
   }
 
   template<typename R, typename S>
-  typename std::enable_if<std::is_compound<R>::value && elementWise, R>::type calculateParabolic(R value) {
+  typename std::enable_if<std::is_compound<R>::value && elementWise, R>::type calculateParabolic(R value, const Tout& parabolicSwitchPoint) {
     Tout outVal;
     for (unsigned int i = 0; i < value.size(); i++) {
       if (fabs(value[i]) > parabolicSwitchPoint[i]) {
@@ -348,30 +358,30 @@ class Gain : public Blockio<1,1,Tout> {
   }
      
   template<typename S>
-  typename std::enable_if<std::is_integral<S>::value>::type resetMinMaxGain() {
-    minGain = std::numeric_limits<int32_t>::min();
-    maxGain = std::numeric_limits<int32_t>::max();
+  typename std::enable_if<std::is_integral<S>::value>::type resetMinMaxGain(Params& p) {
+    p.minGain = std::numeric_limits<int32_t>::min();
+    p.maxGain = std::numeric_limits<int32_t>::max();
   }
 
   template<typename S>
-  typename std::enable_if<std::is_floating_point<S>::value>::type resetMinMaxGain() {
-    minGain = std::numeric_limits<double>::lowest();
-    maxGain = std::numeric_limits<double>::max();
+  typename std::enable_if<std::is_floating_point<S>::value>::type resetMinMaxGain(Params& p) {
+    p.minGain = std::numeric_limits<double>::lowest();
+    p.maxGain = std::numeric_limits<double>::max();
   }
 
   template<typename S>
   typename std::enable_if<!std::is_arithmetic<S>::value && std::is_integral<typename S::value_type>::value>::type
-  resetMinMaxGain() {
-    minGain.fill(std::numeric_limits<int32_t>::min());
-    maxGain.fill(std::numeric_limits<int32_t>::max());
+  resetMinMaxGain(Params& p) {
+    p.minGain.fill(std::numeric_limits<int32_t>::min());
+    p.maxGain.fill(std::numeric_limits<int32_t>::max());
   }
 
   template<typename S>
   typename std::enable_if<
       !std::is_arithmetic<S>::value && std::is_floating_point<typename S::value_type>::value>::type
-  resetMinMaxGain() {
-    minGain.fill(std::numeric_limits<double>::lowest());
-    maxGain.fill(std::numeric_limits<double>::max());
+  resetMinMaxGain(Params& p) {
+    p.minGain.fill(std::numeric_limits<double>::lowest());
+    p.maxGain.fill(std::numeric_limits<double>::max());
   }
 };
 
@@ -383,10 +393,11 @@ class Gain : public Blockio<1,1,Tout> {
  */
 template<typename Tout, typename Tgain>
 std::ostream &operator<<(std::ostream &os, Gain<Tout, Tgain> &gain) {
-  os << "Block Gain: '" << gain.getName() << "' is enabled=" << gain.enabled << ", gain=" << gain.gain << ", ";
-  os << "smoothChange=" << gain.smoothChange << ", minGain=" << gain.minGain << ", maxGain=" << gain.maxGain;
-  os << ", targetGain=" << gain.targetGain << ", gainDiff=" << gain.gainDiff;
-  os << ", parabolic=" << gain.parabolic << ", parabolicSwitchPoint=" << gain.parabolicSwitchPoint;
+  auto p = gain.param.get();
+  os << "Block Gain: '" << gain.getName() << "' is enabled=" << p.enabled << ", gain=" << gain.gain << ", ";
+  os << "smoothChange=" << p.smoothChange << ", minGain=" << p.minGain << ", maxGain=" << p.maxGain;
+  os << ", targetGain=" << p.targetGain << ", gainDiff=" << p.gainDiff;
+  os << ", parabolic=" << p.parabolic << ", parabolicSwitchPoint=" << p.parabolicSwitchPoint;
   return os;
 }
 
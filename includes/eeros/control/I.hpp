@@ -2,11 +2,11 @@
 #define ORG_EEROS_CONTROL_I_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/logger/Logger.hpp>
 #include <eeros/safety/SafetyLevel.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #include <cmath>
-#include <mutex>
 
 namespace eeros {
 namespace control {
@@ -21,6 +21,7 @@ namespace control {
  * enable() or disable() or it can depend on the current safety level.
  * If the current safety level is equal or greater than a preset level,
  * the integrator will be enabled.
+ * Settings are picked up by the block without locking, see \ref Parameter.
  *
  * @tparam T - output type (double - default type)
  * @since v0.6
@@ -31,9 +32,16 @@ class I: public Blockio<1,1,T> {
   /**
    * Constructs an integrator instance.\n
    */
-  I() : first(true), enabled(false), safetySystem(nullptr), activeLevel(nullptr) {
+  I() : first(true), initCount(0), limitCount(0) {
     prev.clear(); 
-    clearLimits();
+    Params p;
+    p.enabled = false;
+    p.initCount = 0;
+    p.limitCount = 0;
+    p.safetySystem = nullptr;
+    p.activeLevel = nullptr;
+    clearLimits(p);
+    param.set(p);
   }
  
   /**
@@ -51,9 +59,11 @@ class I: public Blockio<1,1,T> {
    * @see disable()
    */
   virtual void run() override {
-    std::lock_guard<std::mutex> lock(mtx);
-    if (activeLevel != nullptr)
-      enabled =  safetySystem->getCurrentLevel() >= *activeLevel;
+    if (param.update()) apply(param.value());
+    const Params& p = param.value();
+    bool enabled = p.enabled;
+    if (p.activeLevel != nullptr)
+      enabled =  p.safetySystem->getCurrentLevel() >= *p.activeLevel;
     double tin = this->in.getSignal().getTimestamp() / 1000000000.0;
     double tprev = this->prev.getTimestamp() / 1000000000.0;
     double dt;
@@ -66,7 +76,7 @@ class I: public Blockio<1,1,T> {
     T output;
     if (enabled) {
       T val = valprev + valin * dt;
-      if ((val < upperLimit) && (val > lowerLimit)) output = val; 
+      if ((val < p.upperLimit) && (val > p.lowerLimit)) output = val; 
       else output = valprev;
     } else output = valprev;
     this->out.getSignal().setValue(output);
@@ -82,7 +92,7 @@ class I: public Blockio<1,1,T> {
    * @see disable()
    */
   virtual void enable() {
-    this->enabled = true;
+    param.modify([](Params& p) { p.enabled = true; });
   }
 
   /**
@@ -93,7 +103,7 @@ class I: public Blockio<1,1,T> {
    * @see enable()
    */
   virtual void disable() {
-    this->enabled = false;
+    param.modify([](Params& p) { p.enabled = false; });
   }
   
   /**
@@ -104,7 +114,10 @@ class I: public Blockio<1,1,T> {
    * @param val - initial state
    */
   virtual void setInitCondition(T val) {
-    this->prev.setValue(val);
+    param.modify([&](Params& p) {
+      p.init = val;
+      p.initCount++;
+    });
   }
   
   /**
@@ -117,11 +130,11 @@ class I: public Blockio<1,1,T> {
    * @param lower - lower limit
    */
   virtual void setLimit(T upper, T lower) {
-    this->upperLimit = upper;
-    this->lowerLimit = lower;
-    T val = prev.getValue();
-    if (val > upper) prev.setValue(upper);
-    if (val < lower) prev.setValue(lower);
+    param.modify([&](Params& p) {
+      p.upperLimit = upper;
+      p.lowerLimit = lower;
+      p.limitCount++;
+    });
   }
 
   /**
@@ -132,9 +145,10 @@ class I: public Blockio<1,1,T> {
    * @param level - SafetyLevel
    */
   virtual void setActiveLevel(safety::SafetySystem& ss, safety::SafetyLevel &level) {
-    std::lock_guard<std::mutex> lock(mtx);
-    safetySystem = &ss;
-    activeLevel = &level;
+    param.modify([&](Params& p) {
+      p.safetySystem = &ss;
+      p.activeLevel = &level;
+    });
   }
 
   /*
@@ -145,33 +159,52 @@ class I: public Blockio<1,1,T> {
   friend std::ostream &operator<<(std::ostream &os, I<X> &i);
 
  protected:
+  struct Params {
+    bool enabled;
+    T upperLimit, lowerLimit;
+    T init;                   // initial state, applied by run()
+    unsigned int initCount;   // incremented with each new initial state
+    unsigned int limitCount;  // incremented with each new limit
+    safety::SafetySystem *safetySystem;
+    safety::SafetyLevel *activeLevel;
+  };
+
   bool first;
-  bool enabled;
   Signal<T> prev;
-  T upperLimit, lowerLimit;
-  safety::SafetySystem *safetySystem;
-  safety::SafetyLevel *activeLevel;
-  std::mutex mtx{};
+  unsigned int initCount, limitCount;
+  Parameter<Params> param;
   
  private:
-  virtual void clearLimits() {
-    _clear<T>();
+  void apply(const Params& p) {
+    if (p.initCount != initCount) {
+      prev.setValue(p.init);
+      initCount = p.initCount;
+    }
+    if (p.limitCount != limitCount) {
+      T val = prev.getValue();
+      if (val > p.upperLimit) prev.setValue(p.upperLimit);
+      if (val < p.lowerLimit) prev.setValue(p.lowerLimit);
+      limitCount = p.limitCount;
+    }
+  }
+  virtual void clearLimits(Params& p) {
+    _clear<T>(p);
   }
-  template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear() {
-    upperLimit = std::numeric_limits<int32_t>::max();
-    lowerLimit = -upperLimit;
+  template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear(Params& p) {
+    p.upperLimit = std::numeric_limits<int32_t>::max();
+    p.lowerLimit = -p.upperLimit;
   }
-  template <typename S> typename std::enable_if<std::is_floating_point<S>::value>::type _clear() {
-    upperLimit = std::numeric_limits<double>::max();
-    lowerLimit = -upperLimit;
+  template <typename S> typename std::enable_if<std::is_floating_point<S>::value>::type _clear(Params& p) {
+    p.upperLimit = std::numeric_limits<double>::max();
+    p.lowerLimit = -p.upperLimit;
   }
-  template <typename S> typename std::enable_if<!std::is_arithmetic<S>::value && std::is_integral<typename S::value_type>::value>::type _clear() {
-    upperLimit.fill(std::numeric_limits<int32_t>::max());
-    lowerLimit = -upperLimit;
+  template <typename S> typename std::enable_if<!std::is_arithmetic<S>::value && std::is_integral<typename S::value_type>::value>::type _clear(Params& p) {
+    p.upperLimit.fill(std::numeric_limits<int32_t>::max());
+    p.lowerLimit = -p.upperLimit;
   }
-  template <typename S> typename std::enable_if<   !std::is_arithmetic<S>::value && std::is_floating_point<typename S::value_type>::value>::type _clear() {
-    upperLimit.fill(std::numeric_limits<double>::max());
-    lowerLimit = -upperLimit;
+  template <typename S> typename std::enable_if<   !std::is_arithmetic<S>::value && std::is_floating_point<typename S::value_type>::value>::type _clear(Params& p) {
+    p.upperLimit.fill(std::numeric_limits<double>::max());
+    p.lowerLimit = -p.upperLimit;
   }
 
 };
@@ -183,8 +216,9 @@ class I: public Blockio<1,1,T> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, I<T>& i) {
-  os << "Block integrator: '" << i.getName() << "' is enabled=" << i.enabled;
-  os << ", upperLimit=" << i.upperLimit << ", lowerLimit=" << i.lowerLimit; 
+  auto p = i.param.get();
+  os << "Block integrator: '" << i.getName() << "' is enabled=" << p.enabled;
+  os << ", upperLimit=" << p.upperLimit << ", lowerLimit=" << p.lowerLimit; 
   return os;
 }
 
@@ -2,6 +2,7 @@
 #define ORG_EEROS_CONTROL_INPUT_HPP_
 
 #include <eeros/control/NotConnectedFault.hpp>
+#include <eeros/control/FaultStatus.hpp>
 #include <eeros/control/Signal.hpp>
 #include <eeros/control/Output.hpp>
 #include <eeros/control/Block.hpp>
@@ -18,19 +19,42 @@ namespace control {
  */
 
 template < typename T = double >
-class Input {
+class Input : public InputBase {
  public:
   /**
-   * Constructs an input instance.
+   * Constructs an input instance without owner. Blocks should construct their 
+   * inputs with themselves as owner. As long as a connected input has no owner,
+   * the time domain running the block of its output cannot run its blocks in 
+   * parallel, see \ref TimeDomain::setParallel().
    */
-  Input() : connectedOutput(nullptr), owner(nullptr) { }
+  Input() : connectedOutput(nullptr), owner(nullptr) { held.clear(); }
  
   /**
    * Constructs an input instance.
    *
    * @param owner - the block which owns this input
    */
-  Input(Block* owner) : connectedOutput(nullptr), owner(owner) { }
+  Input(Block* owner) : connectedOutput(nullptr), owner(owner) {
+    held.clear();
+    if (owner != nullptr) owner->registerInput(this);
+  }
+
+  Input(const Input& i) : connectedOutput(i.connectedOutput), owner(i.owner), held(i.held) {
+    if (connectedOutput != nullptr && owner == nullptr) trackWithoutOwner(this, true);
+  }
+
+  Input& operator=(const Input& i) {
+    if (connectedOutput != nullptr && owner == nullptr) trackWithoutOwner(this, false);
+    connectedOutput = i.connectedOutput;
+    owner = i.owner;
+    held = i.held;
+    if (connectedOutput != nullptr && owner == nullptr) trackWithoutOwner(this, true);
+    return *this;
+  }
+
+  virtual ~Input() {
+    if (connectedOutput != nullptr && owner == nullptr) trackWithoutOwner(this, false);
+  }
 
   /**
    * Connects an existing output of any other block to this input.
@@ -41,6 +65,7 @@ class Input {
   virtual bool connect(Output<T>& output) {
     if(connectedOutput != nullptr) return false;
     connectedOutput = &output;
+    if (owner == nullptr) trackWithoutOwner(this, true);
     return true;
   }
             
@@ -53,13 +78,16 @@ class Input {
   virtual bool connect(Output<T>* output) {
     if(connectedOutput != nullptr) return false;
     connectedOutput = output;
+    if (output != nullptr && owner == nullptr) trackWithoutOwner(this, true);
     return true;
   }
 
   /**
-   * Disconnects this input.
+   * Disconnects this input. The last signal of the output is held, see \ref getSignal().
    */
   virtual void disconnect() {
+    if (connectedOutput != nullptr) held = connectedOutput->getSignal();
+    if (connectedOutput != nullptr && owner == nullptr) trackWithoutOwner(this, false);
     connectedOutput = nullptr;
   }
 
@@ -71,16 +99,30 @@ class Input {
   virtual bool isConnected() const {
     return connectedOutput != nullptr;
   }
+
+  /**
+   * Returns the block which produces the signal this input is connected to.
+   * 
+   * @return source block, nullptr if not connected or unknown
+   */
+  virtual Block* getSourceBlock() const {
+    return isConnected() ? connectedOutput->getSourceBlock() : nullptr;
+  }
             
   /**
    * Returns the signal which is carried by the output to which
-   * this input is connected. If the input is not connected an NotConnectedFault
-   * is thrown.
+   * this input is connected. If the input is not connected and the block is run
+   * by a time domain, a fault is raised in its \ref FaultStatus and the signal the
+   * connected output carried when the input was disconnected is returned unchanged,
+   * so stateful blocks like an integrator keep their state and continue once the input
+   * is connected again. An input which was never connected returns a cleared signal.
+   * Without a time domain a NotConnectedFault is thrown.
    * 
    * @return signal 
    */
   virtual Signal<T>& getSignal() {
     if(isConnected()) return connectedOutput->getSignal();
+    if (FaultStatus::raise(FaultCode::notConnected, owner)) return held;
     std::string name;
     if (owner != nullptr) name = owner->getName(); else name = "";
       throw NotConnectedFault("Read from an unconnected input in block '" + name + "'");
@@ -92,12 +134,15 @@ class Input {
    * @param block - owner of this input
    */
   virtual void setOwner(Block* block) {
+    if (connectedOutput != nullptr) trackWithoutOwner(this, block == nullptr);
     owner = block;
+    if (owner != nullptr) owner->registerInput(this);
   }
             
  protected:
   Output<T>* connectedOutput;
   Block* owner;
+  Signal<T> held;  // returned while not connected
  };
 
 }
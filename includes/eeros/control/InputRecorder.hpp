@@ -0,0 +1,175 @@
+#ifndef ORG_EEROS_CONTROL_INPUTRECORDER_HPP_
+#define ORG_EEROS_CONTROL_INPUTRECORDER_HPP_
+
+#include <eeros/core/Runnable.hpp>
+#include <eeros/control/PeripheralInput.hpp>
+#include <eeros/control/Signal.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eeros {
+
+namespace safety {
+class SafetySystem;
+}
+
+namespace control {
+
+/**
+ * Binary format of a recording of peripheral inputs, written by \ref InputRecorder
+ * and replayed by \ref InputReplay. The file starts with a header and a table of the
+ * recorded channels, followed by one frame per cycle, all in host byte order.
+ * All frames have the same size, so frame i starts at dataOffset + i * frameSize.
+ * A partially written last frame, e.g. after a crash, is ignored.
+ *
+ * @since v1.4
+ */
+namespace recording {
+
+constexpr uint32_t version = 1;
+constexpr std::size_t maxIdLength = 47;
+
+struct Header {
+  char magic[8];          // "EEROSREC"
+  uint32_t version;
+  uint32_t channels;
+  uint64_t frameSize;     // bytes per frame
+  uint64_t dataOffset;    // offset of the first frame
+};
+
+enum class Type : uint32_t { real = 0, logic = 1 };
+
+struct Channel {
+  char id[maxIdLength + 1];  // id of the input in the hardware configuration, zero terminated
+  Type type;
+  uint32_t reserved;
+};
+
+struct Frame {
+  uint64_t cycle;       // number of the frame since the start of the recording
+  uint64_t timeNs;      // cycle time, see \ref System::getCycleTimeNs()
+  uint32_t level;       // id of the current safety level, 0 without safety system
+  uint32_t reserved;
+};
+
+struct Sample {
+  double value;         // value of the input, 0 or 1 for logic inputs
+  uint64_t timestamp;   // timestamp of the input signal
+};
+
+}
+
+/**
+ * An input recorder records the signals of peripheral input blocks and the safety
+ * level once per cycle, so that the input sequence a control system saw can be replayed
+ * offline, see \ref InputReplay. Add the recorder to the time domain after the input
+ * blocks, it copies one frame per run into a preallocated buffer. A writer thread
+ * appends the buffered frames to the file. Recording never blocks and never allocates,
+ * if the buffer is full the frame is dropped and counted.
+ *
+ * All inputs must be added before the first run.
+ *
+ * @since v1.4
+ */
+class InputRecorder : public Runnable {
+ public:
+  /**
+   * Creates a recorder and opens the file.
+   * Throws a Fault if the file cannot be opened.
+   *
+   * @param filename - file to write the recording to
+   * @param bufferSize - number of frames buffered for the writer thread
+   */
+  InputRecorder(const std::string& filename, std::size_t bufferSize = 4096);
+
+  /**
+   * Writes the buffered frames and closes the file.
+   */
+  virtual ~InputRecorder();
+
+  InputRecorder(const InputRecorder&) = delete;
+  InputRecorder& operator=(const InputRecorder&) = delete;
+
+  /**
+   * Records an input.
+   *
+   * @param input - input block
+   */
+  void add(PeripheralInput<double>& input);
+
+  /**
+   * Records a logic input.
+   *
+   * @param input - input block
+   */
+  void add(PeripheralInput<bool>& input);
+
+  /**
+   * Records the current level of a safety system.
+   *
+   * @param ss - safety system
+   */
+  void setSafetySystem(safety::SafetySystem& ss);
+
+  /**
+   * Records one frame.
+   */
+  virtual void run();
+
+  /**
+   * Returns the number of recorded frames, including the dropped frames.
+   *
+   * @return number of frames
+   */
+  uint64_t getFrameCount() const;
+
+  /**
+   * Returns the number of frames dropped because the buffer was full.
+   *
+   * @return number of dropped frames
+   */
+  uint64_t getDroppedCount() const;
+
+  /**
+   * Returns the size of a frame.
+   *
+   * @return frame size in bytes
+   */
+  std::size_t getFrameSize() const;
+
+ private:
+  recording::Channel channel(const std::string& id, recording::Type type);
+  void resize();
+  void write();
+  std::string filename;
+  std::ofstream file;
+  std::vector<recording::Channel> realChannels;
+  std::vector<recording::Channel> logicChannels;
+  std::vector<const Signal<double>*> reals;
+  std::vector<const Signal<bool>*> logics;
+  safety::SafetySystem* safetySystem;
+  std::size_t frameSize;
+  std::size_t bufferSize;
+  std::vector<uint64_t> buffer;
+  uint64_t cycle;
+  std::atomic<uint64_t> head;     // frames written by run()
+  std::atomic<uint64_t> tail;     // frames written to the file
+  std::atomic<uint64_t> dropped;
+  std::atomic<bool> finished;
+  std::mutex mutex;
+  std::condition_variable cv;
+  logger::Logger log;
+  std::thread thread;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_INPUTRECORDER_HPP_ */
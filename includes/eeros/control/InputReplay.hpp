@@ -0,0 +1,131 @@
+#ifndef ORG_EEROS_CONTROL_INPUTREPLAY_HPP_
+#define ORG_EEROS_CONTROL_INPUTREPLAY_HPP_
+
+#include <eeros/core/Runnable.hpp>
+#include <eeros/control/InputRecorder.hpp>
+#include <eeros/hal/Input.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eeros {
+namespace control {
+
+/**
+ * An input replay feeds the HAL from a recording written by \ref InputRecorder.
+ * For every recorded channel, an input with the recorded id is added to the HAL,
+ * so the peripheral input blocks of the control system read the recorded values and
+ * timestamps instead of the hardware. Inputs of a loaded hardware configuration with 
+ * a recorded id are replaced while the replay exists and put back into the HAL when it 
+ * is destroyed, they must outlive the replay. The replay has to be created before the 
+ * input blocks.
+ *
+ * Every run advances the replay by one frame. Run it before the time domains reading the
+ * inputs, e.g. in the list of periodics run before the periodic of the time domain with
+ * an executor in simulation mode, see \ref Executor::useSimulatedTime().
+ * With a simulated clock, the clock is set to the recorded cycle time, so the control
+ * system sees exactly the same inputs and times as during the recording.
+ * The file is mapped into memory, \ref seek() jumps to any frame.
+ *
+ * @since v1.4
+ */
+class InputReplay : public Runnable {
+ public:
+  /**
+   * Opens a recording and adds its inputs to the HAL.
+   * Throws a Fault if the file is not a valid recording.
+   *
+   * @param filename - recording
+   */
+  explicit InputReplay(const std::string& filename);
+
+  /**
+   * Removes the inputs from the HAL, puts back the replaced inputs and closes the recording.
+   */
+  virtual ~InputReplay();
+
+  InputReplay(const InputReplay&) = delete;
+  InputReplay& operator=(const InputReplay&) = delete;
+
+  /**
+   * Advances to the next frame. After the last frame, the inputs keep their values.
+   */
+  virtual void run();
+
+  /**
+   * Sets the frame loaded by the next run.
+   *
+   * @param frame - index of the frame
+   */
+  void seek(uint64_t frame);
+
+  /**
+   * Returns true if all frames were replayed.
+   *
+   * @return true at the end of the recording
+   */
+  bool atEnd() const;
+
+  /**
+   * Returns the number of frames in the recording.
+   *
+   * @return number of frames
+   */
+  uint64_t getFrameCount() const;
+
+  /**
+   * Returns the index of the frame loaded by the next run.
+   *
+   * @return index of the frame
+   */
+  uint64_t getPosition() const;
+
+  /**
+   * Returns the recorded cycle number of the current frame, gaps show dropped frames.
+   *
+   * @return cycle number
+   */
+  uint64_t getCycle() const;
+
+  /**
+   * Returns the recorded cycle time of the current frame.
+   *
+   * @return time in ns
+   */
+  uint64_t getTimeNs() const;
+
+  /**
+   * Returns the recorded safety level of the current frame.
+   *
+   * @return id of the safety level, 0 if no safety system was recorded
+   */
+  uint32_t getLevel() const;
+
+  /**
+   * Returns the ids of the recorded inputs.
+   *
+   * @return ids
+   */
+  std::vector<std::string> getIds() const;
+
+ private:
+  void restore();
+
+  std::string filename;
+  void* map;
+  std::size_t mapSize;
+  const recording::Header* header;
+  const recording::Channel* channels;
+  const char* data;
+  uint64_t frames;
+  uint64_t position;
+  const recording::Frame* current;
+  std::vector<std::unique_ptr<hal::InputInterface>> inputs;
+  std::vector<hal::InputInterface*> replaced;  // hardware inputs with the recorded ids, nullptr if none
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_INPUTREPLAY_HPP_ */
@@ -44,6 +44,15 @@ class InputSub : public Input<T>, public Output<T> {
   virtual Signal<T>& getSignal() {
     return Input<T>::getSignal();
   }
+
+  /**
+   * Returns the block outside of the subsystem which produces the signal.
+   * 
+   * @return source block, nullptr if not connected or unknown
+   */
+  virtual Block* getSourceBlock() const {
+    return Input<T>::getSourceBlock();
+  }
             
  };
 
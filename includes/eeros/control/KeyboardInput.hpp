@@ -52,7 +52,7 @@ class KeyboardInput: public Blockio<0,N,bool> {
    * Runs the block.
    */
   virtual void run() {
-    uint64_t time = eeros::System::getTimeNs();
+    uint64_t time = eeros::System::getCycleTimeNs();
     auto& list = KeyList::instance();
     for (uint8_t i = 0; i < list.nofKeys; i++) {
       this->out[i].getSignal().setValue(list.state[i]);
@@ -123,7 +123,7 @@ class KeyboardInput<1>: public Blockio<0,1,bool> {
    * Runs the block.
    */
   virtual void run() {
-    uint64_t time = eeros::System::getTimeNs();
+    uint64_t time = eeros::System::getCycleTimeNs();
     auto& list = KeyList::instance();
     this->out.getSignal().setValue(list.state[0]);
     this->out.getSignal().setTimestamp(time);
@@ -0,0 +1,206 @@
+#ifndef ORG_EEROS_CONTROL_LOOKUPTABLE_HPP_
+#define ORG_EEROS_CONTROL_LOOKUPTABLE_HPP_
+
+#include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
+#include <eeros/config/TableFile.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace eeros {
+namespace control {
+
+/**
+ * Interpolation between the samples of a lookup table.
+ */
+enum class Interpolation {
+  linear,  // multilinear between the 2^N neighbouring samples
+  cubic    // cubic convolution (Catmull-Rom) over the 4^N neighbouring samples
+};
+
+/**
+ * A lookup table block maps its input through a calibration table, e.g. to linearize
+ * an encoder or to compensate thermal drift. The table holds samples on an equidistant
+ * grid of one to three dimensions, see \ref config::TableFile, usually mapped from a file.
+ * The output is interpolated between the samples neighbouring the input. Inputs outside
+ * of the grid are clamped to its border.
+ *
+ * The grid offsets and strides are computed once when the table is set. Looking up
+ * a sample takes a fixed number of operations without branches, independent of the
+ * size of the table. The table can be exchanged while the block is running, the
+ * block picks up the new table without locking.
+ *
+ * @tparam N - number of dimensions of the table (1 - default)
+ * @tparam I - interpolation (linear - default)
+ *
+ * @since v1.4
+ */
+template < uint8_t N = 1, Interpolation I = Interpolation::linear >
+class LookupTable : public Blockio<1,1,typename std::conditional<N == 1, double, math::Matrix<N,1,double>>::type, double> {
+  static_assert(N >= 1 && N <= config::TableFile::maxDims, "lookup tables have 1 to 3 dimensions");
+
+ public:
+  /**
+   * Input type, a scalar for one dimension or a vector for more dimensions.
+   */
+  using Tin = typename std::conditional<N == 1, double, math::Matrix<N,1,double>>::type;
+
+  /**
+   * Constructs a lookup table block.
+   * Throws a Fault if the table does not have N dimensions.
+   *
+   * @param table - table
+   */
+  explicit LookupTable(std::shared_ptr<const config::TableFile> table) : grid(makeGrid(table)) { }
+
+  /**
+   * Disabling use of copy constructor because the block should never be copied unintentionally.
+   */
+  LookupTable(const LookupTable& s) = delete;
+
+  /**
+   * Runs the block, the output is the interpolated table value at the input.
+   */
+  virtual void run() {
+    grid.update();
+    this->out.getSignal().setValue(get(this->in.getSignal().getValue()));
+    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+  }
+
+  /**
+   * Exchanges the table. Can be called from any thread.
+   * Throws a Fault if the table does not have N dimensions.
+   *
+   * @param table - new table
+   */
+  virtual void setTable(std::shared_ptr<const config::TableFile> table) {
+    grid.set(makeGrid(table));
+  }
+
+  /**
+   * Returns the interpolated table value, used by \ref run().
+   * Must only be called by the thread running the block.
+   *
+   * @param x - coordinates
+   * @return interpolated value
+   */
+  double get(const Tin& x) {
+    const Grid& g = grid.value();
+    std::size_t i[N];
+    double t[N];
+    for (uint8_t d = 0; d < N; d++) {
+      // grid coordinate clamped to the table, the index of the lower sample is
+      // limited to the second last sample, so the last sample has a fraction of 1
+      double u = std::min(std::max((coordinate(x, d) - g.min[d]) * g.scale[d], 0.0), g.last[d]);
+      std::size_t k = static_cast<std::size_t>(u);
+      i[d] = std::min(k, g.lastIndex[d] - 1);
+      t[d] = u - i[d];
+    }
+    return interpolate(g, i, t, std::integral_constant<Interpolation, I>());
+  }
+
+ private:
+  struct Grid {
+    std::shared_ptr<const config::TableFile> table;  // keeps the samples alive
+    const double* data;
+    std::size_t stride[N];
+    std::size_t lastIndex[N];
+    double last[N];
+    double min[N];
+    double scale[N];
+  };
+
+  static Grid makeGrid(std::shared_ptr<const config::TableFile> table) {
+    if (!table || table->getDims() != N) throw Fault("Lookup table needs a table with " + std::to_string(N) + " dimensions");
+    Grid g;
+    g.table = table;
+    g.data = table->data();
+    std::size_t stride = 1;
+    for (int d = N - 1; d >= 0; d--) {
+      g.stride[d] = stride;
+      stride *= table->getSize(d);
+      g.lastIndex[d] = table->getSize(d) - 1;
+      g.last[d] = g.lastIndex[d];
+      g.min[d] = table->getMin(d);
+      g.scale[d] = g.lastIndex[d] / (table->getMax(d) - table->getMin(d));
+    }
+    return g;
+  }
+
+  static double coordinate(double x, uint8_t) { return x; }
+  static double coordinate(const math::Matrix<N,1,double>& x, uint8_t d) { return x[d]; }
+
+  static double interpolate(const Grid& g, const std::size_t* i, const double* t, std::integral_constant<Interpolation, Interpolation::linear>) {
+    double w[N][2];
+    std::size_t o[N][2];
+    for (uint8_t d = 0; d < N; d++) {
+      w[d][0] = 1 - t[d];
+      w[d][1] = t[d];
+      o[d][0] = i[d] * g.stride[d];
+      o[d][1] = o[d][0] + g.stride[d];
+    }
+    double r = 0;
+    for (unsigned int c = 0; c < (1u << N); c++) {
+      double weight = 1;
+      std::size_t offset = 0;
+      for (uint8_t d = 0; d < N; d++) {
+        unsigned int b = (c >> d) & 1;
+        weight *= w[d][b];
+        offset += o[d][b];
+      }
+      r += weight * g.data[offset];
+    }
+    return r;
+  }
+
+  static double interpolate(const Grid& g, const std::size_t* i, const double* t, std::integral_constant<Interpolation, Interpolation::cubic>) {
+    double w[N][4];
+    std::size_t o[N][4];
+    for (uint8_t d = 0; d < N; d++) {
+      double s = t[d];
+      w[d][0] = ((-0.5 * s + 1.0) * s - 0.5) * s;
+      w[d][1] = (1.5 * s - 2.5) * s * s + 1.0;
+      w[d][2] = ((-1.5 * s + 2.0) * s + 0.5) * s;
+      w[d][3] = (0.5 * s - 0.5) * s * s;
+      // samples beyond the border are replaced by the border sample
+      o[d][0] = (i[d] - (i[d] > 0)) * g.stride[d];
+      o[d][1] = i[d] * g.stride[d];
+      o[d][2] = (i[d] + 1) * g.stride[d];
+      o[d][3] = std::min(i[d] + 2, g.lastIndex[d]) * g.stride[d];
+    }
+    double r = 0;
+    for (unsigned int c = 0; c < (1u << (2 * N)); c++) {
+      double weight = 1;
+      std::size_t offset = 0;
+      for (uint8_t d = 0; d < N; d++) {
+        unsigned int k = (c >> (2 * d)) & 3;
+        weight *= w[d][k];
+        offset += o[d][k];
+      }
+      r += weight * g.data[offset];
+    }
+    return r;
+  }
+
+  Parameter<Grid> grid;
+};
+
+/**
+ * Operator overload (<<) to enable an easy way to print the state of a
+ * lookup table instance to an output stream.\n
+ * Does not print a newline control character.
+ */
+template < uint8_t N, Interpolation I >
+std::ostream& operator<<(std::ostream& os, LookupTable<N,I>& t) {
+  os << "Block lookup table: '" << t.getName() << "'";
+  return os;
+}
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_LOOKUPTABLE_HPP_ */
@@ -11,6 +11,8 @@ namespace control {
  * Blocks can have inputs and outputs. This is the output class.
  * An output carries a signal. One or several inputs of other blocks
  * can be connected to this output.
+ * The owner of the output is only needed to configure the control system,
+ * it is kept in the \ref SignalRegistry with the signal.
  * 
  * @tparam T - signal type (double - default type)
  * @since v0.4
@@ -22,14 +24,16 @@ class Output {
   /**
    * Constructs an output instance.
    */
-  Output() : owner(nullptr) { }
+  Output() { }
 
   /**
    * Constructs an output instance.
    *
    * @param owner - the block which owns this output
    */
-  Output(Block* owner) : owner(owner) { }
+  Output(Block* owner) {
+    setOwner(owner);
+  }
 
   /**
    * Returns the signal which is carried by this output.
@@ -46,12 +50,21 @@ class Output {
    * @param block - owner of this output
    */
   virtual void setOwner(Block* block) {
-    owner = block;
+    SignalRegistry::setSource(signal.own(), block);
+  }
+
+  /**
+   * Returns the block which produces the signal of this output.
+   * 
+   * @return owner of this output
+   */
+  virtual Block* getSourceBlock() const {
+    if ((signal.id & (Signal<T>::registered | Signal<T>::copied)) == 0) return nullptr;
+    return SignalRegistry::getSource(signal.id & Signal<T>::idMask);
   }
 
  private:
   Signal<T> signal;
-  Block* owner;
 };
 
 }
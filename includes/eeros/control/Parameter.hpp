@@ -0,0 +1,108 @@
+#ifndef ORG_EEROS_CONTROL_PARAMETER_HPP_
+#define ORG_EEROS_CONTROL_PARAMETER_HPP_
+
+#include <eeros/core/TripleBuffer.hpp>
+#include <mutex>
+
+namespace eeros {
+namespace control {
+
+/**
+ * A parameter holds values of a block which are changed by other threads, e.g.
+ * by a sequence, while the block is run by a time domain. The type is usually a
+ * struct with all the parameters of a block, so that a change of several values
+ * is published at once and the block never sees a partially updated set.
+ *
+ * Writers change a private copy and publish it by swapping buffers. The block
+ * picks up the latest published set at the beginning of its run method without
+ * ever waiting, so a preempted writer cannot stall the realtime thread. Writers
+ * are serialized among themselves by a mutex, which the block never takes.
+ *
+ * @tparam T - type of the parameter set
+ *
+ * @since v1.4
+ */
+template < typename T >
+class Parameter {
+ public:
+  /**
+   * Constructs a parameter set with default values.
+   */
+  Parameter() : Parameter(T()) { }
+
+  /**
+   * Constructs a parameter set with initial values.
+   *
+   * @param init - initial values
+   */
+  Parameter(const T& init) : pending(init) {
+    for (unsigned int i = 0; i < 3; i++) buffer[i] = init;
+  }
+
+  Parameter(const Parameter&) = delete;
+  Parameter& operator=(const Parameter&) = delete;
+
+  /**
+   * Replaces the whole parameter set and publishes it. Called by writers.
+   *
+   * @param value - new values
+   */
+  void set(const T& value) {
+    modify([&value](T& p) { p = value; });
+  }
+
+  /**
+   * Changes the parameter set with a function and publishes the result.
+   * The function gets the latest values set by any writer. Called by writers.
+   *
+   * @param f - function taking a reference to the parameter set
+   */
+  template < typename F >
+  void modify(F f) {
+    std::lock_guard<std::mutex> lock(mtx);
+    f(pending);
+    buffer.back() = pending;
+    buffer.publish();
+  }
+
+  /**
+   * Returns a copy of the latest values set by any writer, even if
+   * the block has not yet picked them up. Called by writers.
+   *
+   * @return parameter set
+   */
+  T get() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pending;
+  }
+
+  /**
+   * Picks up the latest published parameter set. Must only be called by the
+   * thread running the block, usually at the beginning of the run method.
+   *
+   * @return true, if the parameters changed since the last call
+   */
+  bool update() {
+    return buffer.update();
+  }
+
+  /**
+   * Returns the parameter set picked up by the last call to \ref update().
+   * Must only be called by the thread running the block.
+   *
+   * @return parameter set
+   */
+  const T& value() {
+    return buffer.front();
+  }
+
+ private:
+  mutable std::mutex mtx;
+  T pending;
+  TripleBuffer<T> buffer;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_PARAMETER_HPP_ */
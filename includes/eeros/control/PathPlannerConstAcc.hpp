@@ -2,10 +2,11 @@
 #define ORG_EEROS_CONTROL_PATHPLANNERCONSTACC_HPP_
 
 #include <eeros/control/Output.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/control/TrajectoryGenerator.hpp>
+#include <eeros/control/TrajectoryTable.hpp>
 #include <eeros/core/System.hpp>
 #include <cmath>
-#include <mutex>
 
 namespace eeros {
 namespace control {
@@ -17,6 +18,7 @@ namespace control {
  * which can be chosen. After this maximum velocity is reached the acceleration is set to 0 and
  * the trajectory continues with constant velocity. Towards the end a constant deceleration
  * makes sure that the final position is reached with the velocity reaching 0. 
+ * A new trajectory is passed to the block without locking, see \ref Parameter.
  * 
  * @tparam T - output type (must be a composite type), 
  *             a trajectory in 3-dimensional space needs T = Matrix<3,1,double>, 
@@ -44,7 +46,8 @@ class PathPlannerConstAcc : public TrajectoryGenerator<T, 3> {
    * @param dt - sampling time
    */
   PathPlannerConstAcc(T velMax, T acc, T dec, double dt) 
-      : finished(true), velMax(velMax), acc(acc), dec(dec), dt(dt) { 
+      : posOut(this), velOut(this), accOut(this), active(false), number(0), segment(0), period(0), velMax(velMax), acc(acc), dec(dec), dt(dt) { 
+    for (auto& e : state) e = 0;
     posOut.getSignal().clear();
     velOut.getSignal().clear();
     accOut.getSignal().clear();
@@ -61,75 +64,50 @@ class PathPlannerConstAcc : public TrajectoryGenerator<T, 3> {
    * @return - end of trajectory is reached
    */
   virtual bool endReached() {
-    std::lock_guard<std::mutex> lck(mtx);
-    return finished;
+    return this->allFinished();
   }
   
   /**
-   * Runs the path planner block. With the precalculated values for the 
-   * acceleration for all sampling points on the trajectory, the resulting velocities
-   * and positions are calculated and written to the appropriate outputs.
+   * Runs the path planner block. The trajectory was converted to a table of polynomials
+   * by \ref move(), each run evaluates the current segment for all axes and counts the
+   * sampling periods to advance to the next segment.
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lck(mtx);
-    std::array<T, 3> y = this->last;
-    t += dt;
+    if (cmd.update()) {
+      const Command& c = cmd.value();
+      if (c.move) {
+        number = c.number;
+        segment = 0;
+        period = 0;
+        active = true;
+      } else {
+        state = c.start;
+        active = false;
+      }
+    }
     
-    if (!finished) {
-      for (unsigned int i = 0; i < a1p.size(); i++) {
-        switch (range) {
-          case 1:
-            if (t <= dT1) {
-              y[0][i] = a1p[i] * pow(t, 2) + c1p[i];
-              y[1][i] = b1v[i] * t;
-              y[2][i] = c1a[i];
-            } 
-            if (fabs(t - dT1) < 1e-12 && i == a1p.size() - 1) {
-              range = 2;
-              t = 0;
-            }
-            break;
-          case 2:
-            if (t <= dT2) {
-              y[0][i] = b2p[i] * t + c2p[i];
-              y[1][i] = c2v[i];
-              y[2][i] = c2a[i];
-            }
-            if (dT2 < 1e-12 || (fabs(t - dT2) < 1e-12 && i == a1p.size() - 1)) {
-              range = 3;
-              t = 0;
-            }
-            break;
-          case 3:
-            if (t <= dT3) {
-              y[0][i] = a3p[i] * pow(t, 2) + b3p[i] * t + c3p[i];
-              y[1][i] = b3v[i] * t + c3v[i];
-              y[2][i] = c3a[i];
-            }
-            if (fabs(t - dT3) < 1e-12 && i == a1p.size() - 1) {
-              range = 4;
-              t = 0;
-            }
-            break;
-          case 4:
-            finished = true;
-            y[0][i] = endPos[i];
-            y[1][i] = 0.0;
-            y[2][i] = 0.0;
-            break;
+    if (active) {
+      const Command& c = cmd.value();
+      if (segment < c.table.size()) {
+        c.table.evaluate(segment, ++period * dt, state);
+        if (period == c.table.getPeriods(segment)) {
+          segment++;
+          period = 0;
         }
-        // keep last position value
-        this->last[0][i] = y[0][i];
-        this->last[1][i] = y[1][i];
-        this->last[2][i] = y[2][i];
+      } else {
+        state[0] = c.endPos;
+        state[1] = 0;
+        state[2] = 0;
+        active = false;
+        this->finish(number);
       }
     }
 
-    posOut.getSignal().setValue(y[0]);
-    velOut.getSignal().setValue(y[1]);
-    accOut.getSignal().setValue(y[2]);
+    posOut.getSignal().setValue(state[0]);
+    velOut.getSignal().setValue(state[1]);
+    accOut.getSignal().setValue(state[2]);
 
-    timestamp_t time = System::getTimeNs(); 
+    timestamp_t time = System::getCycleTimeNs(); 
     posOut.getSignal().setTimestamp(time);
     velOut.getSignal().setTimestamp(time);
     accOut.getSignal().setTimestamp(time);
@@ -152,11 +130,12 @@ class PathPlannerConstAcc : public TrajectoryGenerator<T, 3> {
    * @see run()
    */
   virtual bool move(std::array<T, 3> start, std::array<T, 3> end) {
-    if (!finished) return false;
+    if (!endReached()) return false;
+    Command c;
     T calcVelNorm, calcAccNorm, calcDecNorm;
     E velNorm, accNorm, decNorm;
     T distance = end[0] - start[0];
-    endPos = end[0];
+    c.endPos = end[0];
     
     T zero; zero = 0;
     if (distance == zero) return false;
@@ -181,43 +160,38 @@ class PathPlannerConstAcc : public TrajectoryGenerator<T, 3> {
     if (velNorm > velNormMax) velNorm = velNormMax; 
     
     // calculate time intervals    
-    dT1 = velNorm / accNorm;
-    dT3 = velNorm / decNorm;
-    dT2 = 1 / velNorm - (dT1 + dT3) * 0.5;
+    double dT1 = velNorm / accNorm;
+    double dT3 = velNorm / decNorm;
+    double dT2 = 1 / velNorm - (dT1 + dT3) * 0.5;
     if (dT2 < 0) dT2 = 0;
    
     // make time intervals multiple of sampling time
-    dT1 = ceil(dT1 / dt) * dt;
-    dT2 = ceil(dT2 / dt) * dt;
-    dT3 = ceil(dT3 / dt) * dt; 
-//     log.info() << "dT1 = " << dT1 << ", dT2 = " << dT2 << ", dT3 = " << dT3;
+    unsigned int n1 = Table::periods(dT1, dt);
+    unsigned int n2 = Table::periods(dT2, dt);
+    unsigned int n3 = Table::periods(dT3, dt);
+    dT1 = n1 * dt;
+    dT2 = n2 * dt;
+    dT3 = n3 * dt;
   
     // recalculate velocity with definitive time interval values
     velNorm = 1 / ((dT2 + (dT1 + dT3) / 2));
-//     log.info() << "vel norm = " << velNorm;
     
+    // position polynomials of the three parts, p(t) = c0 + c1 * t + c2 * t^2
     T vel = velNorm * distance;
-    c1a = vel / dT1;
-    b1v = c1a;
-    a1p = 0.5 * c1a;
-    c1p = start[0];
-     
-    c2a = 0; 
-    c2v = vel;
-    b2p = c2v;
-    c2p = a1p * pow(dT1,2) + c1p;
-    
-    c3a = -vel / dT3;
-    b3v = c3a;  
-    c3v = vel; 
-    a3p = 0.5 * c3a;
-    b3p = c3v;
-    c3p = b2p * dT2 + c2p;
+    T a1 = 0.5 * vel / dT1;
+    T p2 = a1 * (dT1 * dT1) + start[0];
+    T p3 = vel * dT2 + p2;
+    T a3 = -0.5 * vel / dT3;
+    c.table.clear();
+    c.table.add(n1, start[0], zero, a1, zero);
+    c.table.add(n2, p2, vel, zero, zero);
+    c.table.add(n3, p3, vel, a3, zero);
     
-    std::lock_guard<std::mutex> lck(mtx);
-    finished = false;
-    range = 1;
-    t = 0;  
+    c.move = true;
+    c.number = this->dispatch();
+    cmd.set(c);
+    this->last = end;
+    for (unsigned int i = 1; i < end.size(); i++) this->last[i] = 0;
     return true;
   }
   
@@ -229,9 +203,13 @@ class PathPlannerConstAcc : public TrajectoryGenerator<T, 3> {
    * @param start - array containing start position and its higher derivatives
    */
   virtual void setStart(std::array<T, 3> start) {
-    std::lock_guard<std::mutex> lck(mtx);
+    Command c;
+    c.move = false;
+    c.start = start;
+    c.number = this->dispatch();
+    cmd.set(c);
     this->last = start;
-    this->finished = true;
+    this->finish(c.number);
   }
   
   /**
@@ -278,18 +256,22 @@ class PathPlannerConstAcc : public TrajectoryGenerator<T, 3> {
   
  private:
   Output<T> posOut, velOut, accOut;
-  bool finished;
-  int range;
+  // state of the block, only accessed by run()
+  std::array<T, 3> state;
+  bool active;
+  unsigned int number;
+  unsigned int segment, period;
   T velMax, acc, dec;
-  double t, dt, dT1, dT2, dT3;
-  // naming of coefficients: a|b|c & 1|2|3 & a|v|p
-  // a|b|c : a for t*t factor, b for linear factor, c for constant
-  // 1|2|3 : one of the three parts on the time axis
-  // a|v|p : result will be a for acc, v for vel, p for position
-  // e.g. a1p -> coeffizient for time intervall 1, used to multiply with t^2 resulting in the position
-  T a1p, c1p, b1v, c1a, b2p, c2p, c2v, c2a, a3p, b3p, c3p, b3v, c3v, c3a; 
-  T endPos;
-  std::mutex mtx;
+  double dt;
+  using Table = TrajectoryTable<T, 3>;
+  struct Command {
+    bool move;                // false: only set the start state
+    unsigned int number;      // see TrajectoryGenerator::dispatch()
+    std::array<T, 3> start;
+    Table table;
+    T endPos;
+  };
+  Parameter<Command> cmd;
 };
 
 /**
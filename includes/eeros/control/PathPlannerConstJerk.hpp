@@ -2,10 +2,11 @@
 #define ORG_EEROS_CONTROL_PATHPLANNERCONSTJERK_HPP_
 
 #include <eeros/control/Output.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/control/TrajectoryGenerator.hpp>
+#include <eeros/control/TrajectoryTable.hpp>
 #include <eeros/core/System.hpp>
 #include <cmath>
-#include <mutex>
 
 namespace eeros {
 namespace control {
@@ -18,6 +19,7 @@ namespace control {
  * This causes the velocity to reach its maximum value which can be chosen. 
  * Towards the end the procedure is repeated with a negative jerk followed by a positive jerk.
  * This ensures that the final position is reached with the velocity reaching 0. 
+ * A new trajectory is passed to the block without locking, see \ref Parameter.
  * 
  * @tparam T - output type (must be a composite type), 
  *             a trajectory in 3-dimensional space needs T = Matrix<3,1,double>, 
@@ -45,7 +47,8 @@ class PathPlannerConstJerk : public TrajectoryGenerator<T, 4> {
    * @param dt - sampling time
    */
   PathPlannerConstJerk(T velMax, T jerk, double dt) 
-      : finished(true), velMax(velMax), jerk(jerk), dt(dt) {
+      : posOut(this), velOut(this), accOut(this), jerkOut(this), active(false), number(0), segment(0), period(0), velMax(velMax), jerk(jerk), dt(dt) {
+    for (auto& e : state) e = 0;
     posOut.getSignal().clear();
     velOut.getSignal().clear();
     accOut.getSignal().clear();
@@ -63,105 +66,52 @@ class PathPlannerConstJerk : public TrajectoryGenerator<T, 4> {
    * @return - end of trajectory is reached
    */
   virtual bool endReached() {
-    std::lock_guard<std::mutex> lck(mtx);
-    return finished;
+    return this->allFinished();
   }
   
   /**
-   * Runs the path planner block. With the precalculated values for the 
-   * acceleration for all sampling points on the trajectory, the resulting velocities
-   * and positions are calculated and written to the appropriate outputs.
+   * Runs the path planner block. The trajectory was converted to a table of polynomials
+   * by \ref move(), each run evaluates the current segment for all axes and counts the
+   * sampling periods to advance to the next segment.
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lck(mtx);
-    std::array<T, 4> y = this->last;
-    t += dt;
+    if (cmd.update()) {
+      const Command& c = cmd.value();
+      if (c.move) {
+        number = c.number;
+        segment = 0;
+        period = 0;
+        active = true;
+      } else {
+        state = c.start;
+        active = false;
+      }
+    }
     
-    if (!finished) {
-      for (unsigned int i = 0; i < a1p.size(); i++) {
-        switch (range) {
-          case 1:
-            if (t <= dT1) {
-              y[0][i] = a1p[i] * pow(t,3) + d1p[i];
-              y[1][i] = b1v[i] * pow(t,2);
-              y[2][i] = c1a[i] * t;
-              y[3][i] = d1j[i];
-            } 
-            if (fabs(t - dT1) < 1e-12 && i == a1p.size() - 1) {
-              range = 2;
-              t = 0;
-            }
-            break;
-          case 2:
-            if (t <= dT1) {
-              y[0][i] = a2p[i] * pow(t,3) + b2p[i] * pow(t,2) + c2p[i] * t + d2p[i];
-              y[1][i] = b2v[i] * pow(t,2) + c2v[i] * t + d2v[i];
-              y[2][i] = c2a[i] * t + d2a[i];
-              y[3][i] = d2j[i];
-            }
-            if (fabs(t - dT1) < 1e-12 && i == a1p.size() - 1) {
-              range = 3;
-              t = 0;
-            }
-            break;
-          case 3:
-            if (t <= dT2) {
-              y[0][i] = c3p[i] * t + d3p[i];
-              y[1][i] = d3v[i];
-              y[2][i] = 0;
-              y[3][i] = 0;
-            }
-            if (fabs(t - dT2) < 1e-12 && i == a1p.size() - 1) {
-              range = 4;
-              t = 0;
-            }
-            break;
-          case 4:
-            if (t <= dT1) {
-              y[0][i] = a4p[i] * pow(t,3) + c4p[i] * t + d4p[i];
-              y[1][i] = b4v[i] * pow(t,2) + d4v[i];
-              y[2][i] = c4a[i] * t;
-              y[3][i] = d4j[i];
-            } 
-            if (fabs(t - dT1) < 1e-12 && i == a1p.size() - 1) {
-              range = 5;
-              t = 0;
-            }
-            break;
-          case 5:
-            if (t <= dT1) {
-              y[0][i] = a5p[i] * pow(t,3) + b5p[i] * pow(t,2) + c5p[i] * t + d5p[i];
-              y[1][i] = b5v[i] * pow(t,2) + c5v[i] * t + d5v[i];
-              y[2][i] = c5a[i] * t + d5a[i];
-              y[3][i] = d5j[i];
-            }
-            if (fabs(t - dT1) < 1e-12 && i == a1p.size() - 1) {
-              range = 6;
-              t = 0;
-            }
-            break;
-          case 6:
-            finished = true;
-            y[0][i] = endPos[i];
-            y[1][i] = 0.0;
-            y[2][i] = 0.0;
-            y[3][i] = 0.0;
-            break;
+    if (active) {
+      const Command& c = cmd.value();
+      if (segment < c.table.size()) {
+        c.table.evaluate(segment, ++period * dt, state);
+        if (period == c.table.getPeriods(segment)) {
+          segment++;
+          period = 0;
         }
-        // keep last position value
-        this->last[0][i] = y[0][i];
-        this->last[1][i] = y[1][i];
-        this->last[2][i] = y[2][i];
-        this->last[3][i] = y[3][i];
+      } else {
+        state[0] = c.endPos;
+        state[1] = 0;
+        state[2] = 0;
+        state[3] = 0;
+        active = false;
+        this->finish(number);
       }
     }
 
-    posOut.getSignal().setValue(y[0]);
-    velOut.getSignal().setValue(y[1]);
-    accOut.getSignal().setValue(y[2]);
-    jerkOut.getSignal().setValue(y[3]);
+    posOut.getSignal().setValue(state[0]);
+    velOut.getSignal().setValue(state[1]);
+    accOut.getSignal().setValue(state[2]);
+    jerkOut.getSignal().setValue(state[3]);
 
-    timestamp_t time = System::getTimeNs(); 
+    timestamp_t time = System::getCycleTimeNs(); 
     posOut.getSignal().setTimestamp(time);
     velOut.getSignal().setTimestamp(time);
     accOut.getSignal().setTimestamp(time);
@@ -185,11 +135,12 @@ class PathPlannerConstJerk : public TrajectoryGenerator<T, 4> {
    * @see run()
    */
   virtual bool move(std::array<T, 4> start, std::array<T, 4> end) {
-    if (!finished) return false;
+    if (!endReached()) return false;
+    Command c;
     T calcVelNorm, calcJerkNorm;
     E velNorm, jerkNorm;
     T distance = end[0] - start[0];
-    endPos = end[0];
+    c.endPos = end[0];
    
     T zero; zero = 0;
     if (distance == zero) return false;
@@ -212,62 +163,38 @@ class PathPlannerConstJerk : public TrajectoryGenerator<T, 4> {
     if (velNorm > velNormMax) velNorm = velNormMax; 
     
     // calculate time intervals    
-    dT1 = sqrt(velNorm / jerkNorm);
-    dT2 = 1 / velNorm - 4 * dT1 * 0.5;
+    double dT1 = sqrt(velNorm / jerkNorm);
+    double dT2 = 1 / velNorm - 4 * dT1 * 0.5;
     if (dT2 < 0) dT2 = 0;
     
     // make time intervals multiple of sampling time
-    dT1 = ceil(dT1 / dt) * dt;
-    dT2 = ceil(dT2 / dt) * dt;
-//    log.info() << "dT1 = " << dT1 << ", dT2 = " << dT2 << ", total time = " << (4 * dT1 + dT2);
+    unsigned int n1 = Table::periods(dT1, dt);
+    unsigned int n2 = Table::periods(dT2, dt);
+    dT1 = n1 * dt;
+    dT2 = n2 * dt;
     
     // recalculate velocity with definitive time interval values
     velNorm = 1 / (dT2 + 4 * dT1 * 0.5);
     
-    d1j = velNorm * distance / pow(dT1,2);
-    c1a = d1j;
-    b1v = d1j / 2;
-    a1p = d1j / 6;
-    d1p = start[0];
-
-    d2j = -d1j;
-    c2a = -d1j;
-    d2a = d1j * dT1;
-    b2v = -d1j / 2;
-    c2v = d1j * dT1;
-    d2v = d1j / 2 * pow(dT1,2);
-    a2p = -d1j / 6;
-    b2p = d1j / 2 * dT1;
-    c2p = d1j / 2 * pow(dT1,2);
-    d2p = d1j / 6 * pow(dT1,3) + d1p;
-
-    d3v = d1j * pow(dT1,2);
-    c3p = d1j * pow(dT1,2);
-    d3p = d1j * pow(dT1,3) + d1p;
-      
-    d4j = -d1j;
-    c4a = -d1j;
-    b4v = -d1j / 2;
-    d4v = d1j * pow(dT1,2);
-    a4p = -d1j / 6;
-    c4p = d1j * pow(dT1,2);
-    d4p = d1j * (pow(dT1,2) * dT2 + pow(dT1,3)) + d1p;
-    
-    d5j = d1j;
-    c5a = d1j;
-    d5a = -d1j * dT1;
-    b5v = d1j / 2;
-    c5v = -d1j * dT1;
-    d5v = d1j / 2 * pow(dT1,2);
-    a5p = d1j / 6;
-    b5p = -d1j / 2 * dT1;
-    c5p = d1j / 2 * pow(dT1,2);
-    d5p = d1j * (pow(dT1,2) * dT2 + 11.0 / 6 * pow(dT1,3)) + d1p;
+    // position polynomials of the five parts, p(t) = c0 + c1 * t + c2 * t^2 + c3 * t^3
+    T j = velNorm * distance / (dT1 * dT1);
+    T p2 = j / 6 * (dT1 * dT1 * dT1) + start[0];
+    T p3 = j * (dT1 * dT1 * dT1) + start[0];
+    T p4 = j * (dT1 * dT1 * dT2 + dT1 * dT1 * dT1) + start[0];
+    T p5 = j * (dT1 * dT1 * dT2 + 11.0 / 6 * (dT1 * dT1 * dT1)) + start[0];
+    T v = j * (dT1 * dT1);
+    c.table.clear();
+    c.table.add(n1, start[0], zero, zero, j / 6);
+    c.table.add(n1, p2, v / 2, j / 2 * dT1, -j / 6);
+    c.table.add(n2, p3, v, zero, zero);
+    c.table.add(n1, p4, v, zero, -j / 6);
+    c.table.add(n1, p5, v / 2, -j / 2 * dT1, j / 6);
     
-    std::lock_guard<std::mutex> lck(mtx);
-    finished = false;
-    range = 1;
-    t = 0;  
+    c.move = true;
+    c.number = this->dispatch();
+    cmd.set(c);
+    this->last = end;
+    for (unsigned int i = 1; i < end.size(); i++) this->last[i] = 0;
     return true;
   }
   
@@ -279,9 +206,13 @@ class PathPlannerConstJerk : public TrajectoryGenerator<T, 4> {
    * @param start - array containing start position and its higher derivatives
    */
   virtual void setStart(std::array<T, 4> start) {
-    std::lock_guard<std::mutex> lck(mtx);
+    Command c;
+    c.move = false;
+    c.start = start;
+    c.number = this->dispatch();
+    cmd.set(c);
     this->last = start;
-    this->finished = true;
+    this->finish(c.number);
   }
   
   /**
@@ -328,22 +259,22 @@ class PathPlannerConstJerk : public TrajectoryGenerator<T, 4> {
 
  private:
   Output<T> posOut, velOut, accOut, jerkOut;
-  bool finished;
-  int range;
+  // state of the block, only accessed by run()
+  std::array<T, 4> state;
+  bool active;
+  unsigned int number;
+  unsigned int segment, period;
   T velMax, jerk;
-  double t, dt, dT1, dT2;
-  // naming of coefficients: a|b|c & 1|2|3 & a|v|p
-  // a|b|c|d : a for jerk, b for acc, c for vel, d for position
-  // 1|2|3|4|5 : one of the three parts on the time axis
-  // j|a|v|p : j for jerk, a for acc, v for vel, p for position
-  // e.g. a1p -> coeffizient for time intervall 1, used to multiply with t^2 resulting in the position
-  T a1p, d1p, b1v, c1a, d1j, 
-    a2p, b2p, c2p, d2p, b2v, c2v, d2v, c2a, d2a, d2j, 
-    c3p, d3p, d3v,
-    a4p, c4p, d4p, b4v, d4v, c4a, d4j,
-    a5p, b5p, c5p, d5p, b5v, c5v, d5v, c5a, d5a, d5j; 
-  T endPos;
-  std::mutex mtx;
+  double dt;
+  using Table = TrajectoryTable<T, 5>;
+  struct Command {
+    bool move;                // false: only set the start state
+    unsigned int number;      // see TrajectoryGenerator::dispatch()
+    std::array<T, 4> start;
+    Table table;
+    T endPos;
+  };
+  Parameter<Command> cmd;
 };
 
 /**
@@ -3,13 +3,16 @@
 
 #include <eeros/control/Block.hpp>
 #include <eeros/control/Output.hpp>
+#include <eeros/control/Parameter.hpp>
+#include <eeros/control/TrajectoryFile.hpp>
 #include <eeros/math/Matrix.hpp>
 #include <eeros/core/System.hpp>
+#include <eeros/core/Fault.hpp>
 #include <iostream>
-#include <fstream>
-#include <unistd.h>
-#include <mutex>
 #include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
 
 namespace eeros {
 namespace control {
@@ -23,6 +26,9 @@ namespace control {
  * from the last interval.
  * The trajectory may be scaled in time and jerk in order to achieve a positional change
  * within a given time interval.
+ * A new trajectory is passed to the block without locking, see \ref Parameter.
+ * The block keeps a cursor on the current segment, a trajectory can be restarted at
+ * any time with \ref seek().
  * 
  * @since v1.0
  */
@@ -34,12 +40,12 @@ class PathPlannerCubic: public Block {
    *
    * @param dt - sampling time
    */
-  PathPlannerCubic(double dt) : posOut(this), velOut(this), accOut(this), jerkOut(this), dt(dt), interval(-dt) {
+  PathPlannerCubic(double dt) : posOut(this), velOut(this), accOut(this), jerkOut(this), dt(dt), number(0), index(0), begin(0), sample(0) {
     posOut.getSignal().clear();
     velOut.getSignal().clear();
     accOut.getSignal().clear();
     jerkOut.getSignal().clear();
-    prevPos = 0; prevVel = 0; prevAcc = 0;
+    pos = 0; vel = 0; acc = 0; jerk = 0;
   }
   
   /**
@@ -48,97 +54,56 @@ class PathPlannerCubic: public Block {
   PathPlannerCubic(const PathPlannerCubic& s) = delete; 
 
   /**
-   * Choose a file which holds a trajectory. 
+   * Choose a file which holds a trajectory. The file can be in text or binary format,
+   * binary files are mapped into memory, see \ref TrajectoryFile.
    * 
    * @param filename - name of the trajectory file
    */
   virtual void init(std::string filename) {
-    std::ifstream file;       
-    file.open(filename.c_str());   
-    if (!file.is_open()) throw Fault("File for loading trajectory cannot be opened");
-    clear();
-    while(!file.eof()) {
-      std::string tmp_string;
-      double tmp_double;
-      
-      // time
-      file >> tmp_string;
-      tmp_double = ::atof(tmp_string.c_str());
-      if (tmp_string.empty()) break;
-      timeCoeffRaw.push_back(tmp_double);
-      
-      // jerk
-      file >> tmp_string;
-      tmp_double = ::atof(tmp_string.c_str());
-      jerkCoeffRaw.push_back(tmp_double);
-      
-      // acc
-      file >> tmp_string;
-      tmp_double = ::atof(tmp_string.c_str());
-      accCoeffRaw.push_back(tmp_double);
-      
-      // vel
-      file >> tmp_string;
-      tmp_double = ::atof(tmp_string.c_str());
-      velCoeffRaw.push_back(tmp_double);
-      
-      // pos
-      file >> tmp_string;
-      tmp_double = ::atof(tmp_string.c_str());
-      posCoeffRaw.push_back(tmp_double);
-    }
+    raw = std::make_shared<const TrajectoryFile>(filename);
   }
   
   /**
-   * Runs the path planner block.
+   * Runs the path planner block. A cursor points to the current segment and advances
+   * by one segment at the end of each segment. The outputs are evaluated from the
+   * values at the beginning of the segment.
    */
   virtual void run() {
-    double pos, vel, acc, jerk;
-    
-    std::lock_guard<std::mutex> guard(m);
-    if (!finished && timeCoeff.size() > 0 && index < timeCoeff.size()) {
-      if (t <= interval + (dt / 2)) {
-        jerk = jerkCoeff[index];
-        acc = prevAcc + jerk * dt;
-        vel = prevVel + prevAcc * dt + jerk / 2 * dt * dt;
-        pos = prevPos + prevVel * dt + prevAcc / 2 * dt * dt + jerk / 6 * dt * dt * dt;
-      } else {
-        if (first) {index = 0; interval = timeCoeff[index]; first = false;}
-        else {
-          index++;
-          if (index == timeCoeff.size()) {
-            finished = true;
-            return;
-          }
-          interval += timeCoeff[index];
+    // a trajectory is published before finished is cleared
+    bool finished = this->finished.load(std::memory_order_acquire);
+    path.update();
+    const Path& p = path.value();
+    if (!finished && p.file) {
+      const TrajectoryFile& f = *p.file;
+      if (p.number != number) {
+        number = p.number;
+        if (!locate(f, p.start)) {
+          this->finished = true;
+          return;
         }
-        jerk = jerkCoeff[index];
-        acc  = accCoeff[index];
-        vel  = velCoeff[index];
-        pos  = posCoeff[index];
       }
-    } else {
-      t = 0;
-      index = 0;
-      interval = -dt;
-      first = true;
-      pos = prevPos;
-      vel = prevVel;
-      acc = prevAcc;
-      jerk = prevJerk;
+      if (sample * dt > f[index].end + dt / 2) {
+        if (++index == f.size()) {
+          this->finished = true;
+          return;
+        }
+        begin = sample;
+      }
+      const TrajectoryFile::Segment& s = f[index];
+      double t = (sample - begin) * dt;
+      jerk = s.jerk;
+      acc = s.acc + jerk * t;
+      vel = s.vel + (s.acc + jerk / 2 * t) * t;
+      pos = p.offset + s.pos + (s.vel + (s.acc / 2 + jerk / 6 * t) * t) * t;
+      sample++;
     }
-    t += dt;
-    prevPos = pos;
-    prevVel = vel;
-    prevAcc = acc;
-    prevJerk = jerk;
     
     posOut.getSignal().setValue(pos);
     velOut.getSignal().setValue(vel);
     accOut.getSignal().setValue(acc);
     jerkOut.getSignal().setValue(jerk);
     
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = System::getCycleTimeNs();
     posOut.getSignal().setTimestamp(time);
     velOut.getSignal().setTimestamp(time);
     accOut.getSignal().setTimestamp(time);
@@ -148,7 +113,8 @@ class PathPlannerCubic: public Block {
   /**
    * Dispatches a new trajectory. The trajectory is taken from the path file and scaled 
    * so that it moves the distance given by deltaPos within the desired time. The position 
-   * values are further shifted by startPos. 
+   * values are further shifted by startPos. The scaled trajectory is calculated by the
+   * caller, the block only receives the result.
    * 
    * @param time - total time for the trajectory to run
    * @param startPos - start position from where the trajectory will set off
@@ -159,12 +125,8 @@ class PathPlannerCubic: public Block {
    */
   virtual bool move(double time, double startPos, double deltaPos) {
     if (!finished) return false;
-    if (timeCoeffRaw.size() <= 0) throw Fault("Path planner: time coeff array empty"); 
-    
-    scalePath(time, deltaPos); 
-    
-    for (std::size_t i = 0; i < posCoeff.size(); i++) posCoeff[i] += startPos;  // set start position
-    finished = false;
+    if (!raw || raw->size() <= 0) throw Fault("Path planner: time coeff array empty"); 
+    dispatch(scalePath(time, deltaPos), startPos, 0);
     return true;
   }
   
@@ -180,20 +142,22 @@ class PathPlannerCubic: public Block {
    */
   virtual bool move(double startPos) {
     if (!finished) return false;
-    if (timeCoeffRaw.size() <= 0) throw Fault("Path planner: time coeff array empty"); 
-    timeCoeff.resize(timeCoeffRaw.size());
-    jerkCoeff.resize(timeCoeffRaw.size());
-    accCoeff.resize(timeCoeffRaw.size());
-    velCoeff.resize(timeCoeffRaw.size());
-    posCoeff.resize(timeCoeffRaw.size());
-    for (std::size_t i = 0; i < timeCoeffRaw.size(); i++) {
-      timeCoeff[i] = timeCoeffRaw[i];
-      jerkCoeff[i] = jerkCoeffRaw[i];
-      accCoeff[i] = accCoeffRaw[i];
-      velCoeff[i] = velCoeffRaw[i];
-      posCoeff[i] = posCoeffRaw[i] + startPos;  // set start position
-    }
-    finished = false;
+    if (!raw || raw->size() <= 0) throw Fault("Path planner: time coeff array empty"); 
+    dispatch(raw, startPos, 0);
+    return true;
+  }
+  
+  /**
+   * Restarts the last dispatched trajectory at a given time, whether it is still running 
+   * or has already ended. The segment at this time is found with a binary search.
+   * 
+   * @param time - time relative to the start of the trajectory
+   * @return - the trajectory could be successfully restarted
+   */
+  virtual bool seek(double time) {
+    Path p = path.get();
+    if (!p.file || time < 0 || time > (*p.file)[p.file->size() - 1].end) return false;
+    dispatch(p.file, p.offset, time);
     return true;
   }
   
@@ -241,78 +205,78 @@ class PathPlannerCubic: public Block {
   virtual Output<>& getJerkOut() {return jerkOut;}
   
  private:
-  void clear() {
-    timeCoeffRaw.clear();
-    jerkCoeffRaw.clear();
-    accCoeffRaw.clear();
-    velCoeffRaw.clear();
-    posCoeffRaw.clear();
-    timeCoeff.clear();
-    jerkCoeff.clear();
-    accCoeff.clear();
-    velCoeff.clear();
-    posCoeff.clear();
+  // the segments are shared and only released by writers, never by run()
+  struct Path {
+    std::shared_ptr<const TrajectoryFile> file;
+    double offset = 0;      // added to all positions
+    double start = 0;       // start time within the trajectory
+    unsigned int number = 0;
+  };
+
+  void dispatch(std::shared_ptr<const TrajectoryFile> file, double offset, double start) {
+    path.modify([&](Path& p) {
+      p.file = std::move(file);
+      p.offset = offset;
+      p.start = start;
+      p.number++;
+    });
+    finished.store(false, std::memory_order_release);
+  }
+  
+  // positions the cursor on the sample closest to time
+  bool locate(const TrajectoryFile& f, double time) {
+    sample = static_cast<std::size_t>(std::round(time / dt));
+    index = f.find(sample * dt - dt / 2);
+    if (index >= f.size()) return false;
+    begin = index == 0 ? 0 : static_cast<std::size_t>(std::floor((f[index - 1].end + dt / 2) / dt)) + 1;
+    return true;
   }
     
-  void scalePath(double time, double deltaPos) {
-    std::vector<double> timeRounded, jerkRounded;
+  std::shared_ptr<const TrajectoryFile> scalePath(double time, double deltaPos) {
+    const TrajectoryFile& r = *raw;
+    std::size_t tabSize = r.size();
+    std::vector<TrajectoryFile::Segment> s(tabSize);
     
     // Get total time of curve
-    double tabSize = timeCoeffRaw.size();
-    double timeTotal = 0.0;
-    for (int i = 0; i < tabSize; i++) timeTotal = timeTotal + timeCoeffRaw[i];
+    double timeTotal = r[tabSize - 1].end;
     
     // Scale time vector and round to multiple of sampling time
     double timeScale = time / timeTotal;
-    for (int i = 0; i < tabSize; i++) 
-      timeRounded.push_back(round(timeCoeffRaw[i] * timeScale / dt) * dt);
-    
-    // Get total time of rounded time spans
     double timeTotalRounded = 0.0;
-    for (int i = 0; i < tabSize; i++) timeTotalRounded = timeTotalRounded + timeRounded[i];
+    for (std::size_t i = 0; i < tabSize; i++) {
+      s[i].duration = round(r[i].duration * timeScale / dt) * dt;
+      timeTotalRounded += s[i].duration;
+    }
     timeScale = timeTotalRounded / timeTotal;
 
     // Scale jerk according to scaled time and scaled position
-    double posScale  = deltaPos / posCoeffRaw[tabSize-1];
-    for(int i = 0; i < tabSize; i++) 
-      jerkRounded.push_back(jerkCoeffRaw[i] * posScale / (timeScale*timeScale*timeScale));
+    double posScale = deltaPos / r[tabSize - 1].pos;
+    for (std::size_t i = 0; i < tabSize; i++) 
+      s[i].jerk = r[i].jerk * posScale / (timeScale * timeScale * timeScale);
       
     // Scale acc, vel and pos coefficients
-    std::vector<double> accRounded, velRounded, posRounded;
-    accRounded.resize(jerkRounded.size());
-    velRounded.resize(jerkRounded.size());
-    posRounded.resize(jerkRounded.size());
-    double acc_prev = 0.0; accRounded[0] = acc_prev;
-    double vel_prev = 0.0; velRounded[0] = vel_prev;
-    double pos_prev = 0.0; posRounded[0] = pos_prev;
-    for (int i = 1; i < tabSize; i++) {
-      double t = timeRounded[i-1];
-      double j = jerkRounded[i-1];
-      accRounded[i] = acc_prev + j * t;
-      velRounded[i] = vel_prev + acc_prev * t + j * t * t / 2;
-      posRounded[i] = pos_prev + vel_prev * t + acc_prev * t * t / 2 + j * t * t * t / 6;
-      acc_prev = accRounded[i];
-      vel_prev = velRounded[i];
-      pos_prev = posRounded[i];
+    s[0].acc = 0.0;
+    s[0].vel = 0.0;
+    s[0].pos = 0.0;
+    for (std::size_t i = 1; i < tabSize; i++) {
+      double t = s[i-1].duration;
+      double j = s[i-1].jerk;
+      s[i].acc = s[i-1].acc + j * t;
+      s[i].vel = s[i-1].vel + s[i-1].acc * t + j * t * t / 2;
+      s[i].pos = s[i-1].pos + s[i-1].vel * t + s[i-1].acc * t * t / 2 + j * t * t * t / 6;
     }
-    
-    std::lock_guard<std::mutex> guard(m);
-    timeCoeff = timeRounded;
-    jerkCoeff = jerkRounded;
-    accCoeff = accRounded;
-    velCoeff = velRounded;
-    posCoeff = posRounded;
+    return std::make_shared<const TrajectoryFile>(std::move(s));
   }
   
   Output<> posOut, velOut, accOut, jerkOut; 
-  bool finished = true;
-  double dt, interval, t;
-  std::size_t index = 0;
-  bool first = true;
-  double prevJerk, prevAcc, prevVel, prevPos;
-  std::vector<double> timeCoeffRaw, jerkCoeffRaw, accCoeffRaw, velCoeffRaw, posCoeffRaw;
-  std::vector<double> timeCoeff, jerkCoeff, accCoeff, velCoeff, posCoeff;
-  std::mutex m;
+  std::atomic<bool> finished{true};
+  double dt;
+  // state of the block, only accessed by run()
+  unsigned int number;
+  std::size_t index, begin, sample;
+  double jerk, acc, vel, pos;
+  std::shared_ptr<const TrajectoryFile> raw;
+  Parameter<Path> path;
 };
 
 /**
@@ -0,0 +1,476 @@
+#ifndef ORG_EEROS_CONTROL_PATHPLANNERONLINE_HPP_
+#define ORG_EEROS_CONTROL_PATHPLANNERONLINE_HPP_
+
+#include <eeros/control/Output.hpp>
+#include <eeros/control/Parameter.hpp>
+#include <eeros/control/TrajectoryGenerator.hpp>
+#include <eeros/core/System.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace eeros {
+namespace control {
+
+/**
+ * This path planner generates jerk limited trajectories online. Whenever the target or
+ * the limits change, the trajectory is planned anew in \ref run() from the current
+ * position, velocity and acceleration, so a target may change at any time, even in every
+ * sampling period, without stopping the motion.
+ *
+ * Each axis follows a profile of seven phases with constant jerk: the velocity is changed
+ * to a peak velocity with at most the maximum acceleration, held, and changed to 0 again.
+ * The peak velocity is the maximum velocity or, for short distances, is found by regula falsi
+ * so that the target is reached without cruising. The axes are synchronized in time by
+ * lowering the peak velocity of all axes but the slowest one, found the same way.
+ * Planning takes a bounded number of iterations per axis and never allocates memory.
+ * The target is reached with velocity and acceleration 0.
+ *
+ * A new target is passed to the block without locking, see \ref Parameter.
+ *
+ * @tparam T - output type (must be a composite type),
+ *             a trajectory in 3-dimensional space needs T = Matrix<3,1,double>,
+ *             a trajectory in linear space needs T = Matrix<1,1,double>
+ *
+ * @since v1.4
+ */
+
+template<typename T>
+class PathPlannerOnline : public TrajectoryGenerator<T, 4> {
+  using E = typename T::value_type;
+
+ public:
+  /**
+   * Constructs an online path planner. The maximum values must be greater than 0.
+   * The sampling time must be set to the time with which the timedomain containing this block will run.
+   *
+   * @param velMax - maximum velocity
+   * @param accMax - maximum acceleration
+   * @param jerkMax - maximum jerk
+   * @param dt - sampling time
+   */
+  PathPlannerOnline(T velMax, T accMax, T jerkMax, double dt)
+      : posOut(this), velOut(this), accOut(this), jerkOut(this), active(false), number(0), period(0), duration(0), dt(dt) {
+    for (auto& e : state) e = 0;
+    posOut.getSignal().clear();
+    velOut.getSignal().clear();
+    accOut.getSignal().clear();
+    jerkOut.getSignal().clear();
+    cmd.modify([&](Command& c) {
+      c.velMax = velMax;
+      c.accMax = accMax;
+      c.jerkMax = jerkMax;
+      c.target = 0;
+      c.reset = false;
+      c.number = 0;
+    });
+  }
+
+  /**
+   * Disabling use of copy constructor because the block should never be copied unintentionally.
+   */
+  PathPlannerOnline(const PathPlannerOnline& s) = delete;
+
+  /**
+   * Query if the last target has been reached.
+   *
+   * @return - end of trajectory is reached
+   */
+  virtual bool endReached() {
+    return this->allFinished();
+  }
+
+  /**
+   * Runs the path planner block. If a new target or new limits were set, the trajectory is
+   * planned from the current state. The outputs are evaluated from the planned phases.
+   */
+  virtual void run() {
+    if (cmd.update()) {
+      const Command& c = cmd.value();
+      if (c.reset) state = c.start;
+      number = c.number;
+      target = c.target;
+      plan(c);
+      period = 0;
+      active = true;
+    }
+
+    if (active) {
+      double t = ++period * dt;
+      if (t >= duration) {
+        state[0] = target;
+        state[1] = 0;
+        state[2] = 0;
+        state[3] = 0;
+        active = false;
+        this->finish(number);
+      } else {
+        evaluate(t);
+      }
+    }
+
+    posOut.getSignal().setValue(state[0]);
+    velOut.getSignal().setValue(state[1]);
+    accOut.getSignal().setValue(state[2]);
+    jerkOut.getSignal().setValue(state[3]);
+
+    timestamp_t time = System::getCycleTimeNs();
+    posOut.getSignal().setTimestamp(time);
+    velOut.getSignal().setTimestamp(time);
+    accOut.getSignal().setTimestamp(time);
+    jerkOut.getSignal().setTimestamp(time);
+  }
+
+  using TrajectoryGenerator<T, 4>::move;
+
+  /**
+   * Dispatches a new trajectory from start to end. The current state is replaced by start,
+   * which may include velocity and acceleration. Of the end state only the position
+   * is considered.
+   *
+   * @param start - array containing start position and its higher derivatives
+   * @param end - array containing end position and its higher derivatives
+   * @return - always true
+   *
+   * @see setTarget()
+   */
+  virtual bool move(std::array<T, 4> start, std::array<T, 4> end) {
+    cmd.modify([&](Command& c) {
+      c.reset = true;
+      c.start = start;
+      c.target = end[0];
+      c.number = this->dispatch();
+    });
+    setLast(end[0]);
+    return true;
+  }
+
+  /**
+   * Sets a new target. The trajectory continues from the current state.
+   *
+   * @param end - end position
+   * @return - always true
+   */
+  virtual bool move(T end) {
+    setTarget(end);
+    return true;
+  }
+
+  /**
+   * Sets a new target. The trajectory continues from the current state.
+   * Of the end state only the position is considered.
+   *
+   * @param end - array containing end position and its higher derivatives
+   * @return - always true
+   */
+  virtual bool move(std::array<T, 4> end) {
+    setTarget(end[0]);
+    return true;
+  }
+
+  /**
+   * Sets a new target. The trajectory continues from the current state,
+   * the motion does not stop.
+   *
+   * @param end - end position
+   */
+  virtual void setTarget(T end) {
+    cmd.modify([&](Command& c) {
+      c.reset = false;
+      c.target = end;
+      c.number = this->dispatch();
+    });
+    setLast(end);
+  }
+
+  using TrajectoryGenerator<T, 4>::setStart;
+
+  /**
+   * Sets the start position and state of the higher derivatives (velocity, acceleration ...)
+   * The start position becomes the target.
+   *
+   * @param start - array containing start position and its higher derivatives
+   */
+  virtual void setStart(std::array<T, 4> start) {
+    cmd.modify([&](Command& c) {
+      c.reset = true;
+      c.start = start;
+      c.target = start[0];
+      c.number = this->dispatch();
+    });
+    setLast(start[0]);
+  }
+
+  /**
+   * Sets the maximum velocity. A running trajectory is planned anew.
+   *
+   * @param max - maximum velocity
+   */
+  virtual void setMaxVel(T max) {
+    cmd.modify([&](Command& c) { c.velMax = max; c.reset = false; c.number = this->dispatch(); });
+  }
+
+  /**
+   * Sets the maximum acceleration. A running trajectory is planned anew.
+   *
+   * @param max - maximum acceleration
+   */
+  virtual void setMaxAcc(T max) {
+    cmd.modify([&](Command& c) { c.accMax = max; c.reset = false; c.number = this->dispatch(); });
+  }
+
+  /**
+   * Sets the maximum jerk. A running trajectory is planned anew.
+   *
+   * @param max - maximum jerk
+   */
+  virtual void setMaxJerk(T max) {
+    cmd.modify([&](Command& c) { c.jerkMax = max; c.reset = false; c.number = this->dispatch(); });
+  }
+
+  /**
+   * Returns the duration of the trajectory planned last.
+   * Must only be called by the thread running the block.
+   *
+   * @return duration in s
+   */
+  virtual double getDuration() const {return duration;}
+
+  /**
+   * Getter function for the position output.
+   *
+   * @return The position output
+   */
+  virtual Output<T>& getPosOut() {return posOut;}
+
+  /**
+   * Getter function for the velocity output.
+   *
+   * @return The velocity output
+   */
+  virtual Output<T>& getVelOut() {return velOut;}
+
+  /**
+   * Getter function for the acceleration output.
+   *
+   * @return The acceleration output
+   */
+  virtual Output<T>& getAccOut() {return accOut;}
+
+  /**
+   * Getter function for the jerk output.
+   *
+   * @return The jerk output
+   */
+  virtual Output<T>& getJerkOut() {return jerkOut;}
+
+ private:
+  static constexpr int phases = 7;
+  static constexpr int iterations = 60;  // maximum number of steps to find a peak velocity
+
+  struct Command {
+    bool reset;               // true: replace the current state by start
+    unsigned int number;      // see TrajectoryGenerator::dispatch()
+    std::array<T, 4> start;
+    T target;
+    T velMax, accMax, jerkMax;
+  };
+
+  // constant jerk phases of one axis
+  struct Phases {
+    E jerk[phases];
+    E time[phases];
+  };
+
+  static void integrate(E& p, E& v, E& a, E j, E t) {
+    p += t * (v + t * (a / 2 + t * j / 6));
+    v += t * (a + t * j / 2);
+    a += t * j;
+  }
+
+  static E sign(E x) {
+    return (x > 0) - (x < 0);
+  }
+
+  // three phases changing velocity v0 and acceleration a0 to velocity v1 and acceleration 0
+  static void change(E v0, E a0, E v1, E aMax, E jMax, E* jerk, E* time) {
+    E vr = v0 + a0 * std::fabs(a0) / (2 * jMax);  // velocity if a0 is reduced to 0 at once
+    E s = sign(v1 - vr);
+    E ap = a0, t2 = 0;
+    if (s != 0) {
+      ap = s * aMax;
+      E dv = (a0 + ap) / 2 * std::fabs(ap - a0) / jMax + ap / 2 * aMax / jMax;
+      t2 = (v1 - v0 - dv) / ap;
+      if (t2 < 0) {  // maximum acceleration is not reached
+        ap = s * std::sqrt(std::max(E(0), s * jMax * (v1 - v0) + a0 * a0 / 2));
+        t2 = 0;
+      }
+    }
+    jerk[0] = sign(ap - a0) * jMax; time[0] = std::fabs(ap - a0) / jMax;
+    jerk[1] = 0;                    time[1] = t2;
+    jerk[2] = -sign(ap) * jMax;     time[2] = std::fabs(ap) / jMax;
+  }
+
+  // distance and duration of a profile with peak velocity vp without cruising
+  static E travel(E v0, E a0, E vp, E aMax, E jMax, Phases& ph, E& time) {
+    change(v0, a0, vp, aMax, jMax, ph.jerk, ph.time);
+    ph.jerk[3] = 0; ph.time[3] = 0;
+    change(vp, 0, 0, aMax, jMax, ph.jerk + 4, ph.time + 4);
+    E p = 0, v = v0, a = a0;
+    time = 0;
+    for (int k = 0; k < phases; k++) {
+      integrate(p, v, a, ph.jerk[k], ph.time[k]);
+      time += ph.time[k];
+    }
+    return p;
+  }
+
+  // time optimal profile over a distance, returns its duration and peak velocity
+  static E optimal(E dist, E v0, E a0, E vMax, E aMax, E jMax, Phases& ph, E& vp) {
+    E time;
+    E dHi = travel(v0, a0, vMax, aMax, jMax, ph, time);
+    if (dist >= dHi) {
+      vp = vMax;
+      ph.time[3] = (dist - dHi) / vMax;
+      return time + ph.time[3];
+    }
+    E dLo = travel(v0, a0, -vMax, aMax, jMax, ph, time);
+    if (dist <= dLo) {
+      vp = -vMax;
+      ph.time[3] = (dLo - dist) / vMax;
+      return time + ph.time[3];
+    }
+    vp = solve([&](E v) { return travel(v0, a0, v, aMax, jMax, ph, time) - dist; },
+               -vMax, vMax, dLo - dist, dHi - dist, dist);
+    travel(v0, a0, vp, aMax, jMax, ph, time);
+    return time;
+  }
+
+  // profile over a distance with the given duration, found by lowering the peak velocity
+  static void synchronize(E dist, E v0, E a0, E vp, E aMax, E jMax, E total, Phases& ph) {
+    Phases p;
+    E time;
+    // the duration is almost linear in the inverse of the peak velocity
+    auto late = [&](E u) {
+      E d = travel(v0, a0, vp / u, aMax, jMax, p, time);
+      return time + (dist - d) * u / vp - total;
+    };
+    const E uMax = 1e9;
+    E fMax = late(uMax);
+    if (!(fMax > 0)) return;
+    E u = solve(late, 1, uMax, late(1), fMax, total);
+    E d = travel(v0, a0, vp / u, aMax, jMax, p, time);
+    p.time[3] = (dist - d) * u / vp;
+    if (p.time[3] >= 0) ph = p;
+  }
+
+  // root of f between lo and hi with the Illinois variant of regula falsi, f(lo) and f(hi) 
+  // must have different signs, stops when |f| is below 1e-12 * scale
+  template < typename F >
+  static E solve(F f, E lo, E hi, E fLo, E fHi, E scale) {
+    E tol = 1e-12 * std::max(E(1), std::fabs(scale));
+    int side = 0;
+    E x = lo;
+    for (int i = 0; i < iterations && hi - lo > tol * 1e-3; i++) {
+      x = (lo * fHi - hi * fLo) / (fHi - fLo);
+      if (!(x > lo && x < hi)) x = (lo + hi) / 2;
+      E fx = f(x);
+      if (std::fabs(fx) <= tol) break;
+      if ((fx < 0) == (fLo < 0)) {
+        lo = x; fLo = fx;
+        if (side == -1) fHi /= 2;
+        side = -1;
+      } else {
+        hi = x; fHi = fx;
+        if (side == 1) fLo /= 2;
+        side = 1;
+      }
+    }
+    return x;
+  }
+
+  void plan(const Command& c) {
+    for (int k = 0; k < 3; k++) start[k] = state[k];
+    T vp, time;
+    duration = 0;
+    for (unsigned int i = 0; i < target.size(); i++) {
+      Phases ph;
+      time[i] = optimal(target[i] - start[0][i], start[1][i], start[2][i], c.velMax[i], c.accMax[i], c.jerkMax[i], ph, vp[i]);
+      set(i, ph);
+      duration = std::max(duration, static_cast<double>(time[i]));
+    }
+    for (unsigned int i = 0; i < target.size(); i++) {
+      if (vp[i] == 0 || time[i] >= duration) continue;
+      Phases ph = get(i);
+      synchronize(target[i] - start[0][i], start[1][i], start[2][i], vp[i], c.accMax[i], c.jerkMax[i], duration, ph);
+      set(i, ph);
+    }
+  }
+
+  void evaluate(double t) {
+    for (unsigned int i = 0; i < target.size(); i++) {
+      E p = start[0][i], v = start[1][i], a = start[2][i], j = 0, r = t;
+      int k = 0;
+      for (; k < phases && r > 0; k++) {
+        E d = std::min(r, phaseTime[k][i]);
+        j = phaseJerk[k][i];
+        integrate(p, v, a, j, d);
+        r -= d;
+      }
+      if (r > 0) {  // axis has already arrived
+        p = target[i]; v = 0; a = 0; j = 0;
+      }
+      state[0][i] = p;
+      state[1][i] = v;
+      state[2][i] = a;
+      state[3][i] = j;
+    }
+  }
+
+  void set(unsigned int i, const Phases& ph) {
+    for (int k = 0; k < phases; k++) {
+      phaseJerk[k][i] = ph.jerk[k];
+      phaseTime[k][i] = ph.time[k];
+    }
+  }
+
+  Phases get(unsigned int i) const {
+    Phases ph;
+    for (int k = 0; k < phases; k++) {
+      ph.jerk[k] = phaseJerk[k][i];
+      ph.time[k] = phaseTime[k][i];
+    }
+    return ph;
+  }
+
+  void setLast(T end) {
+    this->last[0] = end;
+    for (unsigned int i = 1; i < this->last.size(); i++) this->last[i] = 0;
+  }
+
+  Output<T> posOut, velOut, accOut, jerkOut;
+  // state of the block, only accessed by run()
+  std::array<T, 4> state;
+  std::array<T, 3> start;                      // state at the beginning of the planned phases
+  std::array<T, phases> phaseJerk, phaseTime;  // phases of all axes
+  T target;
+  bool active;
+  unsigned int number, period;
+  double duration, dt;
+  Parameter<Command> cmd;
+};
+
+/**
+ * Operator overload (<<) to enable an easy way to print the state of a
+ * PathPlannerOnline instance to an output stream.\n
+ * Does not print a newline control character.
+ */
+template<typename T>
+std::ostream &operator<<(std::ostream &os, PathPlannerOnline<T> &pp) {
+  os << "Block path planner online: '" << pp.getName() << "'";
+  return os;
+}
+
+};
+};
+
+#endif /* ORG_EEROS_CONTROL_PATHPLANNERONLINE_HPP_ */
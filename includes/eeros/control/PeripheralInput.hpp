@@ -27,7 +27,7 @@ class PeripheralInput : public Blockio<0,1,T> {
    * @param id - name of the input
    * @param exclusive - if true, no other input can claim this input signal
    */
-  PeripheralInput(std::string id, bool exclusive = true) : hal(hal::HAL::instance()) {
+  PeripheralInput(std::string id, bool exclusive = true) : hal(hal::HAL::instance()), precise(false) {
     systemInput = dynamic_cast<eeros::hal::Input<T>*>(hal.getInput(id, exclusive));
     if(systemInput == nullptr) throw Fault("Peripheral input '" + id + "' not found!");
   }
@@ -42,7 +42,28 @@ class PeripheralInput : public Blockio<0,1,T> {
    */
   virtual void run() {
     this->out.getSignal().setValue(systemInput->get());
-    this->out.getSignal().setTimestamp(systemInput->getTimestamp());
+    this->out.getSignal().setTimestamp(precise ? System::getTimeNs() : systemInput->getTimestamp());
+  }
+
+  /**
+   * Returns the id of the input defined by the hardware configuration file.
+   *
+   * @return id of the input
+   */
+  std::string getInputId() const {
+    return systemInput->getId();
+  }
+
+  /**
+   * By default the signal is stamped with the timestamp of the input, which is the 
+   * start time of the cycle, see \ref System::getCycleTimeNs(), unless the input 
+   * provides its own timestamp. With precise timestamps the clock is read right after 
+   * sampling instead. Reading the clock may cost a system call per sample.
+   *
+   * @param precise - true to read the clock for every sample
+   */
+  void setPreciseTimestamp(bool precise = true) {
+    this->precise = precise;
   }
   
   /**
@@ -54,13 +75,27 @@ class PeripheralInput : public Blockio<0,1,T> {
    * @param args - argument list of variable size
    */
   template<typename ... ArgTypesIn>
-  void callInputFeature(std::string featureName, ArgTypesIn... args){
+  void callInputFeature(const std::string& featureName, ArgTypesIn... args){
     hal.callInputFeature(systemInput, featureName, args...);
   }
 
+  /**
+   * Resolves a feature function once and returns a handle to it. Calling the handle
+   * does not look up the feature again. Use this for features which are called periodically.
+   *
+   * @tparam Sig - signature of the feature function, e.g. void(double)
+   * @param featureName - name of the feature function
+   * @return feature handle
+   */
+  template<typename Sig>
+  hal::Feature<hal::InputInterface, Sig> feature(const std::string& featureName){
+    return hal.feature<Sig>(systemInput, featureName);
+  }
+
  private:
   hal::HAL& hal;
   hal::Input<T>* systemInput;
+  bool precise;
 };
 
 }
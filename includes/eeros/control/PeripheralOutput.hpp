@@ -7,6 +7,7 @@
 #include <eeros/hal/HAL.hpp>
 #include <eeros/core/Fault.hpp>
 #include <eeros/control/NaNOutputFault.hpp>
+#include <eeros/control/FaultStatus.hpp>
 
 namespace eeros {
 namespace control {
@@ -41,7 +42,8 @@ class PeripheralOutput : public Blockio<1,0,T> {
   PeripheralOutput(const PeripheralOutput& s) = delete; 
 
   /**
-   * Delivers the signal to the output.
+   * Delivers the signal to the output. A NaN or inf value is replaced by the safe
+   * value of the output and reported to the time domain, see \ref FaultStatus.
    */
   virtual void run() {
     std::lock_guard<std::mutex> lock(mtx);
@@ -53,8 +55,10 @@ class PeripheralOutput : public Blockio<1,0,T> {
     }
     systemOutput->set(val);
     systemOutput->setTimestampSignalIn(this->in.getSignal().getTimestamp());
-    if (isSafe) throw NaNOutputFault("NaN written to output '" + 
-                                     this->getName() + "', set to safe level if safe level is defined");
+    if (isSafe && !FaultStatus::raise(FaultCode::nanOutput, this)) {
+      throw NaNOutputFault("NaN written to output '" + 
+                           this->getName() + "', set to safe level if safe level is defined");
+    }
   }
             
   /**
@@ -76,9 +80,22 @@ class PeripheralOutput : public Blockio<1,0,T> {
    * @param args - argument list of variable size
    */
   template<typename ... ArgTypesOut>
-  void callOutputFeature(std::string featureName, ArgTypesOut... args){
+  void callOutputFeature(const std::string& featureName, ArgTypesOut... args){
     hal.callOutputFeature(systemOutput, featureName, args...);
   }
+
+  /**
+   * Resolves a feature function once and returns a handle to it. Calling the handle
+   * does not look up the feature again. Use this for features which are called periodically.
+   *
+   * @tparam Sig - signature of the feature function, e.g. void(double)
+   * @param featureName - name of the feature function
+   * @return feature handle
+   */
+  template<typename Sig>
+  hal::Feature<hal::OutputInterface, Sig> feature(const std::string& featureName){
+    return hal.feature<Sig>(systemOutput, featureName);
+  }
             
  private:
   hal::HAL& hal;
@@ -2,6 +2,7 @@
 #define ORG_EEROS_CONTROL_RATELIMITER_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/math/Matrix.hpp>
 
 
@@ -25,6 +26,7 @@ namespace control {
  *
  * If the input is a vector, then it is possible to choose if the algorithm applies elementwise or not.
  * If yes, rising_slew_rate and falling_slew_rate must be vectors. 
+ * Rates and enable state are picked up by the block without locking.
  * 
  * @tparam Tout - output type (double - default type)
  * @tparam Trate - rate type (double - default type)
@@ -44,11 +46,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * 
    * @param rate - limit of the first derivative
    */
-  RateLimiter(Trate rate) {
-    fallingRate = -rate;
-    risingRate = rate;
-    outPrev.clear();
-  }
+  RateLimiter(Trate rate) : RateLimiter(-rate, rate) { }
   
   /**
    * Constructs a RateLimiter instance specifying rising and falling rates.\n
@@ -56,9 +54,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @param fRate - limit of the first derivative in negative direction
    * @param rRate - limit of the first derivative in positive direction
    */
-  RateLimiter(Trate fRate, Trate rRate) {
-    fallingRate = fRate;
-    risingRate = rRate;
+  RateLimiter(Trate fRate, Trate rRate) : param(Params{fRate, rRate, false}) {
     outPrev.clear();
   }
   
@@ -77,14 +73,15 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * Otherwise: output(i) = input(i)
    */
   virtual void run(){
-    std::lock_guard<std::mutex> lock(mtx);
+    param.update();
+    const Params& p = param.value();
     Tout inVal = this->in.getSignal().getValue();
     double tin = this->in.getSignal().getTimestamp() / 1000000000.0;
     double tprev = outPrev.getTimestamp() / 1000000000.0;
     Tout outVal = inVal;
-    if(enabled) {
+    if(p.enabled) {
       double dt = tin - tprev;
-      outVal = calculateResult<Tout>(inVal, dt);
+      outVal = calculateResult<Tout>(inVal, dt, p.fallingRate, p.risingRate);
     }
     outPrev.setValue(outVal);
     outPrev.setTimestamp(this->in.getSignal().getTimestamp());
@@ -100,7 +97,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void enable() {
-    enabled = true;
+    param.modify([](Params& p) { p.enabled = true; });
   }
   
   /**
@@ -111,7 +108,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @see enable()
    */
   virtual void disable() {
-    enabled = false;
+    param.modify([](Params& p) { p.enabled = false; });
   }
   
   /**
@@ -121,9 +118,10 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @param rRate - limit of the first derivative in positive direction
    */
   virtual void setRate(Trate fRate, Trate rRate) {
-    std::lock_guard<std::mutex> lock(mtx);
-    fallingRate = fRate;
-    risingRate = rRate;
+    param.modify([&](Params& p) {
+      p.fallingRate = fRate;
+      p.risingRate = rRate;
+    });
   }
 
   /*
@@ -134,13 +132,16 @@ class RateLimiter : public Blockio<1,1,Tout> {
   friend std::ostream& operator<<(std::ostream& os, RateLimiter<X>& rl);
 
  private:
+  struct Params {
+    Trate fallingRate, risingRate;
+    bool enabled;
+  };
+
   Signal<Tout> outPrev;
-  Trate fallingRate, risingRate;
-  bool enabled{false};
-  std::mutex mtx;
+  Parameter<Params> param;
   
   template <typename S> 
-  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inValue, double dt) {
+  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inValue, double dt, const Trate& fallingRate, const Trate& risingRate) {
     Tout outVal;
     Trate rate = (inValue - outPrev.getValue()) / dt;
     if (rate > risingRate) outVal = dt * risingRate + outPrev.getValue();
@@ -150,7 +151,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
   }
 
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value && std::is_arithmetic<Trate>::value, S>::type calculateResult(S inValue, double dt) {
+  typename std::enable_if<std::is_compound<S>::value && std::is_arithmetic<Trate>::value, S>::type calculateResult(S inValue, double dt, const Trate& fallingRate, const Trate& risingRate) {
     std::cout << " NOT element wise" << std::endl;
     Tout outVal;
     for (unsigned int i = 0; i < inValue.size(); i++) {
@@ -163,7 +164,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
   }
   
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value && std::is_compound<Trate>::value, S>::type calculateResult(S inValue, double dt) {
+  typename std::enable_if<std::is_compound<S>::value && std::is_compound<Trate>::value, S>::type calculateResult(S inValue, double dt, const Trate& fallingRate, const Trate& risingRate) {
     std::cout << " element wise" << std::endl;
     Tout outVal;
     for (unsigned int i = 0; i < inValue.size(); i++) {
@@ -184,7 +185,8 @@ class RateLimiter : public Blockio<1,1,Tout> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, RateLimiter<T>& rl) {
-  os << "Block RateLimiter: '" << rl.getName() << "' falling rate=" << rl.fallingRate << ", rising rate=" << rl.risingRate; 
+  auto p = rl.param.get();
+  os << "Block RateLimiter: '" << rl.getName() << "' falling rate=" << p.fallingRate << ", rising rate=" << p.risingRate; 
   return os;
 }
 
@@ -2,8 +2,8 @@
 #define ORG_EEROS_CONTROL_SATURATION_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/math/Matrix.hpp>
-#include <mutex>
 #include <type_traits>
 
 namespace eeros {
@@ -13,6 +13,7 @@ namespace control {
  * A Saturation block limits an input value between two limit values.
  * The output value will always vary between lower and upper limit.
  * If the block is disabled, the output value will simply follow the input.
+ * Limits and enable state are picked up by the block without locking.
  * 
  * @tparam T - output type (double - default type) 
  *  
@@ -28,10 +29,7 @@ class Saturation : public Blockio<1,1,T> {
    * @param lower - lower limit
    * @param upper - upper limit
    */
-  Saturation(T lower, T upper) : enabled(true) {
-    lowerLimit = lower;
-    upperLimit = upper;
-  }
+  Saturation(T lower, T upper) : param(Params{lower, upper, true}) { }
   
   /**
    * Constructs a Saturation instance specifying a limit.
@@ -51,10 +49,11 @@ class Saturation : public Blockio<1,1,T> {
    * Runs the saturation algorithm, as described above.
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lock(mtx);
+    param.update();
+    const Params& p = param.value();
     T inVal = this->in.getSignal().getValue();
     T outVal = inVal;
-    if (enabled) outVal = calculateResult<T>(inVal);
+    if (p.enabled) outVal = calculateResult<T>(inVal, p.lowerLimit, p.upperLimit);
     this->out.getSignal().setValue(outVal);
     this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
   }
@@ -67,7 +66,7 @@ class Saturation : public Blockio<1,1,T> {
    * @see disable()
    */
   virtual void enable() {
-    enabled = true;
+    param.modify([](Params& p) { p.enabled = true; });
   }
   
   /**
@@ -78,7 +77,7 @@ class Saturation : public Blockio<1,1,T> {
    * @see enable()
    */
   virtual void disable() {
-    enabled = false;
+    param.modify([](Params& p) { p.enabled = false; });
   }
   
   /**
@@ -88,13 +87,28 @@ class Saturation : public Blockio<1,1,T> {
    * @param upper - upper limit
    */
   virtual void setLimit(T lower, T upper) {
-    lowerLimit = lower;
-    upperLimit = upper;
+    param.modify([&](Params& p) {
+      p.lowerLimit = lower;
+      p.upperLimit = upper;
+    });
   }
+
+  /*
+   * Friend operator overload to give the operator overload outside
+   * the class access to the private fields.
+   */
+  template <typename X>
+  friend std::ostream& operator<<(std::ostream& os, Saturation<X>& s);
   
  private:
+  struct Params {
+    T lowerLimit, upperLimit;
+    bool enabled;
+  };
+
+
   template <typename S> 
-  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inVal) {
+  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inVal, const T& lowerLimit, const T& upperLimit) {
     T outVal = inVal;
     if (inVal > upperLimit) outVal = upperLimit;
     if (inVal < lowerLimit) outVal = lowerLimit;
@@ -102,7 +116,7 @@ class Saturation : public Blockio<1,1,T> {
   }
 
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value, S>::type calculateResult(S inVal) {
+  typename std::enable_if<std::is_compound<S>::value, S>::type calculateResult(S inVal, const T& lowerLimit, const T& upperLimit) {
     T outVal = inVal;
     for (unsigned int i = 0; i < outVal.size(); i++) {
       if (inVal[i] > upperLimit[i]) outVal[i] = upperLimit[i];
@@ -111,9 +125,7 @@ class Saturation : public Blockio<1,1,T> {
     return outVal;
   }
 
-  T lowerLimit, upperLimit;
-  bool enabled;
-  std::mutex mtx;
+  Parameter<Params> param;
 };
 
 /**
@@ -123,7 +135,8 @@ class Saturation : public Blockio<1,1,T> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, Saturation<T>& s) {
-  os << "Block saturation: '" << s.getName() << "' lower limit=" << s.lowerLimit << ", upper limit=" << s.upperLimit; 
+  auto p = s.param.get();
+  os << "Block saturation: '" << s.getName() << "' lower limit=" << p.lowerLimit << ", upper limit=" << p.upperLimit; 
   return os;
 }
 
@@ -7,15 +7,24 @@
 #include <limits>
 #include <eeros/types.hpp>
 #include <eeros/control/SignalInterface.hpp>
+#include <eeros/control/SignalRegistry.hpp>
 
 namespace eeros {
 namespace control {
-    
-extern uint16_t signalCounter;
+
+template < typename T > class Output;
       
 /**
  * A signal comprises several properties such as a value and a timestamp.
  * It is used to transport information between blocks of a control system.
+ * 
+ * A signal only holds its value, its timestamp and its id, so the signals
+ * of a control system are packed densely. The name and the unit are kept in 
+ * the \ref SignalRegistry and are looked up when queried.
+ * A copy of a signal shares the id of the original and looks up the name and unit
+ * of the original. It gets an id and a registry entry of its own when its name, unit
+ * or source is set. Copying or destroying a copy never takes the lock of the registry,
+ * a copy which outlives its original without being named has no name.
  *
  * @tparam T - signal type (double - default type)
  * @since v0.4
@@ -27,8 +36,19 @@ class Signal : public SignalInterface {
   /**
    * Constructs a signal instance.
    */
-  Signal() {
-   id = signalCounter++;
+  Signal() : id(SignalRegistry::nextId() & idMask) { }
+
+  /**
+   * Copies a signal. The copy shares the id of the original.
+   */
+  Signal(const Signal<T>& s) : value(s.value), timestamp(s.timestamp), id((s.id & idMask) | copied) { }
+
+  /**
+   * Removes the name and unit of this signal from the registry, a copy sharing
+   * the id of its original leaves the entry of the original.
+   */
+  ~Signal() {
+    if (id & registered) SignalRegistry::remove(id & idMask);
   }
       
   /**
@@ -37,7 +57,7 @@ class Signal : public SignalInterface {
    * @return id
    */
   virtual sigid_t getId() const {
-    return static_cast<sigid_t>(id) << 16;
+    return static_cast<sigid_t>(static_cast<uint16_t>(id)) << 16;
   }
       
   /**
@@ -46,7 +66,8 @@ class Signal : public SignalInterface {
    * @return name
    */
   virtual std::string getName() const {
-    return name;
+    if ((id & (registered | copied)) == 0) return "";
+    return SignalRegistry::getName(id & idMask);
   }
       
   /**
@@ -55,21 +76,38 @@ class Signal : public SignalInterface {
    * @param name - name of the signal
    */
   virtual void setName(std::string name) {
-    this->name = name;
-  }
-      
-      virtual std::string getLabel() const {
-// 				std::stringstream label;
-// 				label << '#' << id << '.' << index << ": " << getName(index);
-// 				if(getAffiliation(index) != "") {
-// 					label << " (" << getAffiliation(index) << ')';
-// 				}
-// 				if(getUnit(index) != "") {
-// 					label << " [" << getUnit(index) << ']';
-// 				}
-// 				return label.str();
-        return name; // TODO
-      }
+    SignalRegistry::setName(own(), name);
+  }
+
+  /**
+   * Gets the unit of this signal.
+   * 
+   * @return unit, empty if not set
+   */
+  virtual std::string getUnit() const {
+    if ((id & (registered | copied)) == 0) return "";
+    return SignalRegistry::getUnit(id & idMask);
+  }
+
+  /**
+   * Sets the unit of this signal, e.g. "m/s".
+   * 
+   * @param unit - unit of the signal
+   */
+  virtual void setUnit(std::string unit) {
+    SignalRegistry::setUnit(own(), unit);
+  }
+      
+  /**
+   * Gets the label of this signal, the name followed by the unit in brackets if set.
+   * 
+   * @return label
+   */
+  virtual std::string getLabel() const {
+    std::string unit = getUnit();
+    if (unit.empty()) return getName();
+    return getName() + " [" + unit + "]";
+  }
       
   /**
    * Gets the value of this signal.
@@ -119,7 +157,7 @@ class Signal : public SignalInterface {
     _clear<T>();
   }
       
-  Signal<T>& operator= (Signal<T> right) {
+  Signal<T>& operator= (const Signal<T>& right) {
     value = right.value;
     timestamp = right.timestamp;
     return *this;
@@ -152,10 +190,26 @@ class Signal : public SignalInterface {
  protected:
   T value; /** The value carries the signal value, it can be of any physical type */
   timestamp_t timestamp; /** The timestamp marks the time when this signal was captured */
-  sigid_t id; /** Each signal has an unique id which is assigned automatically upon creation */
-  std::string name; /** Each signal can be named */
+  uint32_t id; /** Each signal has an unique id which is assigned automatically upon creation */
     
  private:
+  template < typename > friend class Output;
+  static constexpr uint32_t registered = 1u << 31;  // the signal has an entry in the registry
+  static constexpr uint32_t copied = 1u << 30;      // the signal shares the id of the signal it was copied from
+  static constexpr uint32_t idMask = copied - 1;
+
+  // returns the id of the entry of this signal in the registry, a copy sharing an id
+  // gets an id of its own, starting with the name and unit of the original
+  uint32_t own() {
+    if (id & copied) {
+      uint32_t shared = id & idMask;
+      id = SignalRegistry::nextId() & idMask;
+      SignalRegistry::copy(shared, id);
+    }
+    id |= registered;
+    return id & idMask;
+  }
+
   template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear() {
     value = std::numeric_limits<S>::min();
     timestamp = 0;
@@ -2,12 +2,13 @@
 #define ORG_EEROS_CONTROL_SIGNALCHECKER_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/safety/SafetyLevel.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #include <eeros/logger/Logger.hpp>
 #include <type_traits>
 #include <memory>
-#include <mutex>
+#include <atomic>
 
 
 namespace eeros {
@@ -35,6 +36,8 @@ namespace control {
  * the norm of a vector must be limit checked.
  *
  * A signal checker block is suitable for use with multiple threads.
+ * Limits and safety settings are picked up by the block without locking,
+ * see \ref Parameter.
  *
  * @tparam Tsig - signal type (double - default type)
  * @tparam Tlim - limit type (Tsig - default type)
@@ -55,12 +58,8 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param offRange - checks that the signal is lower than the lower limit or greater than the upper limit
    */
   SignalChecker(Tlim lowerLimit, Tlim upperLimit, bool offRange = false) 
-      : lowerLimit(lowerLimit),
-        upperLimit(upperLimit),
+      : param(Params{lowerLimit, upperLimit, nullptr, nullptr, nullptr}),
         fired(false),
-        safetySystem(nullptr),
-        safetyEvent(nullptr),
-        activeLevel(nullptr),
         log(logger::Logger::getLogger()), 
         offRange(offRange) {}
 
@@ -81,30 +80,31 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @see setActiveLevel()
    */
   virtual void run() override {
-    std::lock_guard<std::mutex> lock(mtx);
+    param.update();
+    const Params& p = param.value();
 
     auto val = this->in.getSignal().getValue();
     if (!fired) {
       if (offRange) {
-        if (withinLimits<bool>(val)) {
-          if (safetySystem != nullptr && safetyEvent != nullptr) {
-            if (activeLevel == nullptr ||
-            (activeLevel != nullptr && safetySystem->getCurrentLevel() >= *activeLevel)
+        if (withinLimits<bool>(val, p)) {
+          if (p.safetySystem != nullptr && p.safetyEvent != nullptr) {
+            if (p.activeLevel == nullptr ||
+            (p.activeLevel != nullptr && p.safetySystem->getCurrentLevel() >= *p.activeLevel)
             ) {
               log.warn() << "Signal checker \'" + this->getName() + "\' fires!";
-              safetySystem->triggerEvent(*safetyEvent);
+              p.safetySystem->triggerEvent(*p.safetyEvent);
               fired = true;
             }
           }
         }
       } else {
-        if (limitsExceeded<bool>(val)) {
-          if (safetySystem != nullptr && safetyEvent != nullptr) {
-            if (activeLevel == nullptr ||
-            (activeLevel != nullptr && safetySystem->getCurrentLevel() >= *activeLevel)
+        if (limitsExceeded<bool>(val, p)) {
+          if (p.safetySystem != nullptr && p.safetyEvent != nullptr) {
+            if (p.activeLevel == nullptr ||
+            (p.activeLevel != nullptr && p.safetySystem->getCurrentLevel() >= *p.activeLevel)
             ) {
               log.warn() << "Signal checker \'" + this->getName() + "\' fires!";
-              safetySystem->triggerEvent(*safetyEvent);
+              p.safetySystem->triggerEvent(*p.safetyEvent);
               fired = true;
             }
           }
@@ -121,9 +121,10 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param upperLimit - upper limit value
    */
   virtual void setLimits(Tlim lowerLimit, Tlim upperLimit) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->lowerLimit = lowerLimit;
-    this->upperLimit = upperLimit;
+    param.modify([&](Params& p) {
+      p.lowerLimit = lowerLimit;
+      p.upperLimit = upperLimit;
+    });
   }
 
 
@@ -131,7 +132,6 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * Resets the checker so it can fire a safety event again.
    */
   virtual void reset() {
-    std::lock_guard<std::mutex> lock(mtx);
     fired = false;
   }
 
@@ -143,9 +143,10 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param e - SafetyEvent
    */
   virtual void registerSafetyEvent(safety::SafetySystem &ss, safety::SafetyEvent &e) {
-    std::lock_guard<std::mutex> lock(mtx);
-    safetySystem = &ss;
-    safetyEvent = &e;
+    param.modify([&](Params& p) {
+      p.safetySystem = &ss;
+      p.safetyEvent = &e;
+    });
   }
 
 
@@ -155,40 +156,42 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param level - SafetyLevel
    */
   virtual void setActiveLevel(safety::SafetyLevel &level) {
-    std::lock_guard<std::mutex> lock(mtx);
-    activeLevel = &level;
+    param.modify([&](Params& p) { p.activeLevel = &level; });
   }
 
 
  protected:
-  Tlim lowerLimit, upperLimit;
-  bool fired;
-  safety::SafetySystem *safetySystem;
-  safety::SafetyEvent *safetyEvent;
-  safety::SafetyLevel *activeLevel;
+  struct Params {
+    Tlim lowerLimit, upperLimit;
+    safety::SafetySystem *safetySystem;
+    safety::SafetyEvent *safetyEvent;
+    safety::SafetyLevel *activeLevel;
+  };
+
+  Parameter<Params> param;
+  std::atomic<bool> fired;
   eeros::logger::Logger log;
-  std::mutex mtx{};
   bool offRange;
 
  private:
   template<typename S>
-  typename std::enable_if<!checkNorm, S>::type limitsExceeded(Tsig value) {
-    return !(value > lowerLimit && value < upperLimit);
+  typename std::enable_if<!checkNorm, S>::type limitsExceeded(Tsig value, const Params& p) {
+    return !(value > p.lowerLimit && value < p.upperLimit);
   }
 
   template<typename S>
-  typename std::enable_if<checkNorm, S>::type limitsExceeded(Tsig value) {
-    return !(value.norm() > lowerLimit && value.norm() < upperLimit);
+  typename std::enable_if<checkNorm, S>::type limitsExceeded(Tsig value, const Params& p) {
+    return !(value.norm() > p.lowerLimit && value.norm() < p.upperLimit);
   }
 
   template<typename S>
-  typename std::enable_if<!checkNorm, S>::type withinLimits(Tsig value) {
-    return (value > lowerLimit && value < upperLimit);
+  typename std::enable_if<!checkNorm, S>::type withinLimits(Tsig value, const Params& p) {
+    return (value > p.lowerLimit && value < p.upperLimit);
   }
 
   template<typename S>
-  typename std::enable_if<checkNorm, S>::type withinLimits(Tsig value) {
-    return (value.norm() > lowerLimit && value.norm() < upperLimit);
+  typename std::enable_if<checkNorm, S>::type withinLimits(Tsig value, const Params& p) {
+    return (value.norm() > p.lowerLimit && value.norm() < p.upperLimit);
   }
 
 };
@@ -0,0 +1,65 @@
+#ifndef ORG_EEROS_CONTROL_SIGNALREGISTRY_HPP_
+#define ORG_EEROS_CONTROL_SIGNALREGISTRY_HPP_
+
+#include <cstdint>
+#include <string>
+
+namespace eeros {
+namespace control {
+
+class Block;
+
+/**
+ * The signal registry holds the names, units and source blocks of signals,
+ * keyed by the id of the signal. A signal only carries its value, timestamp
+ * and id, which are read every cycle, the rest is looked up here when needed.
+ * The registry is thread safe, but takes a lock. Do not use it in realtime code.
+ *
+ * The registry is used by \ref Signal and \ref Output, there is no need
+ * to use it directly.
+ *
+ * @since v1.4
+ */
+class SignalRegistry {
+ public:
+  /**
+   * Returns a new id.
+   *
+   * @return id
+   */
+  static uint32_t nextId();
+
+  static void setName(uint32_t id, const std::string& name);
+  static std::string getName(uint32_t id);
+  static void setUnit(uint32_t id, const std::string& unit);
+  static std::string getUnit(uint32_t id);
+  static void setSource(uint32_t id, Block* block);
+  static Block* getSource(uint32_t id);
+
+  /**
+   * Copies the entry of a signal.
+   *
+   * @param from - id of the signal to copy from
+   * @param to - id of the new signal
+   */
+  static void copy(uint32_t from, uint32_t to);
+
+  /**
+   * Removes the entry of a signal.
+   *
+   * @param id - id
+   */
+  static void remove(uint32_t id);
+
+  /**
+   * Returns the number of signals with an entry.
+   *
+   * @return number of entries
+   */
+  static std::size_t size();
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_SIGNALREGISTRY_HPP_ */
@@ -23,11 +23,13 @@ namespace eeros {
 			virtual void setInitPos(Matrix<SPACENAVIGATOR_AXIS_COUNT> initPos);
 			Output<Matrix<SPACENAVIGATOR_ROT_AXIS_COUNT,1,double>>& getRotOut();
 			Output<Matrix<SPACENAVIGATOR_BUTTON_COUNT,1,bool>>& getButtonOut();			
+			Output<bool>& getNewOut();	// true in the cycle a new state arrived
 
 		protected:
 			SpaceNavigator sn;
 			Output<Matrix<SPACENAVIGATOR_ROT_AXIS_COUNT,1,double>> rotOut;
 			Output<Matrix<SPACENAVIGATOR_BUTTON_COUNT,1,bool>> buttonOut;
+			Output<bool> newOut;
 		};
 
 	};
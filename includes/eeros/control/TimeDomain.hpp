@@ -2,10 +2,18 @@
 #define ORG_EEROS_CONTROLTIMEDOMAIN_HPP
 
 #include <list>
+#include <memory>
 #include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <pthread.h>
 #include <eeros/core/Runnable.hpp>
+#include <eeros/core/Wakeup.hpp>
 #include <eeros/control/NotConnectedFault.hpp>
 #include <eeros/control/NaNOutputFault.hpp>
+#include <eeros/control/FaultStatus.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #include <eeros/safety/SafetyLevel.hpp>
 
@@ -21,6 +29,18 @@ using namespace safety;
  * added to the executor, the executor will run the timedomain with the assigned 
  * period. You can stop the executor running the timedomain and restart it later.
  * 
+ * Blocks which are not connected to each other, directly or over other blocks of
+ * the timedomain, form independent groups. Such groups, e.g. the controllers of
+ * several axes, can be run in parallel by a few worker threads, see \ref setParallel().
+ * 
+ * Blocks report faults such as reading from an unconnected input to the \ref FaultStatus 
+ * of the timedomain instead of throwing. The timedomain checks it after running all blocks 
+ * and fires its safety event in the same cycle.
+ * 
+ * The timedomain reads the clock once at the start of each cycle. Blocks stamp their 
+ * signals with this time, see \ref System::getCycleTimeNs(), so all signals of a cycle
+ * carry the same timestamp.
+ * 
  * @since v0.4
  */
 
@@ -34,6 +54,11 @@ class TimeDomain : public virtual Runnable {
    * @param realtime - when true, executor creates a realtime thread if available by the system 
    */
   TimeDomain(std::string name, double period, bool realtime);
+
+  /**
+   * Destructs the timedomain and stops its worker threads.
+   */
+  virtual ~TimeDomain();
   
   /**
    * Adds a block to a time domain.
@@ -87,12 +112,50 @@ class TimeDomain : public virtual Runnable {
   /**
    * A timedomain can run into problems if blocks or connections between them are misconfigured.
    * In such cases the timedomain can fire safety events to notify the safety system.
+   * Without a registered safety event, such a fault is thrown as eeros::Fault.
    *
    * @param ss - reference to the safety system 
    * @param e - safety event 
    */
   void registerSafetyEvent(SafetySystem& ss, SafetyEvent& e);
 
+  /**
+   * Runs independent groups of blocks in parallel. The groups are found by following
+   * the connections of the block inputs. Each group is assigned to one thread and runs
+   * in the order the blocks were added, so the results are the same as with serial
+   * execution. The thread of the timedomain runs one share itself, the other threads
+   * are started here and whenever the groups are determined again, see \ref partition().
+   * They sleep between the cycles and take over the scheduling policy and priority of 
+   * the thread running the timedomain on their first cycle.
+   * If the timedomain contains runnables which are not blocks, or inputs connected to
+   * outputs without owner, all blocks are run serially. Parallel execution requires
+   * that blocks construct their inputs with \c this as owner, e.g. in(this), as only 
+   * such inputs are known to the block. As long as a connected input without owner reads
+   * from a block of this timedomain, all blocks are run serially and a warning is logged.
+   * Blocks exchanging data other than over their inputs and outputs must not be put in 
+   * the same parallel timedomain.
+   *
+   * @param threads - number of threads including the thread of the timedomain, 1 runs all blocks serially
+   * @param cpus - cores to pin the additional threads to, empty for no pinning
+   */
+  void setParallel(unsigned int threads, std::vector<int> cpus = {});
+
+  /**
+   * Returns the number of groups of blocks which are run in parallel.
+   *
+   * @return number of threads actually running blocks, 1 if all blocks are run serially
+   */
+  unsigned int getParallelGroups();
+
+  /**
+   * Determines the groups of blocks which are run in parallel from the current connections
+   * and restarts the worker threads. This is done by \ref setParallel(), when blocks are
+   * added or removed and by the executor before it starts running. The cycle never does it,
+   * so connections changed afterwards are only taken into account after calling this method.
+   * Blocks must not be added or removed while a parallel timedomain is run.
+   */
+  void partition();
+
   /**
    * The basic algorithm of the timedomain. It will run all blocks.
    */
@@ -120,6 +183,12 @@ class TimeDomain : public virtual Runnable {
   friend std::ostream& operator<<(std::ostream& os, TimeDomain& td);
   
  private:
+  void runParallel(uint64_t timeNs);
+  void handleFault(const std::string& message);
+  void runShare(unsigned int share);
+  void startWorkers();
+  void stopWorkers();
+
   std::string name;
   double period;
   bool realtime;
@@ -127,6 +196,19 @@ class TimeDomain : public virtual Runnable {
   std::list<Runnable*> blocks;
   SafetySystem* safetySystem;
   SafetyEvent* safetyEvent;
+  FaultStatus faultStatus;
+  unsigned int threads = 1;
+  std::vector<int> cpus;
+  std::string serialReason;
+  std::vector<std::vector<Runnable*>> shares;
+  std::vector<std::exception_ptr> faults;
+  std::vector<std::thread> workers;
+  std::vector<std::unique_ptr<Wakeup>> wakeups;  // one per share, share 0 is run by the timedomain
+  Wakeup finished;
+  pthread_t runner;
+  std::atomic<uint64_t> cycleTimeNs;
+  std::atomic<unsigned int> done;
+  std::atomic<bool> workersRunning;
 };
 
 }
@@ -0,0 +1,136 @@
+#ifndef ORG_EEROS_CONTROL_TRAJECTORYFILE_HPP_
+#define ORG_EEROS_CONTROL_TRAJECTORYFILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eeros {
+namespace control {
+
+/**
+ * A trajectory file holds the segments of a piecewise cubic trajectory as used by
+ * \ref PathPlannerCubic. Each segment has a duration, a constant jerk and the
+ * acceleration, velocity and position at its beginning.
+ *
+ * Two file formats are read. The text format has one segment per line with the columns
+ * duration, jerk, acceleration, velocity and position. The binary format starts with a
+ * header holding a magic number, a version, the number of segments and a checksum of the
+ * segment data, followed by the segments as written by \ref save(). Binary files are mapped
+ * into memory instead of being read, so loading does not depend on the number of segments
+ * apart from verifying the checksum. Each segment additionally holds its end time relative
+ * to the start of the trajectory, which allows to find the segment of a given time with
+ * a binary search, see \ref find().
+ *
+ * A trajectory file is immutable once constructed.
+ *
+ * @since v1.4
+ */
+class TrajectoryFile {
+ public:
+  /**
+   * One segment of a trajectory, the layout is part of the binary format.
+   */
+  struct Segment {
+    double duration;  // duration in s
+    double jerk;      // constant jerk during the segment
+    double acc;       // acceleration at the beginning of the segment
+    double vel;       // velocity at the beginning of the segment
+    double pos;       // position at the beginning of the segment
+    double end;       // end time relative to the start of the trajectory
+  };
+
+  /**
+   * Version of the binary format written by \ref save().
+   */
+  static constexpr uint32_t version = 1;
+
+  /**
+   * Loads a trajectory from a file in text or binary format.
+   * Throws a Fault if the file cannot be opened or a binary file is corrupt.
+   *
+   * @param filename - name of the trajectory file
+   */
+  explicit TrajectoryFile(const std::string& filename);
+
+  /**
+   * Constructs a trajectory from segments held in memory. The end times of
+   * the segments are calculated from their durations.
+   *
+   * @param segments - segments of the trajectory
+   */
+  explicit TrajectoryFile(std::vector<Segment> segments);
+
+  TrajectoryFile(const TrajectoryFile&) = delete;
+  TrajectoryFile& operator=(const TrajectoryFile&) = delete;
+
+  /**
+   * Unmaps a binary file.
+   */
+  ~TrajectoryFile();
+
+  /**
+   * Writes the trajectory in binary format.
+   * Throws a Fault if the file cannot be written.
+   *
+   * @param filename - name of the binary file
+   */
+  void save(const std::string& filename) const;
+
+  /**
+   * Converts a trajectory file from text to binary format.
+   *
+   * @param textFile - name of the text file
+   * @param binaryFile - name of the binary file
+   * @return number of segments
+   */
+  static std::size_t convert(const std::string& textFile, const std::string& binaryFile);
+
+  /**
+   * Returns the number of segments.
+   *
+   * @return number of segments
+   */
+  std::size_t size() const { return count; }
+
+  /**
+   * Returns a segment.
+   *
+   * @param i - index of the segment
+   * @return segment
+   */
+  const Segment& operator[](std::size_t i) const { return segments[i]; }
+
+  /**
+   * Returns the index of the first segment ending at or after a given time.
+   * Returns the number of segments if time is after the end of the trajectory.
+   *
+   * @param time - time relative to the start of the trajectory
+   * @return index of the segment
+   */
+  std::size_t find(double time) const;
+
+  /**
+   * Returns true if the trajectory was loaded from a memory mapped binary file.
+   *
+   * @return file is mapped
+   */
+  bool isMapped() const { return map != nullptr; }
+
+ private:
+  void loadBinary(int fd, const std::string& filename);
+  void loadText(const std::string& filename);
+  void setEnd();
+
+  std::vector<Segment> storage;
+  const Segment* segments;
+  std::size_t count;
+  void* map;
+  std::size_t mapSize;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_TRAJECTORYFILE_HPP_ */
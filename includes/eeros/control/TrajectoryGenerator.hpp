@@ -3,6 +3,7 @@
 
 #include <eeros/control/Block.hpp>
 #include <array>
+#include <atomic>
 
 namespace eeros {
 namespace control {
@@ -28,7 +29,7 @@ class TrajectoryGenerator : public Block {
   /**
    * Constructs a default instance and sets the initial values to 0.
    */
-  TrajectoryGenerator() {
+  TrajectoryGenerator() : requested(0), finished(0) {
     for(auto& e : last) e = 0;
   }
   
@@ -123,7 +124,34 @@ class TrajectoryGenerator : public Block {
   }
   
  protected:
-  std::array<T, N> last;
+  /*
+   * Returns a new number for a trajectory or start position to be dispatched.
+   * Called by the thread calling move() and setStart().
+   */
+  unsigned int dispatch() {
+    return requested.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  /*
+   * Marks the trajectory with the given number and all dispatched before as finished.
+   * A late report of an older trajectory does not overwrite a newer one.
+   */
+  void finish(unsigned int number) {
+    unsigned int f = finished.load(std::memory_order_relaxed);
+    while (f < number && !finished.compare_exchange_weak(f, number, std::memory_order_release));
+  }
+
+  /*
+   * Returns true, if the last dispatched trajectory is finished.
+   */
+  bool allFinished() const {
+    return finished.load(std::memory_order_acquire) == requested.load(std::memory_order_relaxed);
+  }
+
+  std::array<T, N> last;  // end state of the last dispatched trajectory
+
+ private:
+  std::atomic<unsigned int> requested, finished;
 };
 
 };
@@ -0,0 +1,124 @@
+#ifndef ORG_EEROS_CONTROL_TRAJECTORYTABLE_HPP_
+#define ORG_EEROS_CONTROL_TRAJECTORYTABLE_HPP_
+
+#include <array>
+#include <cmath>
+
+namespace eeros {
+namespace control {
+
+/**
+ * A trajectory table holds a piecewise polynomial trajectory for several axes.
+ * Each segment lasts a whole number of sampling periods and describes the position
+ * of all axes as cubic polynomial of the time since the start of the segment.
+ * The coefficients are stored per power for all axes, so the evaluation with Horner's
+ * scheme runs in one loop over the axes. Velocity, acceleration and jerk are the
+ * derivatives of the position polynomial.
+ *
+ * The table is filled when a trajectory is dispatched, a trajectory generator then only
+ * counts sampling periods and evaluates the current segment, see \ref evaluate().
+ *
+ * @tparam T - type holding one value per axis (must be a composite type, e.g. Matrix<3,1,double>)
+ * @tparam S - maximum number of segments
+ *
+ * @since v1.4
+ */
+template < typename T, unsigned int S >
+class TrajectoryTable {
+  using E = typename T::value_type;
+
+ public:
+  TrajectoryTable() : count(0) { }
+
+  /**
+   * Converts a duration to a number of sampling periods, rounded up.
+   *
+   * @param duration - duration in s
+   * @param dt - sampling time in s
+   * @return number of sampling periods
+   */
+  static unsigned int periods(double duration, double dt) {
+    return static_cast<unsigned int>(std::ceil(duration / dt));
+  }
+
+  /**
+   * Removes all segments.
+   */
+  void clear() {
+    count = 0;
+  }
+
+  /**
+   * Appends a segment with the position p(t) = c0 + c1 * t + c2 * t^2 + c3 * t^3.
+   * Segments without sampling periods are left out.
+   *
+   * @param periods - duration in sampling periods
+   * @param c0 - constant coefficients
+   * @param c1 - linear coefficients
+   * @param c2 - quadratic coefficients
+   * @param c3 - cubic coefficients
+   */
+  void add(unsigned int periods, const T& c0, const T& c1, const T& c2, const T& c3) {
+    if (periods == 0 || count >= S) return;
+    Segment& s = segments[count++];
+    s.periods = periods;
+    s.c0 = c0;
+    s.c1 = c1;
+    s.c2 = c2;
+    s.c3 = c3;
+  }
+
+  /**
+   * Returns the number of segments.
+   *
+   * @return number of segments
+   */
+  unsigned int size() const {
+    return count;
+  }
+
+  /**
+   * Returns the duration of a segment.
+   *
+   * @param segment - index of the segment
+   * @return number of sampling periods
+   */
+  unsigned int getPeriods(unsigned int segment) const {
+    return segments[segment].periods;
+  }
+
+  /**
+   * Evaluates a segment for all axes. y[0] receives the position, y[1] the velocity,
+   * y[2] the acceleration and y[3] the jerk, as far as y has elements.
+   *
+   * @param segment - index of the segment
+   * @param t - time since the start of the segment in s
+   * @param y - position and its derivatives
+   */
+  template < std::size_t N >
+  void evaluate(unsigned int segment, E t, std::array<T, N>& y) const {
+    static_assert(N >= 1 && N <= 4, "a cubic trajectory has at most three derivatives");
+    const Segment& s = segments[segment];
+    for (unsigned int i = 0; i < s.c0.size(); i++) {
+      E c0 = s.c0[i], c1 = s.c1[i], c2 = s.c2[i], c3 = s.c3[i];
+      y[0][i] = ((c3 * t + c2) * t + c1) * t + c0;
+      if (N > 1) y[1 % N][i] = (3 * c3 * t + 2 * c2) * t + c1;
+      if (N > 2) y[2 % N][i] = 6 * c3 * t + 2 * c2;
+      if (N > 3) y[3 % N][i] = 6 * c3;
+    }
+  }
+
+ private:
+  struct Segment {
+    unsigned int periods;
+    T c0, c1, c2, c3;
+  };
+
+  std::array<Segment, S> segments;
+  unsigned int count;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_TRAJECTORYTABLE_HPP_ */
@@ -93,8 +93,8 @@ class TransitionInBlock : public Blockio<1,0,T> {
         container.mtx.unlock();
       } else {	//down
         container.mtx.lock();
-        auto val = this->getIn().getSignal(); 
-        container.buf.push_back(val);
+        container.buf.emplace_back();
+        container.buf.back() = this->getIn().getSignal();
         container.mtx.unlock();
       }
     }
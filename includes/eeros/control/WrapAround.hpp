@@ -2,8 +2,8 @@
 #define ORG_EEROS_CONTROL_WRAPAROUND_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Parameter.hpp>
 #include <eeros/math/Matrix.hpp>
-#include <mutex>
 
 using namespace eeros::math;
 
@@ -15,6 +15,7 @@ namespace control {
  * As soon as the input value exceeds an upper limit, the output will wrap
  * around and will be set to minVal. The wrap direction works in positive or 
  * direction. The output value will always vary between minVal and maxVal.
+ * Limits and enable state are picked up by the block without locking.
  * 
  * @tparam Tout - output type (double - default type) 
  * @tparam Twrap - type of min and max values for wrap. Must be double, or same as Tout (double - default type) 
@@ -34,7 +35,7 @@ class WrapAround : public Blockio<1,1,Tout> {
    * @param min - minimum value for wrap around
    * @param max - maximum value for wrap around
    */
-  WrapAround(Twrap min, Twrap max) : enabled(true), minVal(min), maxVal(max) { }
+  WrapAround(Twrap min, Twrap max) : param(Params{min, max, true}) { }
       
   /**
    * Disabling use of copy constructor because the block should never be copied unintentionally.
@@ -45,10 +46,11 @@ class WrapAround : public Blockio<1,1,Tout> {
    * Runs the wrap around algorithm, as described above.
    */
   virtual void run(){
-    std::lock_guard<std::mutex> lock(mtx);
+    param.update();
+    const Params& p = param.value();
     Tout inVal = this->in.getSignal().getValue();
     Tout outVal = inVal;
-    if (enabled) outVal = calculateResult<Tout>(inVal);
+    if (p.enabled) outVal = calculateResult<Tout>(inVal, p.minVal, p.maxVal);
     this->out.getSignal().setValue(outVal);
     this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
   }
@@ -61,7 +63,7 @@ class WrapAround : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void enable() {
-    enabled = true;
+    param.modify([](Params& p) { p.enabled = true; });
   }
 
   /**
@@ -72,7 +74,7 @@ class WrapAround : public Blockio<1,1,Tout> {
    * @see enable()
    */
   virtual void disable() {
-    enabled = false;
+    param.modify([](Params& p) { p.enabled = false; });
   }
 
   /**
@@ -82,53 +84,54 @@ class WrapAround : public Blockio<1,1,Tout> {
    * @param max - maximum value for wrap around
    */
   virtual void setMinMax(Twrap min, Twrap max) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->minVal = minVal;
-    this->maxVal = maxVal;
+    param.modify([&](Params& p) {
+      p.minVal = min;
+      p.maxVal = max;
+    });
   }
 
  private:
   template <typename S> 
-  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inValue) {
+  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inValue, const Twrap& minVal, const Twrap& maxVal) {
     Tout outVal;
     double delta = fabs(maxVal - minVal);
-    double num = inValue - this->minVal;
+    double num = inValue - minVal;
     double den = delta;
     double tquot = floor(num / den);
     outVal = num - tquot * den;
     if (outVal < 0) outVal = outVal + delta;
-    else if (outVal > 0) outVal = outVal + this->minVal; 
+    else if (outVal > 0) outVal = outVal + minVal; 
     else outVal = inValue;
     return outVal;
   }
 
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value && std::is_arithmetic<Twrap>::value, S>::type calculateResult(S inValue) {
+  typename std::enable_if<std::is_compound<S>::value && std::is_arithmetic<Twrap>::value, S>::type calculateResult(S inValue, const Twrap& minVal, const Twrap& maxVal) {
     Tout outVal;
     for(unsigned int i = 0; i < inValue.size(); i++) {
       double delta = fabs(maxVal - minVal);
-      double num = inValue[i] - this->minVal;
+      double num = inValue[i] - minVal;
       double den = delta;
       double tquot = floor(num / den);
       outVal[i] = num - tquot * den;
       if (outVal[i] < 0) outVal[i] = outVal[i] + delta;
-      else if ((outVal[i] > 0)) outVal[i] = outVal[i] + this->minVal; 
+      else if ((outVal[i] > 0)) outVal[i] = outVal[i] + minVal; 
       else outVal[i] = inValue[i];
     }
     return outVal;
   }
   
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value && std::is_compound<Twrap>::value, S>::type calculateResult(S inValue) {
+  typename std::enable_if<std::is_compound<S>::value && std::is_compound<Twrap>::value, S>::type calculateResult(S inValue, const Twrap& minVal, const Twrap& maxVal) {
     Tout outVal;
     for(unsigned int i = 0; i < inValue.size(); i++) {
       double delta = fabs(maxVal[i] - minVal[i]);
-      double num = inValue[i] - this->minVal[i];
+      double num = inValue[i] - minVal[i];
       double den = delta;
       double tquot = floor(num/den);
       outVal[i] = num - tquot * den;
       if (outVal[i] < 0) outVal[i] = outVal[i] + delta;
-      else if ((outVal[i] > 0)) outVal[i] = outVal[i] + this->minVal[i]; 
+      else if ((outVal[i] > 0)) outVal[i] = outVal[i] + minVal[i]; 
       else outVal[i] = inValue[i];
     }
     return outVal;
@@ -142,10 +145,13 @@ class WrapAround : public Blockio<1,1,Tout> {
   friend std::ostream &operator<<(std::ostream &os, WrapAround<Xout, Xwrap> &wrap);
 
  protected:
-  bool enabled{true};
-  std::mutex mtx;
-  Twrap minVal;
-  Twrap maxVal;
+  struct Params {
+    Twrap minVal;
+    Twrap maxVal;
+    bool enabled;
+  };
+
+  Parameter<Params> param;
 };
 
 /**
@@ -155,8 +161,9 @@ class WrapAround : public Blockio<1,1,Tout> {
  */
 template<typename Tout, typename Twrap>
 std::ostream &operator<<(std::ostream &os, WrapAround<Tout, Twrap> &wrap) {
-  os << "Block WrapAround: '" << wrap.getName() << "' is enabled=" << wrap.enabled;
-  os << ", minVal=" << wrap.minVal << ", maxVal=" << wrap.maxVal;
+  auto p = wrap.param.get();
+  os << "Block WrapAround: '" << wrap.getName() << "' is enabled=" << p.enabled;
+  os << ", minVal=" << p.minVal << ", maxVal=" << p.maxVal;
   return os;
 }
 
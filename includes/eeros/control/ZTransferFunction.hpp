@@ -67,7 +67,7 @@ class ZTransferFunction: public Blockio<1,1> {
       last_out[0] /= fraction.denominator.c[0];
       
       out.getSignal().setValue(last_out[0]);
-      out.getSignal().setTimestamp(eeros::System::getTimeNs());
+      out.getSignal().setTimestamp(eeros::System::getCycleTimeNs());
       
       for (int i = (N - 1); i >= 0; i--) {
         last_in[i] = last_in[i - 1];
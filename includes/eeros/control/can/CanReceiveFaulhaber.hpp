@@ -7,6 +7,7 @@
 #include <eeros/core/System.hpp>
 #include <eeros/math/Matrix.hpp>
 #include <eeros/core/Fault.hpp>
+#include <eeros/control/can/CanTransport.hpp>
 #include <canopen-drv.h>
 #include <vector>
 #include <algorithm>
@@ -44,81 +45,83 @@ class CanReceiveFaulhaber: public Block {
   /**
    * Constructs a CAN receive block instance for a given set of nodes.
    * Sets the scale of velocity and position to 1.
+   * Once enabled, only PDO's with the given function codes from the given nodes are received.
    *
    * @param socket - socket of number of associated CAN bus
    * @param node - vector with node id's of all connected CAN nodes 
    * @param functionCode - vector with function codes of all PDO's to be received
    */
   CanReceiveFaulhaber(int socket, std::initializer_list<uint8_t> node, std::initializer_list<uint8_t> functionCode) 
-      :  socket(socket), nodes(node), functionCodes(functionCode), log(Logger::getLogger('C')) {
+      :  socket(socket), nodes(node), functionCodes(functionCode), transport(socket), nodeTable(node), log(Logger::getLogger('C')) {
     for (size_t i = 0; i < node.size(); i++) {
       posScale[i] = 1;
       velScale[i] = 1;
     }
+    for (auto n : nodes) {
+      for (auto fc : functionCodes) ids.push_back(CanTransport::cobId(fc, n));
+    }
+    try {
+      transport.enableTimestamps();
+    } catch (Fault& e) {
+      log.warn() << "CAN receive: no kernel timestamps, frames are stamped on reception";
+    }
     log.info() << "CAN receive block constructed, " << node.size() << " nodes with " << functionCode.size() << " PDO's";
   }
           
   /**
    * Reads from the CAN bus.
    *
-   * If enabled reads 2 PDO's from each CAN node. 
+   * If enabled reads all PDO's pending on the socket in batches and dispatches
+   * them to their node. The outputs are stamped with the time the kernel
+   * received the newest PDO.
    *
    * @see enable()
    * @see disable()
    */
   virtual void run() {
     if (enabled) {
-      uint32_t nof = nodes.size() * functionCodes.size();
-      for (uint32_t i = 0; i < nof; i++) {
-        uint64_t ts = eeros::System::getTimeNs();
-        int readLen = 0;
-        canopen_frame_t readFrame;
-        readLen = canopen_read_frame(socket, &readFrame);
-        if (readLen == EAGAIN || readLen == EWOULDBLOCK){
-          log.error() << "would block";
-        }
-        if (readLen < 0) {
-          if(readLen != -1) log.info() << "error " << readLen;
-        }
-        if (readLen > 0) {
-          // find associated node
-          std::vector<uint8_t>::iterator it = std::find(nodes.begin(), nodes.end(), readFrame.id);
-          if (it == nodes.end()) log.warn() << "CAN receive: node id " << readFrame.id << " not found";
-          int node = std::distance(nodes.begin(), it);
-          if(readFrame.function_code == CANOPEN_FC_PDO1_TX) {
-            uint16_t tmpStatus = (readFrame.payload.data[0] & 0xFF);
-            tmpStatus |= (uint16_t(readFrame.payload.data[1] & 0xFF) << 8);
-            auto s = status.getSignal().getValue();
+      auto s = status.getSignal().getValue();
+      auto v = vel.getSignal().getValue();
+      auto p = pos.getSignal().getValue();
+      auto w = warning.getSignal().getValue();
+      uint64_t tsStatus = 0, tsPos = 0;
+      unsigned int n;
+      do {
+        n = transport.receive();
+        for (unsigned int i = 0; i < n; i++) {
+          const can_frame& frame = transport.getFrame(i);
+          int node = nodeTable[CanTransport::nodeId(frame.can_id)];
+          if (node < 0) {
+            log.warn() << "CAN receive: node id " << (int)CanTransport::nodeId(frame.can_id) << " not found";
+            continue;
+          }
+          uint8_t fc = CanTransport::functionCode(frame.can_id);
+          if (fc == CANOPEN_FC_PDO1_TX) {
+            uint16_t tmpStatus = frame.data[0] | (uint16_t(frame.data[1]) << 8);
             s[node] = tmpStatus & 0x26F;
-            status.getSignal().setValue(s);
-            status.getSignal().setTimestamp(ts);
-            int32_t tmpVel = (readFrame.payload.data[2] & 0x00FF);
-            tmpVel |= ((readFrame.payload.data[3] & 0x00FF) << 8);
-            tmpVel |= ((readFrame.payload.data[4] & 0x00FF) << 16);
-            tmpVel |= ((readFrame.payload.data[5] & 0x00FF) << 24);
-            auto v = vel.getSignal().getValue();
-            v[node] = tmpVel / velScale[node]; 
-            vel.getSignal().setValue(v);
-            vel.getSignal().setTimestamp(ts);
-          } else if (readFrame.function_code == CANOPEN_FC_PDO2_TX) {
-            int32_t tmpPos = (readFrame.payload.data[0] & 0x00FF);
-            tmpPos |= ((readFrame.payload.data[1] & 0x00FF) << 8);
-            tmpPos |= ((readFrame.payload.data[2] & 0x00FF) << 16);
-            tmpPos |= ((readFrame.payload.data[3] & 0x00FF) << 24);
-            auto p = pos.getSignal().getValue();
-            p[node] = tmpPos / posScale[node]; 
-            pos.getSignal().setValue(p);
-            pos.getSignal().setTimestamp(ts);
-            uint32_t tmpWarning = (readFrame.payload.data[4] & 0x00FF);
-            tmpWarning |= ((readFrame.payload.data[5] & 0x00FF) << 8);
-            tmpWarning |= ((readFrame.payload.data[6] & 0x00FF) << 16);
-            tmpWarning |= ((readFrame.payload.data[7] & 0x00FF) << 24);
-            auto w = warning.getSignal().getValue();
-            w[node] = tmpWarning; 
-            warning.getSignal().setValue(w);
-            warning.getSignal().setTimestamp(ts);
-          } else log.warn() << "PDO not parsed: " << (int)readFrame.function_code;
+            int32_t tmpVel = frame.data[2] | (frame.data[3] << 8) | (frame.data[4] << 16) | (uint32_t(frame.data[5]) << 24);
+            v[node] = tmpVel / velScale[node];
+            tsStatus = std::max(tsStatus, transport.getTimestamp(i));
+          } else if (fc == CANOPEN_FC_PDO2_TX) {
+            int32_t tmpPos = frame.data[0] | (frame.data[1] << 8) | (frame.data[2] << 16) | (uint32_t(frame.data[3]) << 24);
+            p[node] = tmpPos / posScale[node];
+            uint32_t tmpWarning = frame.data[4] | (frame.data[5] << 8) | (frame.data[6] << 16) | (uint32_t(frame.data[7]) << 24);
+            w[node] = tmpWarning;
+            tsPos = std::max(tsPos, transport.getTimestamp(i));
+          } else log.warn() << "PDO not parsed: " << (int)fc;
         }
+      } while (n == CanTransport::maxFrames);
+      if (tsStatus != 0) {
+        status.getSignal().setValue(s);
+        status.getSignal().setTimestamp(tsStatus);
+        vel.getSignal().setValue(v);
+        vel.getSignal().setTimestamp(tsStatus);
+      }
+      if (tsPos != 0) {
+        pos.getSignal().setValue(p);
+        pos.getSignal().setTimestamp(tsPos);
+        warning.getSignal().setValue(w);
+        warning.getSignal().setTimestamp(tsPos);
       }
     }
   }
@@ -163,22 +166,28 @@ class CanReceiveFaulhaber: public Block {
    * Enables the block.
    *
    * If enabled, run() will read PDOs on the CAN bus and parse them.
+   * The socket is shared with the SDO transfers initializing the drives, it is
+   * filtered for the PDOs of this block only from now on. SDO responses are 
+   * no longer received.
    *
    * @see run()
    */
   virtual void enable() {
+    transport.setFilter(ids);
     enabled = true;
   }
   
   /**
    * Disables the block.
    *
-   * If disabled, no PDOs will be read.
+   * If disabled, no PDOs will be read and the socket receives all frames again,
+   * so SDO transfers are possible.
    *
    * @see run()
    */
   virtual void disable() {
     enabled = false;
+    transport.clearFilter();
   }
   
   /**
@@ -219,6 +228,9 @@ class CanReceiveFaulhaber: public Block {
   Output<Matrix<N,1,uint32_t>> warning;
   std::vector<uint8_t> nodes;
   std::vector<uint8_t> functionCodes;
+  std::vector<canid_t> ids;
+  CanTransport transport;
+  CanNodeTable nodeTable;
   Logger log;
 };
 
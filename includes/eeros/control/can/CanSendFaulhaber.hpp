@@ -5,8 +5,10 @@
 #include <eeros/control/Block.hpp>
 #include <eeros/control/Input.hpp>
 #include <eeros/control/Output.hpp>
+#include <eeros/control/FaultStatus.hpp>
 #include <eeros/math/Matrix.hpp>
 #include <eeros/core/Fault.hpp>
+#include <eeros/control/can/CanTransport.hpp>
 #include <canopen-com.h>
 
 using namespace eeros::control;
@@ -46,7 +48,7 @@ class CanSendFaulhaber : public Block {
    * @param functionCode - vector with function codes of all PDO's to be received
    */
   CanSendFaulhaber(int socket, std::initializer_list<uint8_t> node, std::initializer_list<uint8_t> functionCode)
-      : socket(socket), nodes(node), functionCodes(functionCode), log(Logger::getLogger('Y')) {
+      : socket(socket), vel(this), nodes(node), functionCodes(functionCode), transport(socket), log(Logger::getLogger('Y')) {
     for (size_t i = 0; i < node.size(); i++) {
       velScale[i] = 1;
     }
@@ -57,7 +59,11 @@ class CanSendFaulhaber : public Block {
 
   /**
    * Transmits on the CAN bus. If enabled a sync package is sent for each run. After this the block
-   * will send two RPDO's to each of the connected CAN nodes.
+   * will send two RPDO's to each of the connected CAN nodes. The frames of a run are
+   * written to the socket at once, in batches of CanTransport::maxFrames frames if there
+   * are more. Frames the socket cannot take because its send queue is full are dropped
+   * and counted, see \ref getDropped(). The time domain is notified through its 
+   * \ref FaultStatus, without a time domain a Fault is thrown.
    * The RPDO2 will only be sent if the drive is set to interpolated position mode.
    *
    * If enabled transmits 2 PDO's to each CAN node. 
@@ -67,26 +73,28 @@ class CanSendFaulhaber : public Block {
    */
   virtual void run() {
     if (enabled) {
-      int err;
-      if ((err = canopen_send_sync(socket)) != 0) throw eeros::Fault("send sync failed");
-        
+      send(CanTransport::syncId, nullptr, 0);
+
       // send control word to all nodes
       for (uint32_t i = 0; i < nodes.size(); i++) {  
         if (ctrl[i] != lastCtrl[i]) {
           log.info() << "CAN ctrl changed for node " << std::to_string(nodes[i]) << ": send 0x" << std::hex << ctrl[i];
-          err = canopen_pdo_send_2bytes(socket, nodes[i], CANOPEN_FC_PDO1_RX, ctrl[i]);
+          uint8_t data[2] = {uint8_t(ctrl[i]), uint8_t(ctrl[i] >> 8)};
+          send(CanTransport::cobId(CANOPEN_FC_PDO1_RX, nodes[i]), data, sizeof(data));
           lastCtrl[i] = ctrl[i];
-          if (err != 0) throw eeros::Fault(std::string("CAN send ctrl to node ") + std::to_string(nodes[i]) + " failed");
         }
       }
         
       // send velocity reference to all nodes      
       if (ipMode) {
         for (std::size_t i = 0; i < nodes.size(); i++) {
-          err = canopen_pdo_send_4bytes(socket, nodes[i], CANOPEN_FC_PDO2_RX, vel.getSignal().getValue()[i] * velScale[i]);
-          if (err != 0) throw eeros::Fault("set of velocity over CAN failed");
+          uint32_t value = static_cast<int32_t>(vel.getSignal().getValue()[i] * velScale[i]);
+          uint8_t data[4] = {uint8_t(value), uint8_t(value >> 8), uint8_t(value >> 16), uint8_t(value >> 24)};
+          send(CanTransport::cobId(CANOPEN_FC_PDO2_RX, nodes[i]), data, sizeof(data));
         }
       }
+
+      flush();
     }
   }
         
@@ -99,6 +107,15 @@ class CanSendFaulhaber : public Block {
     return vel;
   }
           
+  /**
+   * Returns the number of frames dropped because the send queue of the socket was full.
+   * 
+   * @return number of dropped frames
+   */
+  virtual uint64_t getDropped() const {
+    return dropped;
+  }
+          
   /**
    * Setter function for the control word.
    * 
@@ -166,15 +183,33 @@ class CanSendFaulhaber : public Block {
   }
 
  private:
+  // queues a frame, a full queue is sent first
+  void send(canid_t id, const void* data, uint8_t len) {
+    if (transport.queue(id, data, len)) return;
+    flush();
+    if (!transport.queue(id, data, len)) throw eeros::Fault("CAN send failed, frame cannot be queued");
+  }
+
+  void flush() {
+    unsigned int queued = transport.getQueued();
+    unsigned int sent = transport.flush();
+    if (sent == queued) return;
+    dropped += queued - sent;
+    if (FaultStatus::raise(FaultCode::framesDropped, this)) return;
+    throw eeros::Fault(std::string("CAN send failed, ") + std::to_string(sent) + " of " + std::to_string(queued) + " frames sent");
+  }
+
   int socket;
   bool enabled = false;
   bool ipMode = false;
+  uint64_t dropped = 0;
   Input<Matrix<N,1,double>> vel;
   Matrix<N,1,double> velScale;
   Matrix<N,1,uint16_t> ctrl;
   Matrix<N,1,uint16_t> lastCtrl;
   std::vector<uint8_t> nodes;
   std::vector<uint8_t> functionCodes;
+  CanTransport transport;
   Logger log;
 };
 
@@ -0,0 +1,217 @@
+#ifndef ORG_EEROS_CONTROL_CANTRANSPORT_HPP_
+#define ORG_EEROS_CONTROL_CANTRANSPORT_HPP_
+
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/errqueue.h>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace eeros {
+namespace control {
+
+/**
+ * A CAN transport reads and writes frames on a CAN socket, see \ref CanHandle, in batches.
+ * All frames pending on the socket are read with a single call to recvmmsg, all frames
+ * queued during a cycle are written with a single call to sendmmsg. This keeps the number
+ * of system calls per cycle independent of the number of nodes on the bus.
+ *
+ * A receive filter can be installed, so the kernel only delivers frames with the
+ * given identifiers. If enabled, each received frame is stamped with the time the
+ * kernel received it, converted to the time base of \ref System::getTimeNs().
+ *
+ * The transport keeps pointers to its own buffers and must therefore not be copied.
+ *
+ * @since v1.4
+ */
+class CanTransport {
+ public:
+  /**
+   * Maximum number of frames read by one call to \ref receive() or queued for \ref flush().
+   */
+  static constexpr unsigned int maxFrames = 64;
+
+  /**
+   * Identifier of the CANopen SYNC frame.
+   */
+  static constexpr canid_t syncId = 0x80;
+
+  /**
+   * Constructs a transport on a socket. The socket is not closed by the transport.
+   *
+   * @param socket - CAN socket, see \ref CanHandle::getSocket()
+   */
+  explicit CanTransport(int socket);
+
+  CanTransport(const CanTransport&) = delete;
+  CanTransport& operator=(const CanTransport&) = delete;
+
+  /**
+   * Lets the kernel deliver only frames with one of the given identifiers.
+   * Throws a Fault if the filter cannot be set.
+   *
+   * @param ids - standard frame identifiers to be received
+   */
+  void setFilter(const std::vector<canid_t>& ids);
+
+  /**
+   * Lets the kernel deliver all frames again, as without a filter.
+   * Throws a Fault if the filter cannot be set.
+   */
+  void clearFilter();
+
+  /**
+   * Stamps received frames with the time the kernel received them instead
+   * of the time of \ref receive(). Throws a Fault if the socket does not support it.
+   */
+  void enableTimestamps();
+
+  /**
+   * Reads the frames pending on the socket, at most \ref maxFrames.
+   * Does not block.
+   *
+   * @return number of frames read
+   */
+  unsigned int receive();
+
+  /**
+   * Returns a frame read by the last call to \ref receive().
+   *
+   * @param i - index of the frame
+   * @return frame
+   */
+  const can_frame& getFrame(unsigned int i) const { return rxFrame[i]; }
+
+  /**
+   * Returns the time a frame read by the last call to \ref receive() was received.
+   *
+   * @param i - index of the frame
+   * @return time in ns, see \ref System::getTimeNs()
+   */
+  uint64_t getTimestamp(unsigned int i) const { return rxTime[i]; }
+
+  /**
+   * Queues a frame to be sent by the next call to \ref flush().
+   *
+   * @param id - frame identifier
+   * @param data - payload
+   * @param len - length of the payload, at most 8 bytes
+   * @return false, if the queue is full
+   */
+  bool queue(canid_t id, const void* data, uint8_t len);
+
+  /**
+   * Sends all queued frames in the order they were queued and empties the queue.
+   * Frames which the socket cannot take without blocking are dropped.
+   * Throws a Fault if sending fails for any other reason.
+   *
+   * @return number of frames sent
+   */
+  unsigned int flush();
+
+  /**
+   * Returns the number of frames waiting in the queue.
+   *
+   * @return number of queued frames
+   */
+  unsigned int getQueued() const { return txCount; }
+
+  /**
+   * Returns the number of failed receive calls, apart from calls finding no frames.
+   *
+   * @return number of errors
+   */
+  uint64_t getErrors() const { return errors; }
+
+  /**
+   * Builds the identifier of a CANopen frame.
+   *
+   * @param functionCode - CANopen function code, 4 bit
+   * @param node - node id, 7 bit
+   * @return frame identifier
+   */
+  static canid_t cobId(uint8_t functionCode, uint8_t node) {
+    return (static_cast<canid_t>(functionCode & 0xF) << 7) | (node & 0x7F);
+  }
+
+  /**
+   * Returns the CANopen function code of a frame identifier.
+   *
+   * @param id - frame identifier
+   * @return function code
+   */
+  static uint8_t functionCode(canid_t id) { return (id >> 7) & 0xF; }
+
+  /**
+   * Returns the CANopen node id of a frame identifier.
+   *
+   * @param id - frame identifier
+   * @return node id
+   */
+  static uint8_t nodeId(canid_t id) { return id & 0x7F; }
+
+ private:
+  static constexpr std::size_t controlSize = CMSG_SPACE(sizeof(scm_timestamping));
+
+  int socket;
+  bool timestamps;
+  uint64_t errors;
+  unsigned int txCount;
+  std::array<can_frame, maxFrames> rxFrame;
+  std::array<uint64_t, maxFrames> rxTime;
+  std::array<can_frame, maxFrames> txFrame;
+  std::array<iovec, maxFrames> rxIov;
+  std::array<iovec, maxFrames> txIov;
+  std::array<mmsghdr, maxFrames> rxMsg;
+  std::array<mmsghdr, maxFrames> txMsg;
+  alignas(cmsghdr) char rxControl[maxFrames][controlSize];
+};
+
+/**
+ * Maps CANopen node ids to the index of the node in a block, e.g. the element of
+ * an output vector. The lookup is a single array access.
+ *
+ * @since v1.4
+ */
+class CanNodeTable {
+ public:
+  /**
+   * Node ids are 7 bit.
+   */
+  static constexpr unsigned int size = 128;
+
+  /**
+   * Constructs a table, the node at position i gets index i.
+   *
+   * @param nodes - node ids
+   */
+  CanNodeTable(std::initializer_list<uint8_t> nodes) : CanNodeTable(std::vector<uint8_t>(nodes)) { }
+
+  /**
+   * Constructs a table, the node at position i gets index i.
+   *
+   * @param nodes - node ids
+   */
+  CanNodeTable(const std::vector<uint8_t>& nodes) {
+    index.fill(-1);
+    for (std::size_t i = 0; i < nodes.size(); i++) index[nodes[i] & 0x7F] = i;
+  }
+
+  /**
+   * Returns the index of a node.
+   *
+   * @param node - node id
+   * @return index of the node, -1 if the node is unknown
+   */
+  int operator[](uint8_t node) const { return index[node & 0x7F]; }
+
+ private:
+  std::array<int16_t, size> index;
+};
+
+}
+}
+
+#endif // ORG_EEROS_CONTROL_CANTRANSPORT_HPP_
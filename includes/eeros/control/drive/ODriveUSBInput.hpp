@@ -60,7 +60,7 @@ class ODriveUSBInput : public Blockio<1,3,Vector2> {
     Vector2 setp; setp << setp0, setp1;
     out[2].getSignal().setValue(setp);
     // set timestamps
-    uint64_t ts = eeros::System::getTimeNs();
+    uint64_t ts = eeros::System::getCycleTimeNs();
     out[0].getSignal().setTimestamp(ts);
     out[1].getSignal().setTimestamp(ts);
     out[2].getSignal().setTimestamp(ts);
@@ -27,7 +27,8 @@ class ElmoOutput : public Blockio<0,0,double,double> {
    *
    * @param iface - reference to Elmo drive
    */
-  ElmoOutput(ecmasterlib::device::Elmo& iface) : iface(iface) { }
+  ElmoOutput(ecmasterlib::device::Elmo& iface)
+      : iface(iface), position(this), velocity(this), torque(this), torqueMax(this) { }
           
   /**
    * Puts the signal inputs to the Elmo drive.
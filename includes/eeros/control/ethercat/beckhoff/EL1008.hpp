@@ -45,7 +45,7 @@ class BeckhoffEL1008 : public Blockio<0,8,bool,bool> {
    */
   virtual void run() {
     int val = iface.getInputs();
-    uint64_t ts = eeros::System::getTimeNs();
+    uint64_t ts = eeros::System::getCycleTimeNs();
     for(int i = 0; i < 8; i++) {
       out[i].getSignal().setValue((val & (1 << i)) != 0);
       out[i].getSignal().setTimestamp(ts);
@@ -33,7 +33,7 @@ class BeckhoffEL3004 : public Blockio<0,4,double,double> {
    * Puts the drive inputs onto the analog output signals.
    */
   virtual void run() {
-    uint64_t ts = eeros::System::getTimeNs();
+    uint64_t ts = eeros::System::getCycleTimeNs();
     for(int i = 0; i < 4; i++) {
       out[i].getSignal().setValue((double)iface[i] / 3276.8);
       out[i].getSignal().setTimestamp(ts);
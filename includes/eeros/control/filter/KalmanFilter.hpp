@@ -9,7 +9,7 @@
 #include <eeros/control/DeMux.hpp>
 #include <eeros/control/IndexOutOfBoundsFault.hpp>
 #include <eeros/math/Matrix.hpp>
-#include <mutex>
+#include <eeros/core/TripleBuffer.hpp>
 
 using namespace eeros::math;
 
@@ -74,6 +74,15 @@ class KalmanFilterCorrection;
  * prediction and the other one for the correction. The correction block
  * should be run after reading the sensor values, while the prediction block should 
  * run after the input vector is defined. The two blocks can run in different time domains.
+ * Each block keeps its own copy of the estimate and only runs in the thread of its time
+ * domain. After each run it hands its estimate over to the other block through a triple
+ * buffer, which picks it up at the beginning of its next run. Neither of them ever waits
+ * for the other. Predictions which ran while a correction was computed are applied again
+ * to the corrected estimate, with the latest system input. In the same time domain, the
+ * results are the same as if both blocks worked on one estimate.
+ * 
+ * The state outputs \ref getX() are written by the prediction block, the outputs
+ * \ref getXCorrected() by the correction block, each in its own time domain.
  * 
  * @tparam nofInputs - number of system inputs
  * @tparam nofOutputs - number of system outputs
@@ -107,10 +116,11 @@ class KalmanFilter : public Blockio<0,0>{
                Matrix<nofOutputs, nofOutputs> R)
         : Ad(Ad), Bd(Bd), C(C), Gd(Gd), Q(Q), R(R), predict(this), correct(this) {
     this->D.zero();
-    this->x.zero();
-    this->P.eye();
     this->eye.eye();
     this->GdQGdT = Gd * Q * Gd.transpose();
+    Vector<nofStates> x;
+    x.zero();
+    init(eye, x);
   }
   
   /**
@@ -134,10 +144,11 @@ class KalmanFilter : public Blockio<0,0>{
                Matrix<nofRandVars, nofRandVars> Q,
                Matrix<nofOutputs, nofOutputs> R)
       : Ad(Ad), Bd(Bd), C(C), D(D), Gd(Gd), Q(Q), R(R), predict(this), correct(this) {
-    this->x.zero();
-    this->P.eye();
     this->eye.eye();
     this->GdQGdT = Gd * Q * Gd.transpose();
+    Vector<nofStates> x;
+    x.zero();
+    init(eye, x);
   }
     
   /**
@@ -162,9 +173,10 @@ class KalmanFilter : public Blockio<0,0>{
                Matrix<nofOutputs, nofOutputs> R,
                Matrix<nofStates, nofStates> P,
                Vector<nofStates> x)
-      : Ad(Ad), Bd(Bd), C(C), D(D), Gd(Gd), Q(Q), R(R), P(P), x(x), predict(this), correct(this) {
+      : Ad(Ad), Bd(Bd), C(C), D(D), Gd(Gd), Q(Q), R(R), predict(this), correct(this) {
     this->eye.eye();
     this->GdQGdT = Gd * Q * Gd.transpose();
+    init(P, x);
   }
 
   /**
@@ -194,7 +206,8 @@ class KalmanFilter : public Blockio<0,0>{
   }
 
   /**
-   * Get vector element with index index of system state vector x.
+   * Get vector element with index index of system state vector x, 
+   * as estimated by the last prediction. Written by the prediction block.
    * 
    * @param index - element index
    */
@@ -207,34 +220,55 @@ class KalmanFilter : public Blockio<0,0>{
   }
 
   /**
-   * Predict current system state
+   * Get vector element with index index of system state vector x, 
+   * as estimated by the last correction. Written by the correction block.
+   * 
+   * @param index - element index
+   */
+  Output<double> &getXCorrected(uint8_t index) {
+    if (index < 0 || index >= nofStates) {
+      throw eeros::control::IndexOutOfBoundsFault("Trying to get inexistent element of system state vector x in Block " +
+                                                      this->getName() + ".");
+    }
+    return outCorrected[index];
+  }
+
+  /**
+   * Predict current system state. Must only be called by the thread running the prediction block.
    */
   void prediction() {
-    std::lock_guard<std::mutex> lock(mtx);
+    Vector<nofInputs> u;
     for (uint8_t i = 0; i < nofInputs; i++)
     {
         u[i] = inU[i].getSignal().getValue();
     }
-    x = Ad * x + Bd * u;
+    if (toPrediction.update()) {
+      // predictions which ran while the correction was computed are applied again
+      Estimate& c = toPrediction.front();
+      while (c.step < predicted.step) advance(c, u);
+      predicted = c;
+    }
+    advance(predicted, u);
+    uint64_t time = eeros::System::getCycleTimeNs();
     for (uint8_t i = 0; i < nofStates; i++) {
-      out[i].getSignal().setValue(x[i]);
-      out[i].getSignal().setTimestamp(eeros::System::getTimeNs());
+      out[i].getSignal().setValue(predicted.x[i]);
+      out[i].getSignal().setTimestamp(time);
     }
-    P = Ad * P * Ad.transpose() + GdQGdT;
+    toCorrection.back() = predicted;
+    toCorrection.publish();
   }
 
   /**
-   * Correct current system state
+   * Correct current system state. Must only be called by the thread running the correction block.
    */
   void correction() {
-    std::lock_guard<std::mutex> lock(mtx);
+    if (toCorrection.update()) corrected = toCorrection.front();
+    uint64_t time = eeros::System::getCycleTimeNs();
     if (first) {
-      for (uint8_t i = 0; i < nofStates; i++) {
-        out[i].getSignal().setValue(x[i]);
-        out[i].getSignal().setTimestamp(eeros::System::getTimeNs());
-      }
       first = false;
     } else {
+      Vector<nofOutputs> y;
+      Vector<nofInputs> u;
       for (uint8_t i = 0; i < nofOutputs; i++)
       {
           y[i] = inY[i].getSignal().getValue();
@@ -243,28 +277,61 @@ class KalmanFilter : public Blockio<0,0>{
       {
           u[i] = inU[i].getSignal().getValue();
       }
-      CPCTR = (C * P * C.transpose() + R);
-      K = P * C.transpose() * !CPCTR;
-      dy = y - C * x - D * u;
-      x = x + K * dy;
-      for (uint8_t i = 0; i < nofStates; i++) {
-        out[i].getSignal().setValue(x[i]);
-        out[i].getSignal().setTimestamp(eeros::System::getTimeNs());
-      }
-      P = (eye - K * C) * P;
+      CPCTR = (C * corrected.P * C.transpose() + R);
+      K = corrected.P * C.transpose() * !CPCTR;
+      dy = y - C * corrected.x - D * u;
+      corrected.x = corrected.x + K * dy;
+      corrected.P = (eye - K * C) * corrected.P;
+      toPrediction.back() = corrected;
+      toPrediction.publish();
+    }
+    for (uint8_t i = 0; i < nofStates; i++) {
+      outCorrected[i].getSignal().setValue(corrected.x[i]);
+      outCorrected[i].getSignal().setTimestamp(time);
     }
   }
 
  protected:
-  std::mutex mtx;
-  Vector<nofStates> x;
+  // estimate of the state and covariance, step counts the predictions it contains
+  struct Estimate {
+    Vector<nofStates> x;
+    Matrix<nofStates, nofStates> P;
+    uint64_t step;
+  };
+
+  void advance(Estimate& e, const Vector<nofInputs>& u) {
+    e.x = Ad * e.x + Bd * u;
+    e.P = Ad * e.P * Ad.transpose() + GdQGdT;
+    e.step++;
+  }
+
+  void init(const Matrix<nofStates, nofStates>& P, const Vector<nofStates>& x) {
+    predicted = corrected = Estimate{x, P, 0};
+    for (uint8_t i = 0; i < nofOutputs; i++) inY[i].setOwner(this);
+    for (uint8_t i = 0; i < nofInputs; i++) inU[i].setOwner(this);
+    // the inputs are read by the prediction and the correction block
+    for (uint8_t i = 0; i < nofOutputs; i++) correct.registerInput(&inY[i]);
+    for (uint8_t i = 0; i < nofInputs; i++) {
+      predict.registerInput(&inU[i]);
+      correct.registerInput(&inU[i]);
+    }
+    for (uint8_t i = 0; i < nofStates; i++) {
+      out[i].setOwner(&predict);
+      outCorrected[i].setOwner(&correct);
+    }
+    // the prediction depends on the correction, a parallel time domain runs them in one thread
+    predict.getCorrected().connect(outCorrected[0]);
+  }
+
+  Estimate predicted;     // used by the prediction block only
+  Estimate corrected;     // used by the correction block only
+  TripleBuffer<Estimate> toPrediction, toCorrection;
   Vector<nofOutputs> dy;
-  Vector<nofOutputs> y;
-  Vector<nofInputs> u;
   Input<double> inY[nofOutputs];
   Input<double> inU[nofInputs];
   Output<double> out[nofStates];
-  Matrix<nofStates, nofStates> Ad, P, eye, GdQGdT;
+  Output<double> outCorrected[nofStates];
+  Matrix<nofStates, nofStates> Ad, eye, GdQGdT;
   Matrix<nofStates, nofInputs> Bd;
   Matrix<nofStates, nofOutputs> K;
   Matrix<nofOutputs, nofStates> C;
@@ -291,14 +358,23 @@ template <uint8_t nofInputs, uint8_t nofOutputs, uint8_t nofStates, uint8_t nofR
 class KalmanFilterPrediction : public Block {
  public:
   KalmanFilterPrediction(KalmanFilter<nofInputs, nofOutputs, nofStates, nofRandVars> *owner)
-      : owner(owner) {}
+      : owner(owner), corrected(this) {}
 
   virtual void run() {
     owner->prediction();
   }
 
+  /**
+   * Input connected to the corrected estimate. It is never read, it only tells a parallel
+   * time domain that the prediction depends on the correction.
+   */
+  Input<double>& getCorrected() {
+    return corrected;
+  }
+
  private:
   KalmanFilter<nofInputs, nofOutputs, nofStates, nofRandVars> *owner;
+  Input<double> corrected;
 };
 
 template <uint8_t nofInputs, uint8_t nofOutputs, uint8_t nofStates, uint8_t nofRandVars>
@@ -22,11 +22,14 @@ class RosPublisherLaserScan : public RosPublisher<sensor_msgs::LaserScan::Type,
   typedef sensor_msgs::LaserScan::Type	TRosMsg;
  public:
   RosPublisherLaserScan(const std::string& topic, const std::string& frame_id, const uint32_t queueSize=1000) 
-      : RosPublisher<TRosMsg, double>(topic, queueSize), frame_id(frame_id) { }
+      : RosPublisher<TRosMsg, double>(topic, queueSize),
+        angle_minInput(this), angle_maxInput(this), angle_incrementInput(this), time_incrementInput(this),
+        scan_timeInput(this), range_minInput(this), range_maxInput(this),
+        rangesInput(this), intensitiesInput(this), frame_id(frame_id) { }
 
   void setRosMsg(TRosMsg& msg) {
     // B-3 If available, set time in msg header
-    msg.header.stamp = eeros::control::rosTools::convertToRosTime(eeros::System::getTimeNs());
+    msg.header.stamp = eeros::control::rosTools::convertToRosTime(eeros::System::getCycleTimeNs());
     msg.header.frame_id = frame_id;
     
     // B-4 Check if EEROS input is connected. Cast the data. Assign casted data to ROS message field
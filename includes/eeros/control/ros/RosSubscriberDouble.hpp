@@ -45,7 +45,7 @@ class RosSubscriberDouble : public RosSubscriber<std_msgs::Float64::Type, double
    * @param msg - message content
    */
   virtual void rosCallbackFct(const TRosMsg& msg) {
-    auto time = eeros::System::getTimeNs();	// use system time for timestamp
+    auto time = eeros::System::getCycleTimeNs();	// use cycle time for timestamp
     this->out.getSignal().setTimestamp( time );
     this->out.getSignal().setValue(static_cast<double>(msg.data) );
   }
@@ -48,7 +48,7 @@ class RosSubscriberDoubleArray : public RosSubscriber<std_msgs::Float64MultiArra
    * @param msg - message content
    */
   void rosCallbackFct(const TRosMsg& msg) {
-    auto time = eeros::System::getTimeNs();	// use system time for timestamp
+    auto time = eeros::System::getCycleTimeNs();	// use cycle time for timestamp
     this->out.getSignal().setTimestamp( time );
     std::vector<double> valTmp(msg.data.begin(), msg.data.end() );
     val.setCol(0, valTmp);
@@ -34,7 +34,7 @@ class BaumerOM70Input: public Blockio<0,1,double> {
    * @param priority - execution priority or BaumerOM70 thread, to get sensors data
    */
   BaumerOM70Input(std::string dev, int port, int slaveId, int priority = 5) 
-      : om70(dev, port, slaveId, priority), log(Logger::getLogger()) { }
+      : newSample(this), om70(dev, port, slaveId, priority), log(Logger::getLogger()) { }
   
   /**
    * Disabling use of copy constructor because the block should never be copied unintentionally.
@@ -42,14 +42,32 @@ class BaumerOM70Input: public Blockio<0,1,double> {
   BaumerOM70Input(const BaumerOM70Input& s) = delete; 
   
   /**
-   * Gets input data from Baumer OM70 thread and outputs them
+   * Gets input data from Baumer OM70 thread and outputs them.
+   * The output is only written when a new distance was measured, its 
+   * timestamp is the time of acquisition.
    */
   virtual void run() {
-    this->out.getSignal().setValue(om70.getDistance());
-    this->out.getSignal().setTimestamp(eeros::System::getTimeNs());
+    bool isNew = om70.update();
+    auto& sample = om70.getSample();
+    if (isNew) {
+      this->out.getSignal().setValue(sample.value);
+      this->out.getSignal().setTimestamp(sample.timestamp);
+    }
+    newSample.getSignal().setValue(isNew);
+    newSample.getSignal().setTimestamp(sample.timestamp);
+  }
+  
+  /**
+   * Gets the output which is true in the cycle a new distance arrived
+   * 
+   * @return new sample output
+   */
+  virtual Output<bool>& getOutNewSample() {
+    return newSample;
   }
       
  protected:        
+  Output<bool> newSample;
   BaumerOM70 om70;
   Logger log;
 };
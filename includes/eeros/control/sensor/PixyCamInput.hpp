@@ -82,6 +82,15 @@ class PixyCamInput : public Blockio<0,1,Vector3> {
     p.setLamp(white, rgb);
   }
 
+  /**
+   * Gets the output which is true in the cycle a new frame arrived
+   * 
+   * @return new sample output
+   */
+  virtual Output<bool>& getOutNewSample() {
+    return outNew;
+  }
+
   /**
    * Gets the number of detected blocks
    * 
@@ -92,24 +101,32 @@ class PixyCamInput : public Blockio<0,1,Vector3> {
   }
 
   /**
-   * Gets input data from the camera thread and outputs it
+   * Gets input data from the camera thread and outputs it.
+   * The outputs are only written when a new frame was evaluated, their 
+   * timestamp is the time of acquisition.
    */
   virtual void run() {
-    out.getSignal().setValue(p.getPos());
-    auto t = eeros::System::getTimeNs();
-    out.getSignal().setTimestamp(t);
+    bool isNew = p.update();
+    auto& frame = p.getFrame();
+    auto t = frame.timestamp;
+    if (isNew) {
+      out.getSignal().setValue(frame.value.output);
+      out.getSignal().setTimestamp(t);
   
-    outRaw.getSignal().setValue(p.getPosRaw());
-    outRaw.getSignal().setTimestamp(t);
+      outRaw.getSignal().setValue(frame.value.outputRaw);
+      outRaw.getSignal().setTimestamp(t);
   
-    outDots.getSignal().setValue(p.getDots());
-    outDots.getSignal().setTimestamp(t);
+      outDots.getSignal().setValue(frame.value.pos);
+      outDots.getSignal().setTimestamp(t);
   
-    outHeight.getSignal().setValue(p.getHeight());
-    outHeight.getSignal().setTimestamp(t);
+      outHeight.getSignal().setValue(frame.value.height);
+      outHeight.getSignal().setTimestamp(t);
   
-    outValid.getSignal().setValue(p.isDataValid());
-    outValid.getSignal().setTimestamp(t);
+      outValid.getSignal().setValue(frame.value.valid);
+      outValid.getSignal().setTimestamp(t);
+    }
+    outNew.getSignal().setValue(isNew);
+    outNew.getSignal().setTimestamp(t);
   }
 
  protected:
@@ -118,6 +135,7 @@ class PixyCamInput : public Blockio<0,1,Vector3> {
   Output<Matrix<nrDots,2,double>> outDots;
   Output<double> outHeight;
   Output<bool> outValid;
+  Output<bool> outNew;
 };
 
 /**
@@ -2,6 +2,7 @@
 #define ORG_EEROS_CONTROL_RPLIDAR_INPUT_HPP
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/control/Output.hpp>
 #include <eeros/math/Matrix.hpp>
 #include <eeros/hal/RPLidar.hpp> 
 
@@ -26,7 +27,7 @@ class RPLidarInput : public Blockio<0,2,Matrix<LASER_COUNT_MAX,1>> {
    * @param dev - string with device name
    * @param priority - execution priority of RPLidar thread to get sensors data
    */
-  RPLidarInput(std::string dev, int priority = 5) : rplidar(dev, priority) { }
+  RPLidarInput(std::string dev, int priority = 5) : newScan(this), rplidar(dev, priority) { }
         
   /**
    * Disabling use of copy constructor because the block should never be copied unintentionally.
@@ -34,20 +35,47 @@ class RPLidarInput : public Blockio<0,2,Matrix<LASER_COUNT_MAX,1>> {
   RPLidarInput(const RPLidarInput& s) = delete; 
   
   /**
-   * Runs the reading algorithm.
+   * Runs the reading algorithm. The outputs are only written when the lidar
+   * thread has acquired a new scan, the scans are handed over without locking.
    *
    * output[0] = angles
    * output[1] = ranges
-   * output timestamp = system time
+   * output timestamp = time of acquisition of the scan
    */
   virtual void run() {
-    this->out[0].getSignal().setValue(rplidar.getAngles());
-    this->out[1].getSignal().setValue(rplidar.getRanges());
-    uint64_t ts = eeros::System::getTimeNs();
-    this->out[0].getSignal().setTimestamp(ts);
+    bool isNew = rplidar.update();
+    auto& scan = rplidar.getScan();
+    if (isNew) {
+      this->out[0].getSignal().setValue(scan.value.angles);
+      this->out[1].getSignal().setValue(scan.value.ranges);
+      this->out[0].getSignal().setTimestamp(scan.timestamp);
+      this->out[1].getSignal().setTimestamp(scan.timestamp);
+    }
+    newScan.getSignal().setValue(isNew);
+    newScan.getSignal().setTimestamp(scan.timestamp);
+  }
+  
+  /**
+   * Gets the output which is true in the cycle a new scan arrived
+   * 
+   * @return new scan output
+   */
+  virtual Output<bool>& getOutNewSample() {
+    return newScan;
+  }
+  
+  /**
+   * Gets the number of scans which were overwritten by the lidar thread 
+   * before this block picked them up
+   * 
+   * @return number of dropped scans
+   */
+  uint64_t getDroppedScans() {
+    return rplidar.getDroppedScans();
   }
     
  private:                     
+  Output<bool> newScan;
   eeros::hal::RPLidar rplidar;
 };
 
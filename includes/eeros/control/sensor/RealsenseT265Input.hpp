@@ -36,24 +36,32 @@ class RealsenseT265Input : public Blockio<0,0> {
   
   
   /**
-   * Gets input data from Realsense Tracking T265 Thread and outputs them
+   * Gets input data from Realsense Tracking T265 Thread and outputs them.
+   * The outputs are only written when a new pose was acquired, their 
+   * timestamp is the time of acquisition.
    */
   virtual void run() {
-    translation.getSignal().setValue(t265.translation);
-    velocity.getSignal().setValue(t265.velocity);
-    acceleration.getSignal().setValue(t265.acceleration);
-    angularVelocity.getSignal().setValue(t265.angVelocity);
-    angularAcceleration.getSignal().setValue(t265.angAcceleration);
-    quaternion.getSignal().setValue(t265.quaternion);
+    bool isNew = t265.update();
+    auto& pose = t265.getPose();
+    if (isNew) {
+      translation.getSignal().setValue(pose.value.translation);
+      velocity.getSignal().setValue(pose.value.velocity);
+      acceleration.getSignal().setValue(pose.value.acceleration);
+      angularVelocity.getSignal().setValue(pose.value.angVelocity);
+      angularAcceleration.getSignal().setValue(pose.value.angAcceleration);
+      quaternion.getSignal().setValue(pose.value.quaternion);
       
-    // Timestamps
-    uint64_t ts = eeros::System::getTimeNs();
-    translation.getSignal().setTimestamp(ts);
-    velocity.getSignal().setTimestamp(ts);
-    acceleration.getSignal().setTimestamp(ts);
-    angularVelocity.getSignal().setTimestamp(ts);
-    angularAcceleration.getSignal().setTimestamp(ts);
-    quaternion.getSignal().setTimestamp(ts);
+      // Timestamps
+      uint64_t ts = pose.timestamp;
+      translation.getSignal().setTimestamp(ts);
+      velocity.getSignal().setTimestamp(ts);
+      acceleration.getSignal().setTimestamp(ts);
+      angularVelocity.getSignal().setTimestamp(ts);
+      angularAcceleration.getSignal().setTimestamp(ts);
+      quaternion.getSignal().setTimestamp(ts);
+    }
+    newPose.getSignal().setValue(isNew);
+    newPose.getSignal().setTimestamp(pose.timestamp);
   }
   
   /**
@@ -110,9 +118,19 @@ class RealsenseT265Input : public Blockio<0,0> {
     return quaternion;
   }
   
+  /**
+   * Gets the output which is true in the cycle a new pose arrived
+   * 
+   * @return new pose output
+   */
+  virtual Output<bool>& getOutNewSample(){
+    return newPose;
+  }
+  
  private:
   Output<Vector3> translation, velocity, acceleration, angularVelocity, angularAcceleration;
   Output<Vector4> quaternion;
+  Output<bool> newPose;
   eeros::hal::RealsenseT265 t265;
 };
 
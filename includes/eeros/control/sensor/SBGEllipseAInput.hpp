@@ -36,22 +36,30 @@ class SBGEllipseAInput: public Blockio<0,0> {
   SBGEllipseAInput(const SBGEllipseAInput& s) = delete; 
   
   /**
-   * Gets input data from SBGEllipseA thread and outputs them
+   * Gets input data from SBGEllipseA thread and outputs them.
+   * The outputs are only written when new data was received, their 
+   * timestamp is the time of reception.
    */
   virtual void run() {
-    euler.getSignal().setValue(SBGEllipseA::eulerData);
-    quaternion.getSignal().setValue(SBGEllipseA::quatData);
-    acc.getSignal().setValue(SBGEllipseA::accData);
-    gyro.getSignal().setValue(SBGEllipseA::gyroData);
-    timestamp.getSignal().setValue(SBGEllipseA::timestampEuler);
+    bool isNew = sbg.update();
+    auto& data = sbg.getData();
+    uint64_t ts = data.timestamp;
+    if (isNew) {
+      euler.getSignal().setValue(data.value.euler);
+      quaternion.getSignal().setValue(data.value.quat);
+      acc.getSignal().setValue(data.value.acc);
+      gyro.getSignal().setValue(data.value.gyro);
+      timestamp.getSignal().setValue(data.value.timestampEuler);
       
-    // Timestamps
-    uint64_t ts = eeros::System::getTimeNs();
-    euler.getSignal().setTimestamp(ts);
-    quaternion.getSignal().setTimestamp(ts);
-    acc.getSignal().setTimestamp(ts);
-    gyro.getSignal().setTimestamp(ts);
-    timestamp.getSignal().setTimestamp(ts);
+      // Timestamps
+      euler.getSignal().setTimestamp(ts);
+      quaternion.getSignal().setTimestamp(ts);
+      acc.getSignal().setTimestamp(ts);
+      gyro.getSignal().setTimestamp(ts);
+      timestamp.getSignal().setTimestamp(ts);
+    }
+    newSample.getSignal().setValue(isNew);
+    newSample.getSignal().setTimestamp(ts);
   }
   
   /**
@@ -99,10 +107,20 @@ class SBGEllipseAInput: public Blockio<0,0> {
     return timestamp;
   }
   
+  /**
+   * Gets the output which is true in the cycle new data arrived
+   * 
+   * @return new sample output
+   */
+  virtual Output<bool>& getOutNewSample() {
+    return newSample;
+  }
+  
  protected:
   Output<Vector3> euler, acc, gyro;
   Output<Vector4> quaternion;
   Output<uint32_t> timestamp;
+  Output<bool> newSample;
   
   SBGEllipseA sbg;
   Logger log;
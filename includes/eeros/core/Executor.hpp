@@ -6,6 +6,7 @@
 
 #include <eeros/core/Runnable.hpp>
 #include <eeros/core/PeriodicCounter.hpp>
+#include <eeros/core/Watchdog.hpp>
 #include <eeros/task/Periodic.hpp>
 #include <eeros/logger/Logger.hpp>
 
@@ -88,6 +89,45 @@ class Executor : public Runnable {
    */
   void add(control::TimeDomain &timedomain);
   
+  /**
+   * Runs the executor in simulation mode. Instead of waiting for the wall clock,
+   * the executor runs the main task and all harmonic tasks back to back on its own thread 
+   * and advances a simulated clock by one period per cycle. The simulated clock is 
+   * used by \ref System::getTimeNs() and therefore by all timestamps. The harmonic tasks 
+   * are run in a deterministic order and no realtime threads are created.
+   * Threads outside of the executor, e.g. sequences, still run in real time.
+   * 
+   * @param duration - simulated time in seconds after which the executor stops, 
+   *                   0 runs until \ref stop() is called
+   */
+  void useSimulatedTime(double duration = 0);
+
+  /**
+   * Lets the executor assign the phase offsets of all periodics without a phase set
+   * by \ref task::Periodic::setPhase(). Harmonic periodics, e.g. with 2, 4 and 10 times
+   * the base period, would otherwise all run on the same base tick. The phases are chosen
+   * such that the peak of the summed expected run times per base tick is minimal,
+   * see \ref task::Periodic::setExpectedRunTime(). Periodics without an expected run time
+   * are weighted with the mean of the others.
+   * The expected and the observed load per base tick is logged when the executor starts
+   * and stops.
+   *
+   * @param enable - true to assign phases automatically
+   */
+  void useAutoPhase(bool enable = true);
+
+  /**
+   * Monitors the executor and all periodics running in their own thread with a watchdog.
+   * When the executor starts, it adds a heartbeat for its main loop and one for each 
+   * of these periodics to the watchdog, each heartbeat is kicked once per period. 
+   * A task which hangs for the given number of its periods is detected by the watchdog.
+   * The watchdog is not used in simulation mode.
+   *
+   * @param watchdog - watchdog, must exist as long as the executor runs
+   * @param periods - number of periods without kick after which a heartbeat misses
+   */
+  void setWatchdog(Watchdog &watchdog, unsigned int periods = 3);
+
   virtual void run();
 
   static void prefault_stack();
@@ -108,12 +148,18 @@ class Executor : public Runnable {
  private:
   Executor();
   void assignPriorities();
+  void assignPhases();
   double period;
   task::Periodic* mainTask;
   std::vector<task::Periodic> tasks;
   bool syncWithEtherCatStackIsSet;
   bool syncWithRosTimeIsSet;
   bool syncWithRosTopicIsSet;
+  bool simulationIsSet;
+  double simulationDuration;
+  bool autoPhaseIsSet;
+  Watchdog *watchdog;
+  unsigned int watchdogPeriods;
   logger::Logger log;
 #ifdef USE_ETHERCAT
   ecmasterlib::EcMasterlibMain* etherCATStack;
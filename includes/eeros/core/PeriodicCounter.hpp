@@ -34,6 +34,7 @@ class PeriodicCounter {
   Statistics period;
   Statistics jitter;
   Statistics run;
+  Statistics latency;   // time from activation to start of the run, only measured by task::Async
 
   std::vector<MonitorFunc> monitors;
 
@@ -46,6 +47,7 @@ class PeriodicCounter {
   int reset_counter;
   time_point start;
   time_point last;
+  time_point runStart;
   logger::Logger log;
 };
 }
@@ -13,6 +13,61 @@ namespace eeros {
 		static double getTime();
 		static uint64_t getTimeNs();
 		
+		/**
+		 * Returns the start time of the cycle the calling thread is running, e.g. the
+		 * cycle of a time domain. All blocks of a cycle get the same time without reading 
+		 * the clock again. Outside of a cycle, the current time is returned.
+		 * 
+		 * @return cycle time in nanoseconds, see getTimeNs()
+		 */
+		static uint64_t getCycleTimeNs();
+		static double getCycleTime();
+		
+		/**
+		 * Sets the cycle time of the calling thread while the cycle exists.
+		 * Cycles can be nested, the previous cycle time is restored at the end.
+		 */
+		class Cycle {
+		public:
+			/**
+			 * Starts a cycle at the current time.
+			 */
+			Cycle();
+			
+			/**
+			 * Starts a cycle at a given time, e.g. the time of the cycle of another thread.
+			 * 
+			 * @param timeNs - cycle time in nanoseconds
+			 */
+			explicit Cycle(uint64_t timeNs);
+			~Cycle();
+			Cycle(const Cycle&) = delete;
+			Cycle& operator=(const Cycle&) = delete;
+			
+			/**
+			 * Returns the time of this cycle.
+			 * 
+			 * @return cycle time in nanoseconds
+			 */
+			uint64_t getTimeNs() const;
+			
+		private:
+			uint64_t timeNs;
+			uint64_t previousTimeNs;
+			bool previousActive;
+		};
+		
+		/**
+		 * Switches the system clock to a simulated clock. From now on, getTime() and
+		 * getTimeNs() return the simulated time which only advances through 
+		 * setSimulatedTimeNs(). Used by the executor in simulation mode.
+		 * 
+		 * @param startNs - initial value of the simulated clock in nanoseconds
+		 */
+		static void useSimulatedTime(uint64_t startNs = 0);
+		static void setSimulatedTimeNs(uint64_t timeNs);
+		static bool isSimulatedTime();
+		
 #ifdef USE_ROS
 		static void useRosTime();	
 #endif
@@ -0,0 +1,95 @@
+#ifndef ORG_EEROS_CORE_TRIPLEBUFFER_HPP_
+#define ORG_EEROS_CORE_TRIPLEBUFFER_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+namespace eeros {
+
+/**
+ * Wait-free exchange of samples between exactly one producer and one consumer thread.
+ * The producer fills the back slot and publishes it, the consumer picks up the latest
+ * published slot. Slots are exchanged by swapping indices, the samples themselves are
+ * never copied. Samples published faster than the consumer reads them are overwritten,
+ * the consumer always gets the newest one.
+ *
+ * A double buffer is not sufficient for a lock-free swap, because the producer would have
+ * to wait until the consumer releases the slot it reads. The third slot holds the sample
+ * which has been published but not yet picked up.
+ *
+ * @tparam T - type of a sample
+ *
+ * @since v1.4
+ */
+template < typename T >
+class TripleBuffer {
+ public:
+  TripleBuffer() : backIdx(0), frontIdx(1), middle(2) { }
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  /**
+   * Returns the slot the producer writes to. Must only be called by the producer.
+   *
+   * @return back slot
+   */
+  T& back() {
+    return slot[backIdx].value;
+  }
+
+  /**
+   * Publishes the back slot and hands a free slot to the producer.
+   * Must only be called by the producer.
+   */
+  void publish() {
+    backIdx = middle.exchange(backIdx | newFlag, std::memory_order_acq_rel) & idxMask;
+  }
+
+  /**
+   * Picks up the latest published slot, if any. Must only be called by the consumer.
+   *
+   * @return true, if a new slot was published since the last call
+   */
+  bool update() {
+    if ((middle.load(std::memory_order_relaxed) & newFlag) == 0) return false;
+    frontIdx = middle.exchange(frontIdx, std::memory_order_acq_rel) & idxMask;
+    return true;
+  }
+
+  /**
+   * Returns the slot the consumer reads from. Must only be called by the consumer.
+   *
+   * @return front slot
+   */
+  T& front() {
+    return slot[frontIdx].value;
+  }
+
+  /**
+   * Gives access to all slots, e.g. to initialize them before the buffer is shared.
+   *
+   * @param i - index of the slot, 0 to 2
+   * @return slot
+   */
+  T& operator[](unsigned int i) {
+    return slot[i].value;
+  }
+
+ private:
+  static constexpr uint8_t newFlag = 0x4;
+  static constexpr uint8_t idxMask = 0x3;
+
+  struct alignas(64) Slot {
+    T value;
+  };
+
+  Slot slot[3];
+  uint8_t backIdx;
+  alignas(64) uint8_t frontIdx;
+  alignas(64) std::atomic<uint8_t> middle;
+};
+
+}
+
+#endif /* ORG_EEROS_CORE_TRIPLEBUFFER_HPP_ */
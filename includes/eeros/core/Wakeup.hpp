@@ -0,0 +1,49 @@
+#ifndef ORG_EEROS_CORE_WAKEUP_HPP_
+#define ORG_EEROS_CORE_WAKEUP_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+namespace eeros {
+
+/**
+ * Binary wakeup signal for one waiting thread, based on a futex.
+ * Posting does not take a lock and only enters the kernel if the other
+ * thread is actually sleeping. In contrast to a counting \ref Semaphore,
+ * posts are not accumulated: a post while the previous one is still pending
+ * is reported and absorbed. The time of the pending post is stored so the
+ * woken thread can measure its wake latency.
+ *
+ * @since v1.4
+ */
+class Wakeup {
+ public:
+  Wakeup();
+
+  /**
+   * Wakes the waiting thread.
+   *
+   * @return false, if the previous post was not yet consumed by the waiting thread
+   */
+  bool post();
+
+  /**
+   * Blocks until the signal is posted and consumes the post.
+   */
+  void wait();
+
+  /**
+   * Returns the time of the last successful post.
+   *
+   * @return time in ns of the steady clock
+   */
+  int64_t getPostTimeNs() const;
+
+ private:
+  std::atomic<uint32_t> state;  // 0 idle, 1 posted, 2 thread sleeping
+  std::atomic<int64_t> postTime;
+};
+
+}
+
+#endif // ORG_EEROS_CORE_WAKEUP_HPP_
@@ -0,0 +1,186 @@
+#ifndef ORG_EEROS_CORE_WATCHDOG_HPP_
+#define ORG_EEROS_CORE_WATCHDOG_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <eeros/core/Statistics.hpp>
+#include <eeros/hal/Output.hpp>
+#include <eeros/logger/Logger.hpp>
+
+namespace eeros {
+
+namespace safety {
+class SafetySystem;
+class SafetyEvent;
+}
+
+/**
+ * The watchdog detects periodic tasks which stopped running, e.g. because a driver
+ * blocks or a task is caught in a loop. Every monitored task kicks its heartbeat once
+ * per cycle. A heartbeat misses if it was not kicked for the configured number of periods.
+ * The watchdog thread runs with the highest realtime priority and sleeps on a timer
+ * until the earliest deadline of all heartbeats, so a miss is detected while the task
+ * is still hanging, independent of the state of the executor.
+ *
+ * On a miss the watchdog logs the heartbeat, drives the registered outputs to their safe
+ * values and triggers the configured safety event or runs \ref safety::SafetySystem::exitHandler().
+ * The time from the deadline to the detection is recorded as detection latency.
+ * A heartbeat is armed by its first kick and is reported once per miss, it recovers
+ * with the next kick.
+ *
+ * @since v1.4
+ */
+class Watchdog {
+ public:
+  /**
+   * Heartbeat of one monitored task, created by \ref Watchdog::add().
+   */
+  class Heartbeat {
+   public:
+    Heartbeat(const std::string& name, int64_t timeoutNs);
+
+    /**
+     * Signals that the task is alive, call once per cycle. Does not block
+     * and does not enter the kernel.
+     */
+    void kick();
+
+    /**
+     * Stops monitoring the task until the next kick, e.g. when the task is stopped.
+     */
+    void disarm();
+
+    /**
+     * Gets the name of the heartbeat.
+     *
+     * @return name
+     */
+    const std::string& getName() const;
+
+    /**
+     * Gets the time after the last kick at which the heartbeat misses.
+     *
+     * @return timeout in s
+     */
+    double getTimeout() const;
+
+    /**
+     * Returns the number of detected misses.
+     *
+     * @return number of misses
+     */
+    uint64_t getMissCount() const;
+
+    /**
+     * Returns true while the heartbeat is missing.
+     *
+     * @return true if missing
+     */
+    bool isMissing() const;
+
+   private:
+    friend class Watchdog;
+    std::string name;
+    int64_t timeoutNs;
+    std::atomic<int64_t> lastKick;  // steady clock in ns, 0 until the first kick
+    std::atomic<uint64_t> misses;
+    std::atomic<bool> missing;
+    int64_t missedKick;             // last kick before the miss, used by the watchdog thread only
+  };
+
+  /**
+   * Creates a watchdog and starts its thread.
+   *
+   * @param priority - realtime priority of the watchdog thread, 0 for the highest priority
+   *                   of the system, 20 for a normal thread
+   */
+  explicit Watchdog(int priority = 0);
+
+  /**
+   * Stops the watchdog thread.
+   */
+  ~Watchdog();
+
+  Watchdog(const Watchdog&) = delete;
+  Watchdog& operator=(const Watchdog&) = delete;
+
+  /**
+   * Adds a heartbeat for a task with the given period. The heartbeat misses if it
+   * is not kicked for the given number of periods. Can be called while the watchdog runs.
+   *
+   * @param name - name of the heartbeat
+   * @param period - period of the task in s
+   * @param periods - number of periods without kick after which the heartbeat misses
+   * @return heartbeat, valid as long as the watchdog exists
+   */
+  Heartbeat& add(const std::string& name, double period, unsigned int periods = 3);
+
+  /**
+   * Triggers a safety event on every miss.
+   *
+   * @param ss - safety system
+   * @param event - event to trigger, must be a public event of the levels in which tasks may hang
+   */
+  void setSafetyEvent(safety::SafetySystem& ss, safety::SafetyEvent& event);
+
+  /**
+   * Runs \ref safety::SafetySystem::exitHandler() on every miss instead of triggering a safety event.
+   * Use it if the safety system itself is run by a task which may hang.
+   */
+  void useExitHandler();
+
+  /**
+   * Registers an output which is set to its safe value on every miss.
+   * The output is set from the watchdog thread.
+   *
+   * @param output - output, e.g. the enable signal of a drive
+   */
+  template < typename T >
+  void addSafeOutput(hal::Output<T>& output) {
+    std::lock_guard<std::mutex> lock(mutex);
+    actions.push_back([&output]() { output.set(output.safe); });
+  }
+
+  /**
+   * Returns the latency from the missed deadlines to their detection.
+   *
+   * @return detection latency in s
+   */
+  Statistics getDetectionLatency();
+
+  /**
+   * Returns the number of misses of all heartbeats.
+   *
+   * @return number of misses
+   */
+  uint64_t getMissCount() const;
+
+ private:
+  void run(int priority);
+  int64_t check(int64_t now);
+  void missed(Heartbeat& hb, int64_t now, int64_t deadline);
+  std::mutex mutex;
+  std::deque<Heartbeat> heartbeats;
+  std::vector<std::function<void()>> actions;
+  safety::SafetySystem* safetySystem;
+  safety::SafetyEvent* event;
+  bool exitHandler;
+  Statistics latency;
+  std::atomic<uint64_t> misses;
+  std::atomic<bool> finished;
+  int timerFd;
+  int wakeFd;
+  logger::Logger log;
+  std::thread thread;
+};
+
+}
+
+#endif // ORG_EEROS_CORE_WATCHDOG_HPP_
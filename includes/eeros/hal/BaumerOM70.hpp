@@ -3,6 +3,7 @@
 
 #include <eeros/core/Thread.hpp>
 #include <eeros/logger/Logger.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
 #include <modbus/modbus.h>    
 #include <atomic>
 
@@ -65,7 +66,23 @@ class BaumerOM70 : public eeros::Thread {
   void switchOffLaser();
     
   /**
-   * Gets distance measurement
+   * Picks up the latest distance measurement. Must only be called by the thread 
+   * reading the distance, typically the control system.
+   * 
+   * @return true, if a new distance was measured since the last call
+   */
+  bool update() { return distance.update(); }
+  
+  /**
+   * Gets the distance picked up by the last call to \ref update(), together with 
+   * the time of its acquisition and its sequence number
+   * 
+   * @return latest distance
+   */
+  const SampleBuffer<float>::Sample& getSample() { return distance.get(); }
+  
+  /**
+   * Gets distance measurement picked up by the last call to \ref update()
    * 
    * @return distance
    */
@@ -83,7 +100,7 @@ class BaumerOM70 : public eeros::Thread {
   int id;
   modbus_t *ctx;
   uint16_t tabReg[32];
-  float distance;
+  SampleBuffer<float> distance;
   uint32_t timestampUs;
   float measRate;
   Logger log;
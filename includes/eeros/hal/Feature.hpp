@@ -0,0 +1,69 @@
+#ifndef ORG_EEROS_HAL_FEATURE_HPP_
+#define ORG_EEROS_HAL_FEATURE_HPP_
+
+namespace eeros {
+namespace hal {
+
+template < typename Obj, typename Sig >
+class Feature;
+
+/**
+ * A feature is a function of a hardware wrapper library which configures hardware specific
+ * properties of an input or an output, e.g. the frequency of a pwm channel.
+ * This class holds such a feature function together with the input or output it belongs to.
+ * The feature function is resolved only once when the handle is created, calling the handle
+ * costs a single indirect function call. A handle can be obtained with HAL::feature().
+ *
+ * auto setFrequency = HAL::instance().feature<void(double)>(pwmOutput, "setPwmFrequency");
+ * setFrequency(100.0);
+ *
+ * @tparam Obj - type of the hal object, InputInterface or OutputInterface
+ * @tparam Args - argument types of the feature function (without the hal object)
+ *
+ * @since v1.4
+ */
+template < typename Obj, typename ... Args >
+class Feature<Obj, void(Args...)> {
+ public:
+  using FuncType = void (*)(Obj*, Args...);
+
+  /**
+   * Constructs an invalid feature handle which must not be called.
+   */
+  Feature() : obj(nullptr), func(nullptr) { }
+
+  /**
+   * Constructs a feature handle.
+   *
+   * @param obj - input or output the feature belongs to
+   * @param func - resolved feature function of the hardware wrapper library
+   */
+  Feature(Obj* obj, FuncType func) : obj(obj), func(func) { }
+
+  /**
+   * Calls the feature function.
+   *
+   * @param args - argument list of variable size
+   */
+  void operator()(Args... args) const {
+    func(obj, args...);
+  }
+
+  /**
+   * Checks if the handle holds a resolved feature function.
+   *
+   * @return true, if the feature can be called
+   */
+  bool isValid() const {
+    return obj != nullptr && func != nullptr;
+  }
+
+ private:
+  Obj* obj;
+  FuncType func;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_HAL_FEATURE_HPP_ */
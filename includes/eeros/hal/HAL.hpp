@@ -4,10 +4,12 @@
 #include <string>
 #include <map>
 #include <unordered_set>
+#include <mutex>
 #include <eeros/hal/Input.hpp>
 #include <eeros/hal/Output.hpp>
 #include <eeros/hal/ScalableOutput.hpp>
 #include <eeros/hal/ScalableInput.hpp>
+#include <eeros/hal/Feature.hpp>
 #include <eeros/hal/JsonParser.hpp>
 #include <eeros/core/Fault.hpp>
 
@@ -29,29 +31,77 @@ namespace eeros {
 			bool addInput(InputInterface* systemInput);
 			bool addOutput(OutputInterface* systemOutput);
 			
+			/**
+			 * Adds an input, an existing input with the same id is replaced. 
+			 * 
+			 * @param systemInput - input
+			 * @return replaced input, nullptr if no input with this id existed
+			 */
+			InputInterface* replaceInput(InputInterface* systemInput);
+			
+			/**
+			 * Removes an input added with addInput(), e.g. when the object implementing it is destroyed.
+			 * 
+			 * @param systemInput - input
+			 */
+			void removeInput(InputInterface* systemInput);
+			
+			/**
+			 * Removes an output added with addOutput(), e.g. when the object implementing it is destroyed.
+			 * 
+			 * @param systemOutput - output
+			 */
+			void removeOutput(OutputInterface* systemOutput);
+			
 			bool readConfigFromFile(std::string file);
 			bool readConfigFromFile(int* argc, char** argv);
 			
 			static HAL& instance();
 						
 			template<typename ... ArgTypesOut>
-			void callOutputFeature(OutputInterface *obj, std::string featureName, ArgTypesOut... args){
-				
-				void (*featureFunction)(OutputInterface*, ArgTypesOut...) = reinterpret_cast<void(*)(OutputInterface*, ArgTypesOut...)>(getOutputFeature(obj, featureName));
+			void callOutputFeature(OutputInterface *obj, const std::string& featureName, ArgTypesOut... args){
+				feature<void(ArgTypesOut...)>(obj, featureName)(args...);
+			}
+			
+			template<typename ... ArgTypesIn>
+			void callInputFeature(InputInterface *obj, const std::string& featureName, ArgTypesIn... args){
+				feature<void(ArgTypesIn...)>(obj, featureName)(args...);
+			}
+			
+			/**
+			 * Resolves a feature function of the hardware wrapper library of an output.
+			 * The returned handle can be called without any further lookup.
+			 *
+			 * @tparam Sig - signature of the feature function without the output, e.g. void(double)
+			 * @param obj - output
+			 * @param featureName - name of the feature function
+			 * @return feature handle
+			 */
+			template<typename Sig>
+			Feature<OutputInterface, Sig> feature(OutputInterface *obj, const std::string& featureName){
+				auto featureFunction = reinterpret_cast<typename Feature<OutputInterface, Sig>::FuncType>(getOutputFeature(obj, featureName));
 				if(featureFunction == nullptr){
 					throw Fault("could not find method in dynamic library: " + featureName);
 				}
-				featureFunction(obj, args...);
+				return Feature<OutputInterface, Sig>(obj, featureFunction);
 			}
 			
-			template<typename ... ArgTypesIn>
-			void callInputFeature(InputInterface *obj, std::string featureName, ArgTypesIn... args){
-				
-				void (*featureFunction)(InputInterface*, ArgTypesIn...) = reinterpret_cast<void(*)(InputInterface*, ArgTypesIn...)>(getInputFeature(obj, featureName));
+			/**
+			 * Resolves a feature function of the hardware wrapper library of an input.
+			 * The returned handle can be called without any further lookup.
+			 *
+			 * @tparam Sig - signature of the feature function without the input, e.g. void(int)
+			 * @param obj - input
+			 * @param featureName - name of the feature function
+			 * @return feature handle
+			 */
+			template<typename Sig>
+			Feature<InputInterface, Sig> feature(InputInterface *obj, const std::string& featureName){
+				auto featureFunction = reinterpret_cast<typename Feature<InputInterface, Sig>::FuncType>(getInputFeature(obj, featureName));
 				if(featureFunction == nullptr){
 					throw Fault("could not find method in dynamic library: " + featureName);
 				}
-				featureFunction(obj, args...);
+				return Feature<InputInterface, Sig>(obj, featureFunction);
 			}
 			
 		private:
@@ -61,10 +111,11 @@ namespace eeros {
 			
 			bool loadModule(std::string moduleName);
 			
-			void* getOutputFeature(std::string name, std::string featureName);
-			void* getOutputFeature(OutputInterface * obj, std::string featureName);
-			void* getInputFeature(std::string name, std::string featureName);
-			void* getInputFeature(InputInterface * obj, std::string featureName);
+			void* getOutputFeature(const std::string& name, const std::string& featureName);
+			void* getOutputFeature(OutputInterface * obj, const std::string& featureName);
+			void* getInputFeature(const std::string& name, const std::string& featureName);
+			void* getInputFeature(InputInterface * obj, const std::string& featureName);
+			void* getFeature(void* obj, void* libHandle, const std::string& featureName);
 			
 			std::unordered_set<OutputInterface*> exclusiveReservedOutputs;
 			std::unordered_set<OutputInterface*> nonExclusiveOutputs;
@@ -75,6 +126,8 @@ namespace eeros {
 			std::map<std::string, OutputInterface*> outputs;
 			
 			std::map<std::string, void*> hwLibraries;
+			std::map<void*, std::map<std::string, void*>> features;	// resolved feature functions per hal object
+			std::mutex featureMutex;
 			JsonParser parser;
 			
 			logger::Logger log;
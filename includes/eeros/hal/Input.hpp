@@ -20,7 +20,7 @@ class Input : public InputInterface {
   virtual ~Input() { }
   virtual inline std::string getId() const { return id; }
   virtual T get() = 0;
-  virtual uint64_t getTimestamp()	{ return System::getTimeNs(); }
+  virtual uint64_t getTimestamp()	{ return System::getCycleTimeNs(); }
   virtual void *getLibHandle() { return libHandle; }
  private:
   std::string id;
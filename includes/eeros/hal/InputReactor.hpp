@@ -0,0 +1,93 @@
+#ifndef ORG_EEROS_HAL_INPUTREACTOR_HPP_
+#define ORG_EEROS_HAL_INPUTREACTOR_HPP_
+
+#include <eeros/logger/Logger.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace eeros {
+namespace hal {
+
+/**
+ * This class is part of the hardware abstraction layer.
+ * A single thread waits with epoll on the file descriptors of all human input devices,
+ * such as \ref Mouse, \ref Keyboard, \ref XBox and \ref SpaceNavigator, and lets the
+ * device read all pending events as soon as its descriptor becomes readable. The thread
+ * sleeps in the kernel as long as no device sends events.
+ *
+ * The reactor is shared by all devices, it is created with the first device and stopped
+ * when the last device is destroyed.
+ *
+ * @since v1.4
+ */
+class InputReactor {
+ public:
+  /**
+   * A device served by the reactor.
+   */
+  class Device {
+   public:
+    virtual ~Device() { }
+
+    /**
+     * Called by the reactor thread whenever the descriptor of the device is readable.
+     * Reads all pending events, must not block.
+     *
+     * @return false, if the device has reached its end or failed and should be removed
+     */
+    virtual bool drain() = 0;
+  };
+
+  /**
+   * Returns the reactor, creates it if there is none.
+   *
+   * @param priority - priority of the reactor thread, only used when the reactor is created
+   * @return reactor
+   */
+  static std::shared_ptr<InputReactor> instance(int priority = 20);
+
+  ~InputReactor();
+
+  InputReactor(const InputReactor&) = delete;
+  InputReactor& operator=(const InputReactor&) = delete;
+
+  /**
+   * Registers a device.
+   *
+   * @param fd - descriptor of the device
+   * @param device - device which reads from the descriptor
+   */
+  void add(int fd, Device* device);
+
+  /**
+   * Unregisters a device. When this returns, the device is not called anymore.
+   *
+   * @param fd - descriptor of the device
+   */
+  void remove(int fd);
+
+  /**
+   * Returns the number of registered devices.
+   *
+   * @return number of devices
+   */
+  std::size_t getDevices();
+
+ private:
+  explicit InputReactor(int priority);
+  void run(int priority);
+
+  int epollFd;
+  int stopFd;
+  std::mutex mutex;  // held while devices are called
+  std::unordered_map<int, Device*> devices;
+  logger::Logger log;
+  std::thread thread;
+};
+
+}
+}
+
+#endif // ORG_EEROS_HAL_INPUTREACTOR_HPP_
@@ -2,6 +2,8 @@
 #define ORG_EEROS_HAL_KEYLIST_HPP_
 
 #include <vector>
+#include <deque>
+#include <atomic>
 #include <string>
 
 namespace eeros {
@@ -10,7 +12,8 @@ namespace hal {
 /**
  * This class is part of the hardware abstraction layer. 
  * It holds registered keyboard keys, which in turn can be read by a control block
- * input or a critical input to the safety system.
+ * input or a critical input to the safety system. The state of the keys is written
+ * by the thread of the \ref InputReactor and can be read from any thread.
  *
  * @since v1.2
  */
@@ -42,8 +45,8 @@ class KeyList {
     for (auto k : asciiCode) {
       this->key.push_back(name[nofKeys]);
       this->asciiCode.push_back(k);
-      this->state.push_back(false);
-      this->event.push_back(false);
+      this->state.emplace_back(false);
+      this->event.emplace_back(false);
       nofKeys++;
     }
   }
@@ -51,8 +54,8 @@ class KeyList {
   uint8_t nofKeys;
   std::vector<std::string> key;
   std::vector<char> asciiCode;
-  std::vector<bool> state;
-  std::vector<bool> event;
+  std::deque<std::atomic<bool>> state;
+  std::deque<std::atomic<bool>> event;
 };
 
 }
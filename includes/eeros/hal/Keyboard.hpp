@@ -2,7 +2,8 @@
 #define ORG_EEROS_HAL_KEYBOARD_HPP_
 
 #include <termios.h>
-#include <eeros/core/Thread.hpp>
+#include <memory>
+#include <eeros/hal/InputReactor.hpp>
 
 namespace eeros {
 namespace hal {
@@ -12,17 +13,20 @@ namespace hal {
  * It is used by \ref eeros::control::KeyboardInput and \ref eeros::hal::KeyboardDigIn class. 
  * Do not use it directly.
  *
+ * The standard input is read by the \ref InputReactor.
+ *
  * @since v0.6
  */
-class Keyboard : public Thread {
+class Keyboard : public InputReactor::Device {
  public:
   explicit Keyboard(int priority);
   ~Keyboard();
+
+  virtual bool drain();
   
  private:
-  virtual void run();
-  bool running;
   struct termios tio;
+  std::shared_ptr<InputReactor> reactor;
 };
 
 }
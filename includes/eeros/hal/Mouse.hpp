@@ -3,9 +3,13 @@
 
 #include <string>
 #include <functional>
+#include <memory>
+#include <atomic>
 #include <linux/input.h>
 #include <eeros/hal/Input.hpp>
-#include <eeros/core/Thread.hpp>
+#include <eeros/hal/InputReactor.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
+#include <eeros/logger/Logger.hpp>
 
 #define MOUSE_BUTTON_COUNT (16)
 #define MOUSE_AXIS_COUNT (8)
@@ -28,13 +32,16 @@ struct MouseState {
 };
 
 /**
- * This class is part of the hardware abstraction layer. 
- * It is used by \ref eeros::control::MouseInput and \ref eeros::hal::MouseDigIn class. 
+ * This class is part of the hardware abstraction layer.
+ * It is used by \ref eeros::control::MouseInput and \ref eeros::hal::MouseDigIn class.
  * Do not use it directly.
  *
+ * The events of the mouse are read by the \ref InputReactor. The callbacks are
+ * called by the thread of the reactor.
+ *
  * @since v0.6
  */
-class Mouse : public eeros::Thread {
+class Mouse : public InputReactor::Device {
  public:
   explicit Mouse(std::string dev, int priority);
   ~Mouse();
@@ -42,22 +49,48 @@ class Mouse : public eeros::Thread {
   virtual void on_button(std::function<void(int, bool)> action);
   virtual void on_axis(std::function<void(int, signed)> action);
   virtual std::string name();
-  
-  MouseState current;
-  MouseState last;
+
+  /**
+   * Picks up the latest state. Must only be called by the thread reading
+   * the state, typically the control system.
+   *
+   * @return true, if a new state was read since the last call
+   */
+  bool update() { return states.update(); }
+
+  /**
+   * Gets the state picked up by the last call to \ref update(), together
+   * with the time of its acquisition and its sequence number
+   *
+   * @return latest state
+   */
+  const SampleBuffer<MouseState>::Sample& getState() { return states.get(); }
+
+  /**
+   * Gets the current state of a button, can be called from any thread.
+   *
+   * @param code - button code, e.g. BTN_LEFT
+   * @return button is pressed
+   */
+  bool getButton(int code);
+
+  virtual bool drain();
 
  private:
-  virtual void run();
   virtual bool open(const char* device);
   virtual void close();
   int fd;
-  bool running;
   std::function<void(struct input_event)> event_action;
   std::function<void(int, bool)> button_action;
   std::function<void(int, signed)> axis_action;
+  MouseState current;  // written by the reactor only
+  SampleBuffer<MouseState> states;
+  std::atomic<uint8_t> buttons;
   Input<bool>* left;
   Input<bool>* middle;
   Input<bool>* right;
+  logger::Logger log;
+  std::shared_ptr<InputReactor> reactor;
 };
 
 }
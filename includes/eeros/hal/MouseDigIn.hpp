@@ -22,9 +22,9 @@ class MouseDigIn : public Input<bool> {
   MouseDigIn(const MouseDigIn& s) = delete;
   
   virtual bool get() {
-    if (getId().compare("leftMouseButton") == 0) return m->current.button.left;
-    if (getId().compare("middleMouseButton") == 0) return m->current.button.middle;
-    if (getId().compare("rightMouseButton") == 0) return m->current.button.right;
+    if (getId().compare("leftMouseButton") == 0) return m->getButton(BTN_LEFT);
+    if (getId().compare("middleMouseButton") == 0) return m->getButton(BTN_MIDDLE);
+    if (getId().compare("rightMouseButton") == 0) return m->getButton(BTN_RIGHT);
     return false;
   }
             
@@ -4,6 +4,7 @@
 #include <eeros/math/Matrix.hpp>
 #include <eeros/logger/Logger.hpp>
 #include <eeros/core/Thread.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
 #include <pixy2/libpixyusb2.h>
 #include <unistd.h>
 #include <atomic>
@@ -31,7 +32,26 @@ namespace hal {
 
 class PixyCam : public eeros::Thread {
  public:
+  /**
+   * Data evaluated from one frame of the camera
+   */
+  struct Frame {
+    Vector3 output, outputRaw;
+    Matrix<nrDots,2,double> pos;
+    double height;
+    bool valid;
+    int nofBlocks;
+  };
+
   explicit PixyCam(std::string dev, int priority) : starting(true), running(false), log(Logger::getLogger()) {
+    Frame empty;
+    empty.output.zero();
+    empty.outputRaw.zero();
+    empty.pos.zero();
+    empty.height = 0;
+    empty.valid = false;
+    empty.nofBlocks = 0;
+    frames.fill(empty);
     log.info() << "Connecting to Pixy2";
     auto res = pixy.init();
     if (res < 0) {
@@ -54,47 +74,65 @@ class PixyCam : public eeros::Thread {
     join(); 
   }
 
+  /**
+   * Picks up the data of the latest frame. Must only be called by the thread reading 
+   * the data, typically the control system. The getters below return the data picked up.
+   * 
+   * @return true, if a new frame was evaluated since the last call
+   */
+  virtual bool update() {
+    return frames.update();
+  }
+  
+  /**
+   * Returns the data of the frame picked up by the last call to \ref update(), together 
+   * with the time of its acquisition and its sequence number
+   */
+  virtual const SampleBuffer<Frame>::Sample& getFrame() {
+    return frames.get();
+  }
+
   /**
    * Returns the position of the camera, with respect to the middle of the 
    * markers pattern, with lowpass filter
    */
   virtual Vector3 getPos() {
-    return output;
+    return frames.get().value.output;
   }
   
   /**
    * Returns the position of the camera, with respect to the middle of the markers pattern 
    */
   virtual Vector3 getPosRaw() {
-    return outputRaw;
+    return frames.get().value.outputRaw;
   }
   
   /**
    * Returns the position of the detected dots on the markers pattern in pixels 
    */
   virtual Matrix<nrDots,2,double> getDots() {
-    return pos;
+    return frames.get().value.pos;
   }
 
   /**
    * Returns the height of the camera to the markers pattern
    */
   virtual double getHeight() {
-    return height;
+    return frames.get().value.height;
   }
   
   /**
    * Returns true if data are valid, i.e. if all markers are within the field of view of the camera
    */
   virtual double isDataValid() {
-    return valid;
+    return frames.get().value.valid;
   }
   
   /**
    * Returns the nu,ber of markers detected by the camera
    */
   virtual int getNofBlocks() {
-    return nofBlocks;
+    return frames.get().value.nofBlocks;
   }
 
   /**
@@ -117,7 +155,11 @@ class PixyCam : public eeros::Thread {
     running = true;
     while (running) {
       pixy.ccc.getBlocks();
-      nofBlocks = pixy.ccc.numBlocks;
+      uint64_t timestamp = System::getTimeNs();
+      Frame& frame = frames.back();
+      Matrix<nrDots,2,double>& pos = frame.pos;
+      bool markersInRange;
+      frame.nofBlocks = pixy.ccc.numBlocks;
       for(int i=0;i<nrDots; i++) {
         auto block = pixy.ccc.blocks[i];
         pos(i,0) = block.m_x;
@@ -157,7 +199,8 @@ class PixyCam : public eeros::Thread {
       // Define height from markers
       double pixel_fix = 93;     // pixel
       double height_fix = 0.915; // m
-      height = pixel_fix * height_fix / distCam;
+      double height = pixel_fix * height_fix / distCam;
+      frame.height = height;
     
       // Define if markers in central region on picture
       if(pos.get(i_x_min,0) > delta_pixel_range && pos.get(i_x_min,0) < (max_pixel_x-delta_pixel_range) &&
@@ -172,8 +215,8 @@ class PixyCam : public eeros::Thread {
       else
         markersInRange = false;
     
-      if(height < height_limit && markersInRange == true) valid = true;
-      else valid = false;
+      if(height < height_limit && markersInRange == true) frame.valid = true;
+      else frame.valid = false;
                   
       double xS = xO * distWorld / distCam;
       double yS = yO * distWorld / distCam;
@@ -205,8 +248,9 @@ class PixyCam : public eeros::Thread {
       yS_out_f = xS_filtered;
         
       // Set output 
-      outputRaw << xS, yS, phiS;
-      output << xS_out_f, yS_out_f, phiS_filtered;
+      frame.outputRaw << xS, yS, phiS;
+      frame.output << xS_out_f, yS_out_f, phiS_filtered;
+      frames.publish(timestamp);
       
       usleep(5000);
     }
@@ -215,12 +259,7 @@ class PixyCam : public eeros::Thread {
   std::atomic<bool> starting;
   std::atomic<bool> running;
   bool first = true;
-  bool valid = false;
-  bool markersInRange = false;
-  int nofBlocks;
-  Matrix<nrDots,2,double> pos;
-  Vector3 output, outputRaw;
-  double height = 0;
+  SampleBuffer<Frame> frames;
   Pixy2 pixy;
   Logger log;
   double xS_prev = 0;
@@ -5,6 +5,7 @@
 #include <eeros/logger/Logger.hpp>
 #include <eeros/core/Thread.hpp>
 #include <eeros/math/Matrix.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
 #include <rplidar.h>
 #include <atomic>
 
@@ -26,6 +27,13 @@ namespace hal {
  */
 class RPLidar : public eeros::Thread {
  public:
+  /**
+   * One 360 degree scan. Elements after the last measurement are set to infinity.
+   */
+  struct Scan {
+    Vector<LASER_COUNT_MAX,double> angles, ranges, intensities;
+  };
+
   /**
    * Constructs a Thread to get RPLidar (Laserscanner) sensors data. \n
    *
@@ -47,21 +55,44 @@ class RPLidar : public eeros::Thread {
   float getScanFrequency();
   
   /**
-   * Gets angles where a range has been measured
+   * Picks up the latest scan. Must only be called by the thread reading the scans,
+   * typically the control system.
+   * 
+   * @return true, if a new scan was acquired since the last call
+   */
+  bool update() { return scans.update(); }
+  
+  /**
+   * Gets the scan picked up by the last call to \ref update(), together with 
+   * the time of its acquisition and its sequence number
+   * 
+   * @return latest scan
+   */
+  const SampleBuffer<Scan>::Sample& getScan() { return scans.get(); }
+  
+  /**
+   * Gets the number of scans which were overwritten before they were picked up
+   * 
+   * @return number of dropped scans
+   */
+  uint64_t getDroppedScans() { return scans.getDropped(); }
+  
+  /**
+   * Gets angles where a range has been measured of the latest scan, see \ref update()
    * 
    * @return laser angles
    */
   Vector<LASER_COUNT_MAX,double> getAngles();
   
   /**
-   * Gets range measurements
+   * Gets range measurements of the latest scan, see \ref update()
    * 
    * @return laser ranges
    */
   Vector<LASER_COUNT_MAX,double> getRanges();
   
   /**
-   * Gets range intensities
+   * Gets range intensities of the latest scan, see \ref update()
    * 
    * @return laser intensities
    */
@@ -75,7 +106,7 @@ class RPLidar : public eeros::Thread {
   std::atomic<bool> starting;
   std::atomic<bool> running;
   Logger log;
-  Vector<LASER_COUNT_MAX,double> angles, ranges, intensities; 
+  SampleBuffer<Scan> scans;
 };
 
 }
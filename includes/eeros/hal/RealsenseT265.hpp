@@ -6,6 +6,7 @@
 #include <eeros/logger/Logger.hpp>
 #include <eeros/core/Thread.hpp>
 #include <eeros/math/Matrix.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
 #include <librealsense2/rs.hpp>
 #include <librealsense2/h/rs_types.h>
 #include <atomic>
@@ -31,6 +32,12 @@ class RealsenseT265 : public Thread {
     unsigned int confidence;
   };
   
+  // pose and its derivatives as acquired in one frame
+  struct Pose {
+    Vector3 translation, velocity, acceleration, angVelocity, angAcceleration;
+    Vector4 quaternion;
+  };
+  
   /**
    * Constructs a Thread to get Realsense Tracking T265 sensors data \n
    * Calls RealsenseT265(std::string dev, int priority)
@@ -46,8 +53,21 @@ class RealsenseT265 : public Thread {
    */
   ~RealsenseT265();
   
-  Vector3 translation, velocity, acceleration, angVelocity, angAcceleration;
-  Vector4 quaternion;
+  /**
+   * Picks up the latest pose. Must only be called by the thread reading the poses,
+   * typically the control system.
+   * 
+   * @return true, if a new pose was acquired since the last call
+   */
+  bool update() { return poses.update(); }
+  
+  /**
+   * Gets the pose picked up by the last call to \ref update(), together with 
+   * the time of its acquisition and its sequence number
+   * 
+   * @return latest pose
+   */
+  const SampleBuffer<Pose>::Sample& getPose() { return poses.get(); }
 
  private:
   /**
@@ -65,6 +85,7 @@ class RealsenseT265 : public Thread {
    */
   void calc_transform(rs2_pose& pose_data, float mat[16]);
      
+  SampleBuffer<Pose> poses;
   rs2::pipeline pipe;  // Declare RealSense pipeline, encapsulating the actual device and sensors
   rs2::config cfg;     // Create a configuration for configuring the pipeline with a non default profile
   std::atomic<bool> starting;
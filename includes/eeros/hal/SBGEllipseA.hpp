@@ -4,6 +4,7 @@
 #include <eeros/logger/Logger.hpp>
 #include <eeros/core/Thread.hpp>
 #include <eeros/math/Matrix.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
 #include <sbgEComLib.h>
 #include <atomic>
 
@@ -22,6 +23,15 @@ namespace hal {
  */
 class SBGEllipseA : public eeros::Thread {
  public: 
+  /**
+   * Latest data of all logs received from the sensor
+   */
+  struct ImuData {
+    Vector3 euler, acc, gyro;
+    Vector4 quat;
+    uint32_t timestampEuler, timestampQuat, timestampAcc, timestampGyro;
+  };
+
   /**
    * Constructs a thread to get SBGEllipseA (IMU) sensors data \n
    *
@@ -29,7 +39,14 @@ class SBGEllipseA : public eeros::Thread {
    * @param priority - execution priority of thread to get sensors data
    */
   explicit SBGEllipseA(std::string dev, int priority) 
-      : Thread(priority), starting(true), running(false), enableFastData(false), log(Logger::getLogger()) {
+      : Thread(priority), count(0), count0(0), countEuler(0), countQuat(0), countImu(0),
+        starting(true), running(false), enableFastData(false), log(Logger::getLogger()) {
+    current.euler.zero();
+    current.acc.zero();
+    current.gyro.zero();
+    current.quat << 1, 0, 0, 0;
+    current.timestampEuler = current.timestampQuat = current.timestampAcc = current.timestampGyro = 0;
+    samples.fill(current);
     auto errorCode = sbgInterfaceSerialCreate(&sbgInterface, dev.c_str(), 921600);
     log.info() << "SbgEllipseA: interfaceSerialCreate = " << errorCode;
     if (errorCode != SBG_NO_ERROR){
@@ -53,7 +70,7 @@ class SBGEllipseA : public eeros::Thread {
       configureLogsLowRate();   // IMU data, euler angles and quaternions (200Hz) -> see "sbgEComCmdOutput.c"
     }
     errorCode = sbgEComCmdSettingsAction(&comHandle, SBG_ECOM_SAVE_SETTINGS);
-    errorCode = sbgEComSetReceiveLogCallback(&comHandle, onLogReceived, NULL); // -> see: sbgECom.c
+    errorCode = sbgEComSetReceiveLogCallback(&comHandle, onLogReceived, this); // -> see: sbgECom.c
     starting = false;
   }
           
@@ -67,12 +84,27 @@ class SBGEllipseA : public eeros::Thread {
     sbgInterfaceSerialDestroy(&sbgInterface);
   }
     
-  static Vector3 eulerData, accData, gyroData;
-  static Vector4 quatData;
-  static uint32_t timestampEuler, timestampQuat, timestampAcc, timestampGyro;
-  static uint32_t count, count0, countEuler, countQuat, countImu;
+  /**
+   * Picks up the latest data. Must only be called by the thread reading the data,
+   * typically the control system.
+   * 
+   * @return true, if a new log was received since the last call
+   */
+  bool update() { return samples.update(); }
+  
+  /**
+   * Gets the data picked up by the last call to \ref update(), together with 
+   * the time of its reception and its sequence number
+   * 
+   * @return latest data
+   */
+  const SampleBuffer<ImuData>::Sample& getData() { return samples.get(); }
+  
+  uint32_t count, count0, countEuler, countQuat, countImu;  // received logs, written by the callback
   
  private:
+  ImuData current;  // written by the callback only
+  SampleBuffer<ImuData> samples;
   std::atomic<bool> starting;
   std::atomic<bool> running;
   bool enableFastData;
@@ -140,54 +172,10 @@ class SBGEllipseA : public eeros::Thread {
    * @param msgClass Class of the message we have received
    * @param msg Message ID of the log received.
    * @param pLogData Contains the received log data as an union.
-   * @param pUserArg Optional user supplied argument.
+   * @param pUserArg The instance which registered the callback.
    * @return SBG_NO_ERROR if the received log has been used successfully.
    */
-  static SbgErrorCode onLogReceived(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg) {  
-    count++;
-    switch (msg) {
-      case SBG_ECOM_LOG_EKF_EULER:    
-        eulerData << pLogData->ekfEulerData.euler[0],   
-                     pLogData->ekfEulerData.euler[1],    
-                     pLogData->ekfEulerData.euler[2];
-        timestampEuler = pLogData->ekfEulerData.timeStamp;
-        countEuler++;
-        break;
-      case SBG_ECOM_LOG_EKF_QUAT: 
-        quatData << pLogData->ekfQuatData.quaternion[0],   
-                    pLogData->ekfQuatData.quaternion[1],    
-                    pLogData->ekfQuatData.quaternion[2],    
-                    pLogData->ekfQuatData.quaternion[3];
-        timestampQuat = pLogData->ekfQuatData.timeStamp;
-        countQuat++;
-        break;
-      case SBG_ECOM_LOG_IMU_DATA: 
-        accData << pLogData->imuData.accelerometers[0],   
-                   pLogData->imuData.accelerometers[1],    
-                   pLogData->imuData.accelerometers[2];
-        timestampAcc = pLogData->imuData.timeStamp;
-        gyroData << pLogData->imuData.gyroscopes[0],   
-                    pLogData->imuData.gyroscopes[1],    
-                    pLogData->imuData.gyroscopes[2];
-        timestampGyro = pLogData->imuData.timeStamp;
-        countImu++;
-        break;
-      case SBG_ECOM_LOG_FAST_IMU_DATA: // sbgEComBinaryLogImu.h
-        accData << pLogData->fastImuData.accelerometers[0],   
-                   pLogData->fastImuData.accelerometers[1],    
-                   pLogData->fastImuData.accelerometers[2];
-        timestampAcc = pLogData->fastImuData.timeStamp;
-        gyroData << pLogData->fastImuData.gyroscopes[0],   
-                    pLogData->fastImuData.gyroscopes[1],    
-                    pLogData->fastImuData.gyroscopes[2];
-        timestampGyro = pLogData->fastImuData.timeStamp;
-        break;
-     default:
-       count0++;
-       break;
-   }
-   return SBG_NO_ERROR;
- }
+  static SbgErrorCode onLogReceived(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg);
 };
 
 }
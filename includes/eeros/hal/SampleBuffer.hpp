@@ -0,0 +1,142 @@
+#ifndef ORG_EEROS_HAL_SAMPLEBUFFER_HPP_
+#define ORG_EEROS_HAL_SAMPLEBUFFER_HPP_
+
+#include <eeros/core/TripleBuffer.hpp>
+#include <eeros/core/System.hpp>
+#include <cstdint>
+
+namespace eeros {
+namespace hal {
+
+/**
+ * Hands the latest sample of a sensor from the thread of its driver to the control system.
+ * The driver thread fills \ref back() and publishes it together with the time of acquisition,
+ * the control system picks up the newest sample with \ref update() and reads it with
+ * \ref get(). Neither side ever waits or locks, the sample is never copied and the control
+ * system always sees a complete sample, never one which is half overwritten.
+ *
+ * Every published sample gets a sequence number. Samples which were overwritten before the
+ * control system picked them up are counted, see \ref getDropped().
+ *
+ * There must be exactly one producer and one consumer thread.
+ *
+ * @tparam T - type of a sample
+ *
+ * @since v1.4
+ */
+template < typename T >
+class SampleBuffer {
+ public:
+  /**
+   * A sample with the time of its acquisition and its sequence number.
+   */
+  struct Sample {
+    T value;
+    uint64_t timestamp;  // time of acquisition in ns, see \ref System::getTimeNs()
+    uint64_t sequence;   // 1 for the first published sample, 0 if nothing was published yet
+  };
+
+  SampleBuffer() : sequence(0), lastSequence(0), dropped(0) {
+    for (unsigned int i = 0; i < 3; i++) {
+      buffer[i].timestamp = 0;
+      buffer[i].sequence = 0;
+    }
+  }
+
+  SampleBuffer(const SampleBuffer&) = delete;
+  SampleBuffer& operator=(const SampleBuffer&) = delete;
+
+  /**
+   * Sets the value of all slots, e.g. to a safe initial value.
+   * Must be called before the buffer is shared between threads.
+   *
+   * @param value - initial value
+   */
+  void fill(const T& value) {
+    for (unsigned int i = 0; i < 3; i++) buffer[i].value = value;
+  }
+
+  /**
+   * Returns the sample the producer writes to. It holds an older sample, so all
+   * parts of it must be written before publishing. Must only be called by the producer.
+   *
+   * @return value of the back slot
+   */
+  T& back() {
+    return buffer.back().value;
+  }
+
+  /**
+   * Publishes the back slot. Must only be called by the producer.
+   *
+   * @param timestamp - time of acquisition in ns
+   */
+  void publish(uint64_t timestamp) {
+    Sample& s = buffer.back();
+    s.timestamp = timestamp;
+    s.sequence = ++sequence;
+    buffer.publish();
+  }
+
+  /**
+   * Publishes the back slot stamped with the current time. Must only be called by the producer.
+   */
+  void publish() {
+    publish(System::getTimeNs());
+  }
+
+  /**
+   * Copies a value to the back slot and publishes it. Must only be called by the producer.
+   *
+   * @param value - new sample
+   * @param timestamp - time of acquisition in ns
+   */
+  void publish(const T& value, uint64_t timestamp) {
+    buffer.back().value = value;
+    publish(timestamp);
+  }
+
+  /**
+   * Picks up the latest published sample, if any. Must only be called by the consumer.
+   *
+   * @return true, if a new sample was published since the last call
+   */
+  bool update() {
+    if (!buffer.update()) return false;
+    uint64_t s = buffer.front().sequence;
+    dropped += s - lastSequence - 1;
+    lastSequence = s;
+    return true;
+  }
+
+  /**
+   * Returns the sample picked up by the last call to \ref update().
+   * Must only be called by the consumer.
+   *
+   * @return sample
+   */
+  const Sample& get() {
+    return buffer.front();
+  }
+
+  /**
+   * Returns the number of samples which were published but overwritten before the
+   * consumer picked them up. Must only be called by the consumer.
+   *
+   * @return number of dropped samples
+   */
+  uint64_t getDropped() const {
+    return dropped;
+  }
+
+ private:
+  TripleBuffer<Sample> buffer;
+  uint64_t sequence;      // producer
+  uint64_t lastSequence;  // consumer
+  uint64_t dropped;       // consumer
+};
+
+}
+}
+
+#endif /* ORG_EEROS_HAL_SAMPLEBUFFER_HPP_ */
@@ -11,7 +11,7 @@ template <typename T>
 class ScalableInput : public Input<T> {
  public:
   ScalableInput(std::string id, void* libHandle, T scale, T offset, T minIn, T maxIn, std::string unit = "") 
-      : Input<T>(id, libHandle), scale(scale), offset(offset), minIn(minIn), maxIn(maxIn), unit(unit)  { }
+      : Input<T>(id, libHandle), scale(scale), offset(offset), unit(unit), minIn(minIn), maxIn(maxIn) { }
   
   virtual T getScale() { return scale; }
   virtual T getOffset() { return offset; }
@@ -11,7 +11,7 @@ template <typename T>
 class ScalableOutput : public Output<T> {
  public:
   explicit ScalableOutput(std::string id, void* libHandle, T scale, T offset, T minOut, T maxOut, std::string unit = "") 
-      : Output<T>(id, libHandle), scale(scale), offset(offset), minOut(minOut), maxOut(maxOut), unit(unit) { }
+      : Output<T>(id, libHandle), scale(scale), offset(offset), unit(unit), minOut(minOut), maxOut(maxOut) { }
   
   virtual T getScale() { return scale; }
   virtual T getOffset() { return offset; }
@@ -3,9 +3,13 @@
 
 #include <string>
 #include <functional>
+#include <linux/input.h>
 #include <eeros/hal/Input.hpp>
-#include <eeros/core/Thread.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
+#include <eeros/hal/InputReactor.hpp>
 #include <eeros/logger/Logger.hpp>
+#include <atomic>
+#include <memory>
 
 #define SPACENAVIGATOR_AXIS_COUNT (3)
 #define SPACENAVIGATOR_ROT_AXIS_COUNT (3)
@@ -36,22 +40,57 @@ namespace eeros {
 			};
 		};
 		
-		class SpaceNavigator : public eeros::Thread {
+		/**
+		 * The events or raw reports of the space navigator are read by the \ref InputReactor.
+		 */
+		class SpaceNavigator : public InputReactor::Device {
 		public:
 			explicit SpaceNavigator(std::string dev, int priority = 20);
 			~SpaceNavigator();
 			virtual std::string name();
 			
-			SpaceState current;
+			/**
+			 * Picks up the latest state. Must only be called by the thread reading 
+			 * the state, typically the control system.
+			 * 
+			 * @return true, if a new state was read since the last call
+			 */
+			bool update() { return states.update(); }
+			
+			/**
+			 * Gets the state picked up by the last call to \ref update(), together 
+			 * with the time of its acquisition and its sequence number
+			 * 
+			 * @return latest state
+			 */
+			const SampleBuffer<SpaceState>::Sample& getState() { return states.get(); }
+			
+			/**
+			 * Gets the current state of a button, can be called from any thread.
+			 * 
+			 * @param i - index of the button, see \ref SpaceNav::Button
+			 * @return button is pressed
+			 */
+			bool getButton(int i) { return (buttons.load(std::memory_order_relaxed) >> i) & 1; }
+			
+			virtual bool drain();
 			
 		private:
-			virtual void run();			
 			virtual bool open(const char* device);
 			virtual void close();
-			FILE* file;
-			bool running, useRaw;
+			size_t parseRaw(const uint8_t* data, size_t len);
+			void parseEvent(const struct input_event& ev);
+			void publish();
+			int fd;
+			bool useRaw;
+			uint8_t raw[256];	// raw stream not parsed yet
+			size_t rawLen;
+			SpaceState current;	// written by the thread only
+			SampleBuffer<SpaceState> states;
+			std::atomic<uint8_t> buttons;
 			Input<bool>* button[SPACENAVIGATOR_BUTTON_COUNT];
 			eeros::logger::Logger log;
+			std::shared_ptr<InputReactor> reactor;
 		};
 	}
 }
@@ -13,8 +13,8 @@ namespace eeros {
 			SpaceNavigatorDigIn(std::string id, SpaceNavigator* sn) : Input<bool>(id, nullptr), sn(sn) { }
 			~SpaceNavigatorDigIn() { }
 			virtual bool get() {
-				if (getId().compare("SpaceNavButtonL") == 0) return sn->current.button[SpaceNav::Button::L];
-				if (getId().compare("SpaceNavButtonR") == 0) return sn->current.button[SpaceNav::Button::R];
+				if (getId().compare("SpaceNavButtonL") == 0) return sn->getButton(SpaceNav::Button::L);
+				if (getId().compare("SpaceNavButtonR") == 0) return sn->getButton(SpaceNav::Button::R);
 				return false;
 			}
 			
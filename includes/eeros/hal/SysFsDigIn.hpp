@@ -2,21 +2,89 @@
 #define ORG_EEROS_HAL_SYSFSDIGIN_HPP_
 
 #include <eeros/hal/Input.hpp>
-#include <fstream>
+#include <atomic>
+#include <thread>
 #include <string>
 
 namespace eeros {
 	namespace hal {
+		
+		/**
+		 * Edges of a sysfs gpio which are latched by \ref SysFsDigIn.
+		 * 
+		 * @since v1.4
+		 */
+		enum class SysFsEdge { none, rising, falling, both };
+		
+		/**
+		 * Digital input using the sysfs gpio interface of the linux kernel.
+		 * The value file is kept open and read with a single pread per call to get().
+		 * 
+		 * If an edge is chosen, a background thread waits with poll for the kernel to 
+		 * signal this edge and latches it. Short pulses on safety inputs are therefore 
+		 * not lost even if get() is called with a low rate. An edge between two calls 
+		 * to get() is latched as well, whichever sees it first. Edges refer to the level 
+		 * of the gpio before inversion. The latched edges are queried with fetchEdge() 
+		 * and getEdgeCount().
+		 * 
+		 * @since v1.4
+		 */
 		class SysFsDigIn : public Input<bool> {
 		public:
-			SysFsDigIn(std::string id, void* libHandle, unsigned int gpio, bool inverted = false);
+			/**
+			 * Exports the gpio and configures it as input.
+			 * 
+			 * @param id - id of the input
+			 * @param libHandle - handle of the hardware library
+			 * @param gpio - number of the gpio
+			 * @param inverted - true, if the input is inverted
+			 * @param edge - edge which is latched by a background thread
+			 */
+			SysFsDigIn(std::string id, void* libHandle, unsigned int gpio, bool inverted = false, SysFsEdge edge = SysFsEdge::none);
+			
+			/**
+			 * Uses an already exported gpio directory, e.g. "/sys/class/gpio/gpio17/".
+			 * 
+			 * @param id - id of the input
+			 * @param libHandle - handle of the hardware library
+			 * @param basePath - directory containing the value and edge files
+			 * @param inverted - true, if the input is inverted
+			 * @param edge - edge which is latched by a background thread
+			 */
+			SysFsDigIn(std::string id, void* libHandle, std::string basePath, bool inverted = false, SysFsEdge edge = SysFsEdge::none);
 			~SysFsDigIn();
 			virtual bool get();
 			
+			/**
+			 * Returns true if an edge was latched since the last call and clears the latch.
+			 * 
+			 * @return true, if an edge occured
+			 */
+			virtual bool fetchEdge();
+			
+			/**
+			 * Returns the number of edges latched since construction.
+			 * 
+			 * @return number of edges
+			 */
+			virtual uint32_t getEdgeCount() const;
+			
 		private:
+			void open();
+			void watchEdges();
+			bool read(bool& level);
+			void latch();
+			
 			bool inverted;
+			SysFsEdge edge;
 			std::string basePath;
-			std::fstream valueFile;
+			int valueFd;
+			int stopFd;
+			std::atomic<bool> level;        // last level seen by get() or the edge thread
+			std::atomic<bool> seenByRead;   // an edge was latched by get() since the edge thread last woke up
+			std::atomic<bool> edgeLatched;
+			std::atomic<uint32_t> edgeCount;
+			std::thread edgeThread;
 		};
 
 	};
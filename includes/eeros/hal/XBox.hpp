@@ -3,9 +3,13 @@
 
 #include <string>
 #include <functional>
+#include <memory>
+#include <atomic>
 #include <linux/joystick.h>
 #include <eeros/hal/Input.hpp>
-#include <eeros/core/Thread.hpp>
+#include <eeros/hal/InputReactor.hpp>
+#include <eeros/hal/SampleBuffer.hpp>
+#include <eeros/logger/Logger.hpp>
 
 #define XBOX_BUTTON_COUNT (8)
 #define XBOX_AXIS_COUNT (8)
@@ -44,7 +48,11 @@ namespace eeros {
 			};
 		};
 		
-		class XBox : public eeros::Thread{
+		/**
+		 * The events of the controller are read by the \ref InputReactor. The callbacks 
+		 * are called by the thread of the reactor.
+		 */
+		class XBox : public InputReactor::Device {
 		public:
 			explicit XBox(std::string dev, int priority);
 			~XBox();
@@ -53,19 +61,46 @@ namespace eeros {
 			virtual void on_axis(std::function<void(int, double)> action);
 			virtual std::string name();
 			
-			XBoxState last;
-			XBoxState current;
+			/**
+			 * Picks up the latest state. Must only be called by the thread reading 
+			 * the state, typically the control system.
+			 * 
+			 * @return true, if a new state was read since the last call
+			 */
+			bool update() { return states.update(); }
+			
+			/**
+			 * Gets the state picked up by the last call to \ref update(), together 
+			 * with the time of its acquisition and its sequence number
+			 * 
+			 * @return latest state
+			 */
+			const SampleBuffer<XBoxState>::Sample& getState() { return states.get(); }
+			
+			/**
+			 * Gets the current state of a button, can be called from any thread.
+			 * 
+			 * @param i - index of the button, see \ref XBoxController::Button
+			 * @return button is pressed
+			 */
+			bool getButton(int i) { return (buttons.load(std::memory_order_relaxed) >> i) & 1; }
+			
+			virtual bool drain();
 			
 		private:
-			virtual void run();
 			virtual bool open(const char* device);
 			virtual void close();
 			int fd;
-			bool running;
 			std::function<void(struct js_event)> event_action;
 			std::function<void(int, bool)> button_action;
 			std::function<void(int, double)> axis_action;
+			XBoxState last;
+			XBoxState current;	// written by the reactor only
+			SampleBuffer<XBoxState> states;
+			std::atomic<uint8_t> buttons;
 			Input<bool>* button[XBOX_BUTTON_COUNT];
+			logger::Logger log;
+			std::shared_ptr<InputReactor> reactor;
 		};
 	}
 }
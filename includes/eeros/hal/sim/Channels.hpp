@@ -0,0 +1,173 @@
+#ifndef ORG_EEROS_HAL_SIM_CHANNELS_HPP_
+#define ORG_EEROS_HAL_SIM_CHANNELS_HPP_
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <eeros/core/TripleBuffer.hpp>
+#include <eeros/hal/Input.hpp>
+#include <eeros/hal/Output.hpp>
+#include <eeros/hal/ScalableInput.hpp>
+#include <eeros/hal/ScalableOutput.hpp>
+#include <eeros/hal/sim/Generator.hpp>
+
+namespace eeros {
+namespace hal {
+namespace sim {
+
+/**
+ * Common part of all simulated outputs. Keeps the history of the written values 
+ * so that loopback inputs can read them with a delay. The history is a ring of the
+ * last \ref historySize values, written by the thread setting the output and read
+ * without lock by the threads reading loopback inputs.
+ *
+ * @since v1.4
+ */
+class SimOutput {
+ public:
+  /**
+   * Number of written values kept in the history.
+   */
+  static constexpr unsigned int historySize = 1024;
+
+  explicit SimOutput(const std::string& id);
+  virtual ~SimOutput();
+
+  /**
+   * Returns the value which was written last at or before the given time,
+   * the oldest value kept if all values were written later.
+   *
+   * @param timeNs - time in nanoseconds
+   * @return value
+   */
+  double valueAt(uint64_t timeNs);
+
+  /**
+   * Records the delay of a loopback input reading this output. A delay longer than
+   * \ref historySize written values reads the oldest value kept.
+   *
+   * @param delayNs - delay of a loopback input
+   */
+  void keepHistory(uint64_t delayNs);
+
+  /**
+   * Looks up a simulated output by its signal id.
+   *
+   * @param id - signal id
+   * @return output or nullptr
+   */
+  static SimOutput* find(const std::string& id);
+
+  /**
+   * Returns a number which changes whenever a simulated output is created or destroyed.
+   *
+   * @return generation of the outputs
+   */
+  static uint64_t getGeneration();
+
+ protected:
+  void write(double value);
+
+ private:
+  struct Sample {
+    std::atomic<uint64_t> time;
+    std::atomic<double> value;
+  };
+
+  std::string id;
+  std::array<Sample, historySize> history;
+  std::atomic<uint64_t> started;  // number of writes started
+  std::atomic<uint64_t> written;  // number of writes done
+  std::atomic<uint64_t> historyNs;  // longest delay of the loopback inputs
+};
+
+/**
+ * Common part of all simulated inputs, which get their value from a \ref Generator.
+ * Reading never throws and never locks. A new generator is handed to the reading
+ * thread through a triple buffer. If the source of a loopback input does not exist,
+ * the input reads 0 and flags a fault until the source is created.
+ *
+ * @since v1.4
+ */
+class SimInput {
+ public:
+  explicit SimInput(const std::string& config);
+  virtual ~SimInput();
+
+  /**
+   * Replaces the generator of this input.
+   *
+   * @param config - configuration string of the new generator
+   */
+  void setGenerator(const std::string& config);
+
+  /**
+   * Returns true if the last read could not get a value from the generator.
+   *
+   * @return fault
+   */
+  bool hasFault() const;
+
+ protected:
+  double read();
+
+ private:
+  static constexpr uint64_t lookUp = ~0ull;
+
+  std::mutex mtx;                   // serializes the writers of pending
+  TripleBuffer<Generator> pending;  // generators set but not yet read
+  Generator generator;              // owned by the reading thread
+  SimOutput* source;
+  uint64_t generation;              // of the outputs when the source was looked up, lookUp if none
+  std::atomic<bool> fault;
+};
+
+class SimDigIn : public Input<bool>, public SimInput {
+ public:
+  SimDigIn(std::string id, void* libHandle, bool inverted, std::string config);
+  virtual bool get();
+ private:
+  bool inverted;
+};
+
+class SimDigOut : public Output<bool>, public SimOutput {
+ public:
+  SimDigOut(std::string id, void* libHandle, bool inverted);
+  virtual bool get();
+  virtual void set(bool value);
+ private:
+  bool inverted;
+  bool value;
+};
+
+/**
+ * Simulated analog input. The generator delivers the raw value of the hardware,
+ * which is scaled and limited like the analog inputs of the other hardware libraries:
+ * (raw - offset) / scale, limited to [rangeMin, rangeMax].
+ */
+class SimAnalogIn : public ScalableInput<double>, public SimInput {
+ public:
+  SimAnalogIn(std::string id, void* libHandle, double scale, double offset, double rangeMin, double rangeMax, std::string unit, std::string config);
+  virtual double get();
+};
+
+/**
+ * Simulated analog output. The value is limited to [rangeMin, rangeMax] and the raw
+ * value value * scale + offset is written, so a loopback input with the same scale
+ * and offset reads the value set.
+ */
+class SimAnalogOut : public ScalableOutput<double>, public SimOutput {
+ public:
+  SimAnalogOut(std::string id, void* libHandle, double scale, double offset, double rangeMin, double rangeMax, std::string unit);
+  virtual double get();
+  virtual void set(double value);
+ private:
+  double value;
+};
+
+}
+}
+}
+
+#endif /* ORG_EEROS_HAL_SIM_CHANNELS_HPP_ */
@@ -0,0 +1,74 @@
+#ifndef ORG_EEROS_HAL_SIM_GENERATOR_HPP_
+#define ORG_EEROS_HAL_SIM_GENERATOR_HPP_
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdint>
+
+namespace eeros {
+namespace hal {
+namespace sim {
+
+/**
+ * A generator delivers the values of a simulated input. It is configured with a 
+ * string, e.g. the "additionalArguments" of a channel in the hardware configuration file. 
+ * The string starts with the kind of the generator followed by its parameters:
+ *
+ * constant value=1.5
+ * sine amplitude=2 frequency=5 phase=0 offset=0
+ * square amplitude=1 frequency=1 offset=0 duty=0.5
+ * noise mean=0 stddev=0.1 seed=1
+ * file path=/tmp/trace.txt (lines of "time value", the value is held until the next line)
+ * loopback source=aOut0 delay=0.002 (value of a simulated output, delayed in seconds)
+ *
+ * All generators are evaluated at the time given by \ref System::getTimeNs(), 
+ * together with the simulation mode of the executor they are fully deterministic.
+ *
+ * @since v1.4
+ */
+class Generator {
+ public:
+  enum class Kind { constant, sine, square, noise, file, loopback };
+
+  /**
+   * Constructs a generator from its configuration string. An empty string 
+   * creates a constant generator with value 0.
+   *
+   * @param config - configuration string
+   */
+  explicit Generator(const std::string& config = "");
+
+  /**
+   * Evaluates the generator.
+   *
+   * @param timeNs - time in nanoseconds
+   * @return value
+   */
+  double get(uint64_t timeNs);
+
+  Kind getKind() const;
+  const std::string& getSource() const;
+  uint64_t getDelayNs() const;
+
+ private:
+  double param(const std::string& key, double defaultValue) const;
+  void loadFile(const std::string& path);
+
+  Kind kind;
+  std::vector<std::pair<std::string, std::string>> params;
+  double value, amplitude, frequency, phase, offset, duty, mean, stddev;
+  std::string source;
+  uint64_t delayNs;
+  std::vector<uint64_t> fileTimes;
+  std::vector<double> fileValues;
+  std::size_t fileIndex;
+  std::mt19937_64 rng;
+  std::normal_distribution<double> normal;
+};
+
+}
+}
+}
+
+#endif /* ORG_EEROS_HAL_SIM_GENERATOR_HPP_ */
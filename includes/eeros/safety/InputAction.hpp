@@ -2,6 +2,9 @@
 #define ORG_EEROS_SAFETY_INPUTACTION_HPP_
 
 #include <stdint.h>
+#include <cstring>
+#include <type_traits>
+#include <typeinfo>
 #include <eeros/hal/Input.hpp>
 #include <eeros/safety/SafetyLevel.hpp>
 #include <eeros/safety/SafetyContext.hpp>
@@ -10,6 +13,34 @@ namespace eeros {
 namespace safety {
 
 class SafetyContext;
+class SafetyEvent;
+class InputAction;
+
+/**
+ * An input check is the compiled form of an input action as evaluated by the safety system.
+ * The checks of a safety level are stored in one contiguous table and evaluated in a single
+ * pass. Each check holds a pointer to the typed input, the values to compare with and a plain
+ * function doing the comparison, so no cast and no call through the action is needed.
+ * Actions which cannot be compiled call their virtual \ref InputAction::check() instead,
+ * as do actions derived from the actions of the framework, which may override check().
+ */
+struct InputCheck {
+  using Function = bool (*)(const InputCheck& check, SafetyContext* context);
+
+  Function function;      // returns true if the event was triggered
+  void* input;            // typed input, e.g. hal::Input<bool>*
+  SafetyEvent* event;
+  InputAction* action;    // action this check was compiled from
+  alignas(8) unsigned char values[2][16];  // value or min and max
+
+  bool operator()(SafetyContext* context) const { return function(*this, context); }
+
+  template < typename T >
+  void set(int i, const T& value) { std::memcpy(values[i], &value, sizeof(T)); }
+
+  template < typename T >
+  T get(int i) const { T value; std::memcpy(&value, values[i], sizeof(T)); return value; }
+};
 
 class InputAction {
  public:
@@ -17,7 +48,35 @@ class InputAction {
   virtual ~InputAction() { }
   virtual bool check(SafetyContext* context) { return false; }
   virtual hal::InputInterface* getInput() {return input;}
+
+  /**
+   * Compiles this action into an input check. The default check calls \ref check().
+   *
+   * @return input check
+   */
+  virtual InputCheck compile() {
+    InputCheck c;
+    c.function = [](const InputCheck& c, SafetyContext* context) { return c.action->check(context); };
+    c.input = input;
+    c.event = nullptr;
+    c.action = this;
+    return c;
+  }
+
  protected:
+  // true if values of T can be stored in an input check
+  template < typename T >
+  static constexpr bool compilable() {
+    return std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(InputCheck::values[0]);
+  }
+
+  // true if this action is of type A and not derived from it, only then the compiled
+  // check of A can replace check(), a derived action may have overridden it
+  template < typename A >
+  bool exactly() const {
+    return typeid(*this) == typeid(A);
+  }
+
   hal::InputInterface* input;
 };
 
@@ -27,21 +86,49 @@ class IgnoreInputAction : public InputAction {
   IgnoreInputAction(hal::Input<T>& input) : InputAction(input) { }
   virtual ~IgnoreInputAction() { }
   virtual bool check(SafetyContext* context) { return false; }
+  virtual InputCheck compile() {
+    InputCheck c = InputAction::compile();
+    if (exactly<IgnoreInputAction<T>>()) c.function = [](const InputCheck&, SafetyContext*) { return false; };
+    return c;
+  }
 };
 
 template <typename T>
 class CheckInputAction : public InputAction {
  public:
-  CheckInputAction(hal::Input<T>& input, T value, SafetyEvent& event) : InputAction(input), value(value), event(event) { }
+  CheckInputAction(hal::Input<T>& input, T value, SafetyEvent& event) : InputAction(input), typedInput(&input), value(value), event(event) { }
   virtual ~CheckInputAction() { }
   virtual bool check(SafetyContext* context) {
-    if (dynamic_cast<hal::Input<T>*>(input)->get() != value) {
+    if (typedInput->get() != value) {
       context->triggerEvent(event);
       return true;
     }
     return false;
   }
+  virtual InputCheck compile() {
+    return compile(std::integral_constant<bool, compilable<T>()>());
+  }
  private:
+  InputCheck compile(std::false_type) {
+    return InputAction::compile();
+  }
+  InputCheck compile(std::true_type) {
+    if (!exactly<CheckInputAction<T>>()) return InputAction::compile();
+    InputCheck c = InputAction::compile();
+    c.function = [](const InputCheck& c, SafetyContext* context) {
+      if (static_cast<hal::Input<T>*>(c.input)->get() != c.get<T>(0)) {
+        context->triggerEvent(*c.event);
+        return true;
+      }
+      return false;
+    };
+    c.input = typedInput;
+    c.event = &event;
+    c.set(0, value);
+    return c;
+  }
+
+  hal::Input<T>* typedInput;
   T value;
   SafetyEvent& event;
 };
@@ -49,11 +136,11 @@ class CheckInputAction : public InputAction {
 template <typename T>
 class CheckRangeInputAction : public InputAction {
  public:
-  CheckRangeInputAction(hal::Input<T>& input, T min, T max, SafetyEvent& event, bool offRange = false) 
-      : InputAction(input), min(min), max(max), event(event), offRange(offRange) { }
+  CheckRangeInputAction(hal::Input<T>& input, T min, T max, SafetyEvent& event, bool offRange = false)
+      : InputAction(input), typedInput(&input), min(min), max(max), event(event), offRange(offRange) { }
   virtual ~CheckRangeInputAction() { }
   virtual bool check(SafetyContext* context) {
-    T value = dynamic_cast<hal::Input<T>*>(input)->get();
+    T value = typedInput->get();
     if (offRange) {
       if (value > min && value < max) {
         context->triggerEvent(event);
@@ -67,7 +154,43 @@ class CheckRangeInputAction : public InputAction {
     }
     return false;
   }
+  virtual InputCheck compile() {
+    return compile(std::integral_constant<bool, compilable<T>()>());
+  }
  private:
+  InputCheck compile(std::false_type) {
+    return InputAction::compile();
+  }
+  InputCheck compile(std::true_type) {
+    if (!exactly<CheckRangeInputAction<T>>()) return InputAction::compile();
+    InputCheck c = InputAction::compile();
+    if (offRange) {
+      c.function = [](const InputCheck& c, SafetyContext* context) {
+        T value = static_cast<hal::Input<T>*>(c.input)->get();
+        if (value > c.get<T>(0) && value < c.get<T>(1)) {
+          context->triggerEvent(*c.event);
+          return true;
+        }
+        return false;
+      };
+    } else {
+      c.function = [](const InputCheck& c, SafetyContext* context) {
+        T value = static_cast<hal::Input<T>*>(c.input)->get();
+        if (value < c.get<T>(0) || value > c.get<T>(1)) {
+          context->triggerEvent(*c.event);
+          return true;
+        }
+        return false;
+      };
+    }
+    c.input = typedInput;
+    c.event = &event;
+    c.set(0, min);
+    c.set(1, max);
+    return c;
+  }
+
+  hal::Input<T>* typedInput;
   T min;
   T max;
   SafetyEvent& event;
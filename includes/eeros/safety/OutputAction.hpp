@@ -30,28 +30,30 @@ namespace eeros {
 		template < typename T >
 		class SetOutputAction : public OutputAction {
 		public:
-			SetOutputAction(hal::Output<T>* output, T value) : OutputAction(output), value(value) { }
+			SetOutputAction(hal::Output<T>* output, T value) : OutputAction(output), typedOutput(output), value(value) { }
 			virtual ~SetOutputAction() { }
 			virtual void set() { 
-				dynamic_cast<hal::Output<T>*>(output)->set(value);
+				typedOutput->set(value);
 			}
 		private:
+			hal::Output<T>* typedOutput;
 			T value;
 		};
 	
 		template < typename T >
 		class ToggleOutputAction : public OutputAction {
 		public:
-			ToggleOutputAction(hal::Output<T>* output, T low, T high) : OutputAction(output), value(low), low(low), high(high) { }
+			ToggleOutputAction(hal::Output<T>* output, T low, T high) : OutputAction(output), typedOutput(output), value(low), low(low), high(high) { }
 			virtual ~ToggleOutputAction() { }
 			virtual void set() {
-				dynamic_cast<hal::Output<T>*>(output)->set(value);
+				typedOutput->set(value);
 				if (value == low)
 					value = high;
 				else
 					value = low;
 			}
 		private:
+			hal::Output<T>* typedOutput;
 			T value;
 			T low;
 			T high;
@@ -59,7 +61,7 @@ namespace eeros {
 
 		template <typename T>
 		SetOutputAction<T>* set(eeros::hal::Output<T>& output, T value) {
-			return new SetOutputAction<T>(output, value);
+			return new SetOutputAction<T>(&output, value);
 		}
 		
 		template <typename T>
@@ -69,7 +71,7 @@ namespace eeros {
 
 		template <typename T>
 		LeaveOutputAction<T>* leave(eeros::hal::Output<T>& output) {
-			return new LeaveOutputAction<T>(output);
+			return new LeaveOutputAction<T>(&output);
 		}
 		
 		template <typename T>
@@ -79,7 +81,7 @@ namespace eeros {
 		
 		template <typename T>
 		ToggleOutputAction<T>* toggle(eeros::hal::Output<T>& output, T low = false, T high = true) {
-			return new ToggleOutputAction<T>(output, low, high );
+			return new ToggleOutputAction<T>(&output, low, high );
 		}
 		
 		template <typename T>
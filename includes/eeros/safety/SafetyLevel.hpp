@@ -53,12 +53,15 @@ namespace eeros {
 			bool operator==(const SafetyLevel& level);
 			bool operator!=(const SafetyLevel& level);
 		private:
+			void compileInputActions();
+			
 			std::function<void (SafetyContext*)> action;
 			int32_t id;
 			uint32_t nofActivations;
 			std::string description;
 			std::map<uint32_t, std::pair<SafetyLevel*, EventType>> transitions;
 			std::vector<InputAction*> inputAction;
+			std::vector<InputCheck> inputCheck; // compiled input actions, evaluated by the safety system
 			std::vector<OutputAction*> outputAction;
 		};
 		
@@ -0,0 +1,291 @@
+#ifndef ORG_EEROS_SOCKETS_FRAME_HPP_
+#define ORG_EEROS_SOCKETS_FRAME_HPP_
+
+#include <eeros/core/TripleBuffer.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <type_traits>
+#include <poll.h>
+#include <sys/socket.h>
+
+namespace eeros {
+namespace sockets {
+
+/**
+ * Magic number at the start of every frame ("EERF"). Peers with a different
+ * byte order see a different value and reject the frame.
+ */
+constexpr uint32_t frameMagic = 0x45455246;
+
+/**
+ * Version of the wire format, part of the schema hash.
+ */
+constexpr uint32_t frameVersion = 1;
+
+/**
+ * Header preceding the payload of every frame on a socket connection.
+ */
+struct FrameHeader {
+  uint32_t magic;       // frameMagic
+  uint32_t schema;      // hash of payload type and length, see FrameSchema
+  uint64_t sequence;    // incremented by the sender for every new sample, 0 for none
+  uint64_t timestamp;   // timestamp of the sample on the sender side in ns
+};
+
+/**
+ * A frame as it is sent over a socket, header and payload are transferred in one piece.
+ *
+ * @tparam T - payload type, arithmetic type or matrix
+ */
+template < typename T >
+struct Frame {
+  FrameHeader header;
+  T data;
+};
+
+/**
+ * Describes the payload of a frame. The schema hash is computed from the element type,
+ * the number of elements and the wire format version. Both peers must use the same
+ * payload type, otherwise the frames are rejected.
+ *
+ * @tparam T - payload type, arithmetic type or matrix
+ */
+template < typename T, typename Enable = void >
+struct FrameSchema {
+  using value_type = typename T::value_type;
+  static constexpr uint32_t length = sizeof(T) / sizeof(value_type);
+};
+
+template < typename T >
+struct FrameSchema<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+  using value_type = T;
+  static constexpr uint32_t length = 1;
+};
+
+/**
+ * Returns a code for an element type consisting of its kind and size.
+ *
+ * @tparam T - element type
+ * @return type code
+ */
+template < typename T >
+constexpr uint32_t frameTypeCode() {
+  return (std::is_same<T, bool>::value ? 'b' : std::is_floating_point<T>::value ? 'f'
+          : std::is_signed<T>::value ? 'i' : 'u') << 8 | sizeof(T);
+}
+
+/**
+ * Returns the schema hash (FNV-1a) for a payload type.
+ *
+ * @tparam T - payload type, arithmetic type or matrix
+ * @return schema hash
+ */
+template < typename T >
+constexpr uint32_t frameSchemaHash() {
+  uint32_t words[] = {frameVersion, frameTypeCode<typename FrameSchema<T>::value_type>(), FrameSchema<T>::length};
+  uint32_t hash = 2166136261u;
+  for (uint32_t w : words) {
+    for (int i = 0; i < 4; i++) {
+      hash ^= (w >> (8 * i)) & 0xff;
+      hash *= 16777619u;
+    }
+  }
+  return hash;
+}
+
+/**
+ * Frames travelling in one direction of a socket connection. The control system and the
+ * socket thread exchange frames through a triple buffer by swapping slots, the socket thread
+ * writes and reads the frames directly from and to these slots. Sequence numbers of received
+ * frames are checked, lost and repeated (stale) frames are counted.
+ *
+ * @tparam T - payload type, arithmetic type or matrix
+ *
+ * @since v1.4
+ */
+template < typename T >
+class FrameBuffer {
+ public:
+  static constexpr bool enabled = true;
+
+  FrameBuffer() : newData(false), lost(0), stale(0), invalid(0), sequence(0), lastSequence(0) {
+    for (unsigned int i = 0; i < 3; i++) {
+      std::memset(static_cast<void*>(&buf[i]), 0, sizeof(Frame<T>));
+      buf[i].header.magic = frameMagic;
+      buf[i].header.schema = frameSchemaHash<T>();
+    }
+  }
+
+  /**
+   * Returns the payload of the next frame to be sent. Called by the control system.
+   *
+   * @return payload
+   */
+  T& data() {
+    return buf.back().data;
+  }
+
+  /**
+   * Stamps the next frame with a new sequence number and hands it to the socket thread.
+   * Called by the control system.
+   *
+   * @param timestamp - timestamp of the sample
+   */
+  void publish(uint64_t timestamp) {
+    Frame<T>& f = buf.back();
+    f.header.sequence = ++sequence;
+    f.header.timestamp = timestamp;
+    buf.publish();
+  }
+
+  /**
+   * Picks up the latest received frame. Called by the control system.
+   *
+   * @return latest received frame
+   */
+  const Frame<T>& latest() {
+    buf.update();
+    return buf.front();
+  }
+
+  /**
+   * Sends the latest published frame. Called by the socket thread.
+   *
+   * @param fd - socket file descriptor
+   * @return true, if the whole frame was sent
+   */
+  bool send(int fd) {
+    buf.update();
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&buf.front());
+    size_t count = sizeof(Frame<T>);
+    while (count > 0) {
+      ssize_t n = ::send(fd, ptr, count, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EINTR) continue;
+        return false;
+      }
+      ptr += n;
+      count -= n;
+    }
+    return true;
+  }
+
+  /**
+   * Receives a frame directly into the back slot and publishes it if it is valid.
+   * Called by the socket thread. Waits with poll, so a partially received frame
+   * never blocks the thread longer than the timeout.
+   *
+   * @param fd - socket file descriptor
+   * @param timeout - time in s to wait for the complete frame
+   * @return true, if a valid frame was received
+   */
+  bool receive(int fd, double timeout) {
+    Frame<T>& f = buf.back();
+    uint8_t* ptr = reinterpret_cast<uint8_t*>(&f);
+    size_t count = sizeof(Frame<T>);
+    auto endTime = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+    while (count > 0) {
+      auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - std::chrono::steady_clock::now()).count();
+      if (remaining < 0) return false;
+      struct pollfd pfd = {fd, POLLIN, 0};
+      int r = poll(&pfd, 1, static_cast<int>(remaining));
+      if (r < 0 && errno == EINTR) continue;
+      if (r <= 0) return false;
+      ssize_t n = recv(fd, ptr, count, 0);
+      if (n < 0 && errno == EINTR) continue;
+      if (n <= 0) return false;
+      bool headerPending = count > sizeof(Frame<T>) - sizeof(FrameHeader);
+      ptr += n;
+      count -= n;
+      // reject a foreign frame as soon as its header is complete, its length may differ
+      if (headerPending && count <= sizeof(Frame<T>) - sizeof(FrameHeader)
+          && (f.header.magic != frameMagic || f.header.schema != frameSchemaHash<T>())) {
+        invalid++;
+        return false;
+      }
+    }
+    uint64_t seq = f.header.sequence;
+    if (seq == lastSequence) {
+      if (seq != 0) stale++;
+    } else {
+      if (seq > lastSequence + 1 && lastSequence != 0) lost += seq - lastSequence - 1;
+      lastSequence = seq;
+      buf.publish();
+      newData = true;
+    }
+    return true;
+  }
+
+  /**
+   * Publishes an empty frame, e.g. after the connection was lost. Called by the socket thread.
+   */
+  void clear() {
+    Frame<T>& f = buf.back();
+    std::memset(static_cast<void*>(&f.data), 0, sizeof(T));
+    f.header.sequence = 0;
+    f.header.timestamp = 0;
+    lastSequence = 0;
+    buf.publish();
+    newData = true;
+  }
+
+  std::atomic<bool> newData;      // a frame with a new sequence number was received
+  std::atomic<uint64_t> lost;     // frames skipped by the sender, detected by gaps in the sequence
+  std::atomic<uint64_t> stale;    // frames received again with an unchanged sequence number
+  std::atomic<uint64_t> invalid;  // frames with wrong magic or schema
+
+ private:
+  TripleBuffer<Frame<T>> buf;
+  uint64_t sequence;
+  uint64_t lastSequence;
+};
+
+/**
+ * Used for a direction of a connection which does not transfer any data.
+ */
+template < >
+class FrameBuffer<std::nullptr_t> {
+ public:
+  static constexpr bool enabled = false;
+  FrameBuffer() : newData(false), lost(0), stale(0), invalid(0) { }
+  bool send(int) { return true; }
+  bool receive(int, double) { return true; }
+  void clear() { }
+  std::atomic<bool> newData;
+  std::atomic<uint64_t> lost;
+  std::atomic<uint64_t> stale;
+  std::atomic<uint64_t> invalid;
+};
+
+/**
+ * Frames of both directions of a socket connection, shared between the socket thread
+ * and the control system.
+ *
+ * @tparam TxType - payload type of sent frames, std::nullptr_t if nothing is sent
+ * @tparam RxType - payload type of received frames, std::nullptr_t if nothing is received
+ *
+ * @since v1.4
+ */
+template < typename TxType, typename RxType >
+class FrameLink {
+ public:
+  FrameBuffer<TxType>& getSendFrames() {
+    return tx;
+  }
+
+  FrameBuffer<RxType>& getReceiveFrames() {
+    return rx;
+  }
+
+ protected:
+  FrameBuffer<TxType> tx;
+  FrameBuffer<RxType> rx;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_SOCKETS_FRAME_HPP_ */
@@ -2,9 +2,9 @@
 #define ORG_EEROS_SOCKET_SERVER_HPP_
 
 #include <eeros/core/Thread.hpp>
-#include <array>
+#include <eeros/sockets/Frame.hpp>
 #include <unistd.h>
-#include <netdb.h> 
+#include <netdb.h>
 #include <arpa/inet.h> 		/* inet_ntoa() to format IP address */
 #include <string.h>
 #include <sys/socket.h>
@@ -13,17 +13,24 @@
 #include <iostream>
 #include <cstring>
 #include <signal.h>
-#include <mutex>
 
 namespace eeros {
 namespace sockets {
-    
+
 void sigPipeHandler(int signum);
 
-template < uint32_t BufInLen, typename inT, uint32_t BufOutLen, typename outT >
-class SocketServer : public eeros::Thread {
+/**
+ * Socket server thread which accepts a single client. In every period it sends the latest
+ * frame published by the control system and receives a frame from the client.
+ * Frames are exchanged with the control system through a \ref FrameLink.
+ *
+ * @tparam TxType - payload type of sent frames, std::nullptr_t if nothing is sent
+ * @tparam RxType - payload type of received frames, std::nullptr_t if nothing is received
+ */
+template < typename TxType, typename RxType >
+class SocketServer : public FrameLink<TxType, RxType>, public eeros::Thread {
  public:
-  SocketServer(uint16_t port, double period = 0.01, double timeout = 1.0, int priority = 5) 
+  SocketServer(uint16_t port, double period = 0.01, double timeout = 1.0, int priority = 5)
      : Thread(priority) {
     this->port = port;
     this->period = period;
@@ -32,57 +39,45 @@ class SocketServer : public eeros::Thread {
     running = false;
     connected = false;
   }
-  
+
   virtual ~SocketServer() {
     join();
   }
-  
+
   virtual void stop() {
     running = false;
   }
-  
+
   virtual bool isRunning() {
     return running;
   }
-  
+
   virtual bool isConnected() {
     return connected;
   }
-  
-  virtual std::array<outT, BufOutLen>& getReceiveBuffer() {
-    std::lock_guard<std::mutex> lock(mtx);
-    return rxBuf;
-  }
-  
-  virtual void setSendBuffer(std::array<inT, BufInLen>& data) {
-    std::lock_guard<std::mutex> lock(mtx);
-    txBuf = data;
-  }
 
-  bool newData = false;
-  
  private:
-  virtual void run() {	
+  virtual void run() {
     log.info() << "SocketServer thread started";
     struct sockaddr_in servAddr;
     sockfd = socket(AF_INET, SOCK_STREAM, 0);
     if (sockfd < 0) throw Fault("ERROR opening socket");
-    
-    bzero((char *) &servAddr, sizeof(servAddr));	
-    servAddr.sin_port = htons(port); 
+
+    bzero((char *) &servAddr, sizeof(servAddr));
+    servAddr.sin_port = htons(port);
     servAddr.sin_family = AF_INET;
     servAddr.sin_addr.s_addr = htonl(INADDR_ANY) ;
     int yes = 1;
     if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes)) == -1)
       throw Fault("ERROR on set socket option");
-    if (bind(sockfd, (struct sockaddr *) &servAddr, sizeof(servAddr)) < 0) 
+    if (bind(sockfd, (struct sockaddr *) &servAddr, sizeof(servAddr)) < 0)
       throw Fault("ERROR on socket binding");
-    
+
     socklen_t clilen;
     listen(sockfd,1);
     struct sockaddr_in cliAddr;
     clilen = sizeof(cliAddr);
-    
+
     running = true;
     while (running) {
       newsockfd = accept(sockfd, (struct sockaddr *) &cliAddr,  &clilen);
@@ -91,164 +86,34 @@ class SocketServer : public eeros::Thread {
       char cliName[INET6_ADDRSTRLEN];
       getnameinfo((struct sockaddr*)&cliAddr, sizeof cliAddr, cliName, sizeof(cliName), NULL, 0, NI_NUMERICHOST|NI_NUMERICSERV);
       log.info() << "Client connection from ip=" << cliName << " accepted";
-      inT b_write[BufInLen]; outT b_read[BufOutLen];
       using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
       auto next_cycle = std::chrono::steady_clock::now() + seconds(period);
-    
+
       while (connected) {
         std::this_thread::sleep_until(next_cycle);
-  
-        // write
-        std::unique_lock<std::mutex> wlck(mtx);
-        for(uint32_t i = 0; i < BufInLen; i++) b_write[i] = txBuf[i]; 
-        wlck.unlock();
-//         log.warn() << "try to write ";
-        int n = write(newsockfd, b_write, BufInLen * sizeof(inT));
-        if (n < 0) {
+        if (!this->tx.send(newsockfd)) {
           log.trace() << "error = " << std::strerror(errno);
           connected = false;
-        }	
-        
-        // read
-        size_t count = BufOutLen * sizeof(outT);
-        uint8_t* ptr = (uint8_t *)b_read;
-        auto endTime = std::chrono::steady_clock::now() + seconds(timeout);
-        while (connected && count) {
-          if (std::chrono::steady_clock::now() > endTime) {
-            log.trace() << "error = socket read timed out";
-            connected = false;
-          }
-//           log.warn() << "try to read " << count << " Bytes";
-          n = read(newsockfd, ptr, count);
-          if (n < 0) {
-            log.trace() << "error = " << std::strerror(errno);
-            connected = false;
-          }
-          ptr += n;
-          count -= n;
+        } else if (!this->rx.receive(newsockfd, timeout)) {
+          log.trace() << "error = socket read failed, timed out or received invalid frame";
+          connected = false;
         }
-        std::unique_lock<std::mutex> rlck(mtx);
-        for(uint32_t i = 0; i < BufOutLen; i++) rxBuf[i] = b_read[i];
-        rlck.unlock();
-        newData = true;
         next_cycle += seconds(period);
       }
       close(newsockfd);
       // if disconnected clear receive buffer
-      for(uint32_t i = 0; i < BufOutLen; i++) rxBuf[i] = 0;
-      newData = true;
+      this->rx.clear();
     }
     close(sockfd);
   }
-  
-  bool running;
-  uint16_t port;
-  double period;
-  double timeout;	// time which thread tries to read until socket read timed out
-  struct hostent *server;
-  int sockfd;
-  int newsockfd;
-  bool connected;
-  std::mutex mtx;
-  std::array<outT, BufOutLen> rxBuf;
-  std::array<inT, BufInLen> txBuf;
-};
-
-// specialization used when server doesn't receive data from its client
-template < uint32_t BufInLen, typename inT >
-class SocketServer<BufInLen, inT, 0, std::nullptr_t> : public eeros::Thread {
- public:
-  SocketServer(uint16_t port, double period = 0.01, double timeout = 1.0, int priority = 5) : Thread(priority) {
-    this->port = port;
-    this->period = period;
-    signal(SIGPIPE, sigPipeHandler);	// make sure, that a broken pipe does not stop application
-    running = false;
-    connected = false;
-  }
-  
-  virtual ~SocketServer() {
-    join();
-  }
-  
-  virtual void stop(){
-    running = false;
-  }
-  
-  virtual bool isRunning() {
-    return running;
-  }
-  
-  virtual bool isConnected() {
-    return connected;
-  }
-  
-  virtual void setSendBuffer(std::array<inT, BufInLen>& data) {
-    std::lock_guard<std::mutex> lock(mtx);
-    txBuf = data;
-  }
 
- private:
-  virtual void run() {	
-    log.info() << "SocketServer thread started";
-    struct sockaddr_in servAddr;
-    sockfd = socket(AF_INET, SOCK_STREAM, 0);
-    if (sockfd < 0) throw Fault("ERROR opening socket");
-    
-    bzero((char *) &servAddr, sizeof(servAddr));	
-    servAddr.sin_port = htons(port); 
-    servAddr.sin_family = AF_INET;
-    servAddr.sin_addr.s_addr = htonl(INADDR_ANY) ;
-    int yes = 1;
-    if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes)) == -1)
-      throw Fault("ERROR on set socket option");
-    if (bind(sockfd, (struct sockaddr *) &servAddr, sizeof(servAddr)) < 0) 
-      throw Fault("ERROR on socket binding");
-    
-    socklen_t clilen;
-    listen(sockfd,1);
-    struct sockaddr_in cliAddr;
-    clilen = sizeof(cliAddr);
-    
-    running = true;
-    while (running) {
-      newsockfd = accept(sockfd, (struct sockaddr *) &cliAddr,  &clilen);
-      if (newsockfd < 0) throw Fault("ERROR on accept");
-      connected = true;
-      char cliName[INET6_ADDRSTRLEN];
-      getnameinfo((struct sockaddr*)&cliAddr, sizeof cliAddr, cliName, sizeof(cliName), NULL, 0, NI_NUMERICHOST|NI_NUMERICSERV);
-      log.info() << "Client connection from ip=" << cliName << " accepted";
-      inT b_write[BufInLen];
-      using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
-      auto next_cycle = std::chrono::steady_clock::now() + seconds(period);
-    
-      while (connected) {
-        std::this_thread::sleep_until(next_cycle);
-      
-        // write
-        std::unique_lock<std::mutex> wlck(mtx);
-        for(uint32_t i = 0; i < BufInLen; i++) b_write[i] = txBuf[i]; 
-        wlck.unlock();
-        int n = write(newsockfd, b_write, BufInLen * sizeof(inT));
-        if (n < 0) {
-          log.trace() << "error = " << std::strerror(errno);
-          connected = false;
-        }
-        next_cycle += seconds(period);
-      }
-      close(newsockfd);
-    }
-    close(sockfd);
-  }
-  
   bool running;
   uint16_t port;
   double period;
-  struct hostent *server;
+  double timeout;	// time which thread tries to read until socket read timed out
   int sockfd;
   int newsockfd;
   bool connected;
-  std::mutex mtx;
-  std::array<inT, BufInLen> txBuf;
 };
 
 }
@@ -1,16 +1,43 @@
 #ifndef ORG_EEROS_TASK_ASYNC_HPP_
 #define ORG_EEROS_TASK_ASYNC_HPP_
 
+#include <atomic>
 #include <thread>
 
 #include <eeros/core/Runnable.hpp>
-#include <eeros/core/Semaphore.hpp>
+#include <eeros/core/Wakeup.hpp>
 #include <eeros/core/PeriodicCounter.hpp>
+#include <eeros/core/Watchdog.hpp>
 #include <eeros/logger/Logger.hpp>
 
 namespace eeros {
+
+namespace safety {
+class SafetySystem;
+class SafetyEvent;
+}
+
 namespace task {
 
+/**
+ * Defines what happens if a task is activated while its previous activation
+ * is still pending or running.
+ */
+enum class OverrunPolicy {
+  coalesce,     // the activation is merged into the pending one
+  queue,        // the activation is queued, the task runs again right after the pending one
+  safetyEvent   // like coalesce, additionally a safety event is triggered
+};
+
+/**
+ * Runs a runnable in its own thread. Every call of \ref run() activates the thread once.
+ * The thread is woken with a futex, the time from the activation to the start of the
+ * task is recorded as wake latency in the periodic counter.
+ * Activations which hit a task still pending or running are counted as overruns
+ * and handled according to the overrun policy.
+ *
+ * @since v0.4
+ */
 class Async : public Runnable {
  public:
   Async(Runnable &task, bool realtime = false, int nice = 0);
@@ -20,6 +47,44 @@ class Async : public Runnable {
   void stop();
   void join();
 
+  /**
+   * Sets the overrun policy, the default policy is coalesce.
+   *
+   * @param policy - overrun policy, must not be safetyEvent
+   */
+  void setOverrunPolicy(OverrunPolicy policy);
+
+  /**
+   * Sets the overrun policy to safetyEvent. The event is triggered on the first
+   * overrun after an activation without overrun.
+   *
+   * @param ss - safety system
+   * @param event - event to trigger
+   */
+  void setOverrunPolicy(safety::SafetySystem &ss, safety::SafetyEvent &event);
+
+  /**
+   * Returns the number of activations which found the task still pending or running.
+   *
+   * @return number of overruns
+   */
+  uint64_t getOverrunCount() const;
+
+  /**
+   * Returns the number of activations merged into a pending one.
+   *
+   * @return number of skipped activations
+   */
+  uint64_t getSkippedCount() const;
+
+  /**
+   * Sets a heartbeat which is kicked after every run of the task.
+   * Must be set before the first activation.
+   *
+   * @param heartbeat - heartbeat of a watchdog
+   */
+  void setHeartbeat(Watchdog::Heartbeat &heartbeat);
+
   PeriodicCounter counter;
 
  private:
@@ -27,10 +92,19 @@ class Async : public Runnable {
   Runnable &task;
   bool realtime;
   int nice;
-  Semaphore semaphore;
-  std::thread thread;
-  bool finished;
+  OverrunPolicy policy;
+  safety::SafetySystem *safetySystem;
+  safety::SafetyEvent *overrunEvent;
+  Watchdog::Heartbeat *heartbeat;
+  Wakeup wakeup;
+  std::atomic<bool> busy;
+  std::atomic<uint32_t> queued;
+  std::atomic<uint64_t> overruns;
+  std::atomic<uint64_t> skipped;
+  bool overrunning;
+  std::atomic<bool> finished;
   logger::Logger log;
+  std::thread thread;
 };
 
 }
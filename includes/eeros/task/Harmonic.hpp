@@ -8,12 +8,14 @@ namespace eeros {
 
 		class Harmonic : public Runnable {
 		public:
-			Harmonic(Runnable &task, int n = 1);
-			Harmonic(Runnable *task, int n = 1);
+			Harmonic(Runnable &task, int n = 1, int phase = 0);
+			Harmonic(Runnable *task, int n = 1, int phase = 0);
 			Runnable *getTask();
+			int getN();
+			int getPhase();
 			virtual void run();
 		private:
-			int n, k;
+			int n, k, phase;
 			Runnable *task;
 		};
 
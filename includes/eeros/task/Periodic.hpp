@@ -6,6 +6,7 @@
 
 #include <eeros/core/Runnable.hpp>
 #include <eeros/core/PeriodicCounter.hpp>
+#include <eeros/task/Async.hpp>
 
 namespace eeros {
 namespace task {
@@ -109,6 +110,81 @@ class Periodic {
     nice = value;
   }
 
+  /**
+   * Sets the phase offset of the periodic. A periodic with a period of n base periods
+   * and phase p runs on every base tick t with (t + 1) % n == p % n, thereby periodics with
+   * related periods can be kept from running on the same base tick.
+   * A negative phase lets the executor assign the phase, see \ref Executor::useAutoPhase().
+   *
+   * @param ticks - phase offset in base periods
+   */
+  void setPhase(int ticks) {
+    phase = ticks;
+  }
+
+  /**
+   * Gets the phase offset of the periodic.
+   *
+   * @return phase offset in base periods, negative if not set
+   */
+  int getPhase() {
+    return phase;
+  }
+
+  /**
+   * Sets the expected run time of the periodic. The executor uses it to spread the
+   * activations of the periodics evenly over the base ticks when assigning phases.
+   * A good estimate is the mean run time reported by the executor in a previous run.
+   *
+   * @param time - run time in s
+   */
+  void setExpectedRunTime(double time) {
+    expectedRunTime = time;
+  }
+
+  /**
+   * Gets the expected run time of the periodic.
+   *
+   * @return run time in s, 0 if not set
+   */
+  double getExpectedRunTime() {
+    return expectedRunTime;
+  }
+
+  /**
+   * Sets what happens if the periodic is activated while its previous run has not
+   * finished yet. The default policy is OverrunPolicy::coalesce. Only applies to periodics
+   * running in their own thread.
+   *
+   * @param policy - overrun policy, must not be safetyEvent
+   */
+  void setOverrunPolicy(OverrunPolicy policy) {
+    overrunPolicy = policy;
+  }
+
+  /**
+   * Triggers a safety event if the periodic is activated while its previous run has not
+   * finished yet. Only applies to periodics running in their own thread.
+   *
+   * @param ss - safety system
+   * @param event - event to trigger
+   */
+  void setOverrunPolicy(safety::SafetySystem &ss, safety::SafetyEvent &event) {
+    overrunPolicy = OverrunPolicy::safetyEvent;
+    overrunSafetySystem = &ss;
+    overrunEvent = &event;
+  }
+
+  /**
+   * Applies the overrun policy of this periodic to the thread running it.
+   *
+   * @param async - thread running the periodic
+   */
+  void applyOverrunPolicy(Async &async) {
+    if (overrunPolicy == OverrunPolicy::safetyEvent) async.setOverrunPolicy(*overrunSafetySystem, *overrunEvent);
+    else async.setOverrunPolicy(overrunPolicy);
+  }
+
   /**
    * A periodic can be chosen to be run before another periodic.
    * In such a case you have to add it to this vector.
@@ -133,6 +209,11 @@ class Periodic {
   Runnable *task;
   bool realtime;
   int nice;
+  int phase = -1;
+  double expectedRunTime = 0;
+  OverrunPolicy overrunPolicy = OverrunPolicy::coalesce;
+  safety::SafetySystem *overrunSafetySystem = nullptr;
+  safety::SafetyEvent *overrunEvent = nullptr;
 };
 
 }
@@ -99,6 +99,23 @@ void Config::add(std::string name, std::size_t length, double *start, double *en
   };
 }
 
+void Config::add(std::string name, std::shared_ptr<TableFile> &table) {
+  auto k = properties.find(name);
+  if (k != properties.end()) {
+    throw eeros::Fault(std::string("Property '") + name + "' already added.");
+  }
+  properties[name] = ConfigPropertyAccessor {
+    [&table] (std::string name, std::string& val) -> void {
+      val = table ? table->getFilename() : "";
+    },
+    [&table] (std::string name, const std::string_view val) -> void {
+      auto first = val.find_first_not_of(' ');
+      if (first == std::string_view::npos) table.reset();
+      else table = std::make_shared<TableFile>(std::string(val.substr(first)));
+    }
+  };
+}
+
 void Config::add(std::string name, std::string &value) {
   auto k = properties.find(name);
   if (k != properties.end()) {
@@ -0,0 +1,125 @@
+#include <eeros/config/TableFile.hpp>
+#include <eeros/core/Fault.hpp>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace eeros;
+using namespace eeros::config;
+
+namespace {
+
+const char magic[8] = {'E', 'E', 'R', 'O', 'S', 'T', 'B', 'L'};
+
+// header of the binary format, followed by the samples, all in host byte order
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t dims;
+  uint64_t size[TableFile::maxDims];
+  double min[TableFile::maxDims];
+  double max[TableFile::maxDims];
+  uint64_t checksum;
+};
+
+// FNV-1a over the samples
+uint64_t checksum(const double* s, std::size_t count) {
+  uint64_t h = 14695981039346656037ull;
+  for (std::size_t i = 0; i < count; i++) {
+    uint64_t w;
+    std::memcpy(&w, &s[i], sizeof(w));
+    h ^= w;
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+}
+
+constexpr std::size_t TableFile::maxDims;
+constexpr uint32_t TableFile::version;
+
+TableFile::TableFile(const std::string& filename) : filename(filename), samples(nullptr), map(nullptr), mapSize(0) {
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw Fault("Table file '" + filename + "' cannot be opened");
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header)) {
+    ::close(fd);
+    throw Fault("Table file '" + filename + "' is truncated");
+  }
+  mapSize = st.st_size;
+  map = ::mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    map = nullptr;
+    throw Fault("Table file '" + filename + "' cannot be mapped");
+  }
+  try {
+    const Header* h = static_cast<const Header*>(map);
+    if (std::memcmp(h->magic, magic, sizeof(magic)) != 0)
+      throw Fault("'" + filename + "' is not a table file");
+    if (h->version != version || h->dims < 1 || h->dims > maxDims)
+      throw Fault("Table file '" + filename + "' has an unsupported version");
+    setGrid(h->size, h->min, h->max, h->dims);
+    if (total > (mapSize - sizeof(Header)) / sizeof(double) || mapSize != sizeof(Header) + total * sizeof(double))
+      throw Fault("Table file '" + filename + "' is truncated");
+    samples = reinterpret_cast<const double*>(h + 1);
+    if (checksum(samples, total) != h->checksum)
+      throw Fault("Table file '" + filename + "' has a wrong checksum");
+  } catch (...) {
+    ::munmap(map, mapSize);
+    throw;
+  }
+}
+
+TableFile::TableFile(std::vector<std::size_t> size, std::vector<double> min, std::vector<double> max, std::vector<double> samples)
+    : storage(std::move(samples)), map(nullptr), mapSize(0) {
+  if (size.size() < 1 || size.size() > maxDims || min.size() != size.size() || max.size() != size.size())
+    throw Fault("Table must have 1 to 3 dimensions");
+  uint64_t s[maxDims];
+  for (std::size_t d = 0; d < size.size(); d++) s[d] = size[d];
+  setGrid(s, min.data(), max.data(), size.size());
+  if (storage.size() != total) throw Fault("Number of samples does not match the size of the table");
+  this->samples = storage.data();
+}
+
+TableFile::~TableFile() {
+  if (map != nullptr) ::munmap(map, mapSize);
+}
+
+void TableFile::setGrid(const uint64_t* size, const double* min, const double* max, std::size_t dims) {
+  this->dims = dims;
+  total = 1;
+  for (std::size_t d = 0; d < maxDims; d++) {
+    this->size[d] = d < dims ? size[d] : 1;
+    this->min[d] = d < dims ? min[d] : 0;
+    this->max[d] = d < dims ? max[d] : 0;
+    if (d < dims && (size[d] < 2 || !(max[d] > min[d])))
+      throw Fault("Table needs at least 2 samples and an increasing grid in each dimension");
+    if (this->size[d] > (std::size_t(1) << 40) / total) throw Fault("Table is too large");
+    total *= this->size[d];
+  }
+}
+
+void TableFile::save(const std::string& filename) {
+  Header h;
+  std::memset(&h, 0, sizeof(h));
+  std::memcpy(h.magic, magic, sizeof(magic));
+  h.version = version;
+  h.dims = dims;
+  for (std::size_t d = 0; d < maxDims; d++) {
+    h.size[d] = size[d];
+    h.min[d] = min[d];
+    h.max[d] = max[d];
+  }
+  h.checksum = checksum(samples, total);
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) throw Fault("Table file '" + filename + "' cannot be opened");
+  file.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  file.write(reinterpret_cast<const char*>(samples), total * sizeof(double));
+  if (!file) throw Fault("Table file '" + filename + "' cannot be written");
+  this->filename = filename;
+}
@@ -0,0 +1,58 @@
+#include <eeros/control/Arena.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace eeros;
+using namespace eeros::control;
+
+Arena::Arena(std::size_t size) : Arena(nullptr, size) { }
+
+Arena::Arena(TimeDomain& td, std::size_t size) : Arena(&td, size) { }
+
+Arena::Arena(TimeDomain* td, std::size_t size)
+    : td(td), region(nullptr), size(0), used(0), locked(false), log(logger::Logger::getLogger()) {
+  std::size_t page = sysconf(_SC_PAGESIZE);
+  this->size = (size + page - 1) / page * page;
+  if (this->size == 0) throw Fault("Arena needs a size larger than 0");
+  void* p = ::mmap(nullptr, this->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+  if (p == MAP_FAILED) throw Fault("Arena of " + std::to_string(this->size) + " bytes cannot be mapped");
+  region = static_cast<char*>(p);
+  // large arenas are backed by huge pages if the system allows, fewer pages need fewer TLB entries
+  ::madvise(region, this->size, MADV_HUGEPAGE);
+  locked = (::mlock(region, this->size) == 0);
+  if (!locked) log.warn() << "Arena of " << this->size << " bytes cannot be locked in RAM";
+}
+
+Arena::~Arena() {
+  for (auto i = objects.rbegin(); i != objects.rend(); i++) {
+    if (td != nullptr) td->removeBlock(i->block);
+    i->destroy(i->object);
+  }
+  if (locked) ::munlock(region, size);
+  ::munmap(region, size);
+}
+
+void* Arena::allocate(std::size_t size, std::size_t align) {
+  std::size_t start = (used + align - 1) / align * align;
+  if (start + size > this->size)
+    throw Fault("Arena of " + std::to_string(this->size) + " bytes is full, " + std::to_string(size) + " bytes requested");
+  used = start + size;
+  return region + start;
+}
+
+bool Arena::isLocked() const {
+  return locked;
+}
+
+std::size_t Arena::getSize() const {
+  return size;
+}
+
+std::size_t Arena::getUsed() const {
+  return used;
+}
+
+bool Arena::contains(const void* object) const {
+  auto p = static_cast<const char*>(object);
+  return p >= region && p < region + used;
+}
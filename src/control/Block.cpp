@@ -1,11 +1,54 @@
 #include <eeros/control/Block.hpp>
+#include <algorithm>
+#include <mutex>
+#include <set>
 
 using namespace eeros::control;
 
+namespace {
+	std::mutex withoutOwnerMutex;
+	std::set<InputBase*> withoutOwner;
+}
+
+unsigned int InputBase::getConnectedWithoutOwner() {
+	std::lock_guard<std::mutex> lock(withoutOwnerMutex);
+	return withoutOwner.size();
+}
+
+std::vector<Block*> InputBase::getSourcesWithoutOwner() {
+	std::lock_guard<std::mutex> lock(withoutOwnerMutex);
+	std::vector<Block*> sources;
+	for (auto input : withoutOwner) sources.push_back(input->getSourceBlock());
+	return sources;
+}
+
+void InputBase::trackWithoutOwner(InputBase* input, bool connected) {
+	std::lock_guard<std::mutex> lock(withoutOwnerMutex);
+	if (connected) withoutOwner.insert(input);
+	else withoutOwner.erase(input);
+}
+
 void Block::setName(std::string name) {
-	this->name = name;
+	metadata().name = name;
 }
 
 std::string Block::getName() const {
-	return name;
-}
\ No newline at end of file
+	if (!meta) return "";
+	return meta->name;
+}
+
+void Block::registerInput(InputBase* input) {
+	auto& inputs = metadata().inputs;
+	if (std::find(inputs.begin(), inputs.end(), input) == inputs.end()) inputs.push_back(input);
+}
+
+const std::vector<InputBase*>& Block::getInputs() const {
+	static const std::vector<InputBase*> none;
+	if (!meta) return none;
+	return meta->inputs;
+}
+
+Block::Metadata& Block::metadata() {
+	if (!meta) meta.reset(new Metadata());
+	return *meta;
+}
@@ -0,0 +1,112 @@
+#include <eeros/control/can/CanTransport.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/core/System.hpp>
+#include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+using namespace eeros;
+using namespace eeros::control;
+
+constexpr unsigned int CanTransport::maxFrames;
+constexpr canid_t CanTransport::syncId;
+constexpr unsigned int CanNodeTable::size;
+
+CanTransport::CanTransport(int socket) : socket(socket), timestamps(false), errors(0), txCount(0) {
+  for (unsigned int i = 0; i < maxFrames; i++) {
+    rxIov[i].iov_base = &rxFrame[i];
+    rxIov[i].iov_len = sizeof(can_frame);
+    std::memset(&rxMsg[i], 0, sizeof(mmsghdr));
+    rxMsg[i].msg_hdr.msg_iov = &rxIov[i];
+    rxMsg[i].msg_hdr.msg_iovlen = 1;
+    txIov[i].iov_base = &txFrame[i];
+    txIov[i].iov_len = sizeof(can_frame);
+    std::memset(&txMsg[i], 0, sizeof(mmsghdr));
+    txMsg[i].msg_hdr.msg_iov = &txIov[i];
+    txMsg[i].msg_hdr.msg_iovlen = 1;
+  }
+}
+
+void CanTransport::setFilter(const std::vector<canid_t>& ids) {
+  std::vector<can_filter> filter(ids.size());
+  for (std::size_t i = 0; i < ids.size(); i++) {
+    filter[i].can_id = ids[i] & CAN_SFF_MASK;
+    filter[i].can_mask = CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+  }
+  if (setsockopt(socket, SOL_CAN_RAW, CAN_RAW_FILTER, filter.data(), filter.size() * sizeof(can_filter)) < 0)
+    throw Fault("Error: Failed to set can receive filter");
+}
+
+void CanTransport::clearFilter() {
+  can_filter all = { };
+  if (setsockopt(socket, SOL_CAN_RAW, CAN_RAW_FILTER, &all, sizeof(all)) < 0)
+    throw Fault("Error: Failed to clear can receive filter");
+}
+
+void CanTransport::enableTimestamps() {
+  int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+  if (setsockopt(socket, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) < 0)
+    throw Fault("Error: Failed to enable can receive timestamps");
+  for (unsigned int i = 0; i < maxFrames; i++) rxMsg[i].msg_hdr.msg_control = rxControl[i];
+  timestamps = true;
+}
+
+unsigned int CanTransport::receive() {
+  if (timestamps) {
+    for (unsigned int i = 0; i < maxFrames; i++) rxMsg[i].msg_hdr.msg_controllen = controlSize;
+  }
+  int n = recvmmsg(socket, rxMsg.data(), maxFrames, MSG_DONTWAIT, nullptr);
+  uint64_t now = System::getTimeNs();
+  if (n <= 0) {
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) errors++;
+    return 0;
+  }
+  if (!timestamps) {
+    for (int i = 0; i < n; i++) rxTime[i] = now;
+    return n;
+  }
+  // the kernel stamps with the realtime clock, the offset to the system clock is taken once per batch
+  struct timespec real;
+  clock_gettime(CLOCK_REALTIME, &real);
+  int64_t offset = static_cast<int64_t>(now) - (static_cast<int64_t>(real.tv_sec) * 1000000000 + real.tv_nsec);
+  for (int i = 0; i < n; i++) {
+    rxTime[i] = now;
+    msghdr& h = rxMsg[i].msg_hdr;
+    for (cmsghdr* c = CMSG_FIRSTHDR(&h); c != nullptr; c = CMSG_NXTHDR(&h, c)) {
+      if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_TIMESTAMPING) {
+        scm_timestamping ts;
+        std::memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+        int64_t t = static_cast<int64_t>(ts.ts[0].tv_sec) * 1000000000 + ts.ts[0].tv_nsec;
+        if (t != 0) rxTime[i] = t + offset;
+      }
+    }
+  }
+  return n;
+}
+
+bool CanTransport::queue(canid_t id, const void* data, uint8_t len) {
+  if (txCount >= maxFrames || len > CAN_MAX_DLEN) return false;
+  can_frame& f = txFrame[txCount++];
+  std::memset(&f, 0, sizeof(f));
+  f.can_id = id;
+  f.can_dlc = len;
+  if (len > 0) std::memcpy(f.data, data, len);
+  return true;
+}
+
+unsigned int CanTransport::flush() {
+  unsigned int sent = 0;
+  while (sent < txCount) {
+    int n = sendmmsg(socket, &txMsg[sent], txCount - sent, MSG_DONTWAIT);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) break;
+      txCount = 0;
+      throw Fault(std::string("Error: Failed to send can frames: ") + std::strerror(errno));
+    }
+    sent += n;
+  }
+  txCount = 0;
+  return sent;
+}
@@ -0,0 +1,55 @@
+#include <eeros/control/FaultStatus.hpp>
+#include <eeros/control/Block.hpp>
+
+using namespace eeros::control;
+
+namespace {
+
+thread_local FaultStatus* current = nullptr;
+
+}
+
+FaultStatus::Scope::Scope(FaultStatus& status) : previous(current) {
+  current = &status;
+}
+
+FaultStatus::Scope::~Scope() {
+  current = previous;
+}
+
+FaultStatus::FaultStatus() : word(0), firstCode(0), firstBlock(nullptr) { }
+
+bool FaultStatus::raise(FaultCode code, const Block* block) {
+  FaultStatus* status = current;
+  if (status == nullptr) return false;
+  uint32_t c = static_cast<uint32_t>(code);
+  if (status->word.fetch_or(c, std::memory_order_relaxed) == 0) {
+    status->firstCode.store(c, std::memory_order_relaxed);
+    status->firstBlock.store(block, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+uint32_t FaultStatus::get() const {
+  return word.load(std::memory_order_relaxed);
+}
+
+std::string FaultStatus::getMessage() const {
+  const Block* block = firstBlock.load(std::memory_order_relaxed);
+  std::string name = block != nullptr ? block->getName() : "";
+  switch (static_cast<FaultCode>(firstCode.load(std::memory_order_relaxed))) {
+    case FaultCode::notConnected:
+      return "Read from an unconnected input in block '" + name + "'";
+    case FaultCode::nanOutput:
+      return "NaN written to output '" + name + "', set to safe level if safe level is defined";
+    case FaultCode::framesDropped:
+      return "Frames dropped by block '" + name + "', send queue of the bus is full";
+  }
+  return "Unknown fault in block '" + name + "'";
+}
+
+void FaultStatus::clear() {
+  firstBlock.store(nullptr, std::memory_order_relaxed);
+  firstCode.store(0, std::memory_order_relaxed);
+  word.store(0, std::memory_order_relaxed);
+}
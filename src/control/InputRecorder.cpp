@@ -0,0 +1,145 @@
+#include <eeros/control/InputRecorder.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/safety/SafetySystem.hpp>
+#include <chrono>
+#include <cstring>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+const char magic[8] = {'E', 'E', 'R', 'O', 'S', 'R', 'E', 'C'};
+
+}
+
+InputRecorder::InputRecorder(const std::string& filename, std::size_t bufferSize)
+    : filename(filename), file(filename, std::ios::binary | std::ios::trunc), safetySystem(nullptr),
+      frameSize(sizeof(recording::Frame)), bufferSize(bufferSize), cycle(0), head(0), tail(0), dropped(0),
+      finished(false), log(logger::Logger::getLogger()) {
+  if (!file.is_open()) throw Fault("Recording '" + filename + "' cannot be opened");
+  if (bufferSize < 2) throw Fault("Recording '" + filename + "' needs a buffer of at least 2 frames");
+  resize();
+  thread = std::thread([this]() { write(); });
+}
+
+InputRecorder::~InputRecorder() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  cv.notify_one();
+  if (thread.joinable()) thread.join();
+  if (dropped > 0) log.warn() << "Recording '" << filename << "': " << dropped << " of " << cycle << " frames dropped";
+}
+
+recording::Channel InputRecorder::channel(const std::string& id, recording::Type type) {
+  if (cycle > 0) throw Fault("Recording '" + filename + "': inputs must be added before the first run");
+  if (id.size() > recording::maxIdLength) throw Fault("Recording '" + filename + "': input id '" + id + "' is too long");
+  recording::Channel c;
+  std::memset(&c, 0, sizeof(c));
+  std::memcpy(c.id, id.data(), id.size());
+  c.type = type;
+  return c;
+}
+
+void InputRecorder::add(PeripheralInput<double>& input) {
+  realChannels.push_back(channel(input.getInputId(), recording::Type::real));
+  reals.push_back(&input.getOut().getSignal());
+  resize();
+}
+
+void InputRecorder::add(PeripheralInput<bool>& input) {
+  logicChannels.push_back(channel(input.getInputId(), recording::Type::logic));
+  logics.push_back(&input.getOut().getSignal());
+  resize();
+}
+
+void InputRecorder::setSafetySystem(safety::SafetySystem& ss) {
+  safetySystem = &ss;
+}
+
+void InputRecorder::resize() {
+  frameSize = sizeof(recording::Frame) + (reals.size() + logics.size()) * sizeof(recording::Sample);
+  buffer.assign(bufferSize * frameSize / sizeof(uint64_t), 0);
+}
+
+void InputRecorder::run() {
+  uint64_t h = head.load(std::memory_order_relaxed);
+  uint64_t n = cycle++;
+  if (h - tail.load(std::memory_order_acquire) >= bufferSize) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  auto frame = reinterpret_cast<recording::Frame*>(&buffer[(h % bufferSize) * (frameSize / sizeof(uint64_t))]);
+  frame->cycle = n;
+  frame->timeNs = System::getCycleTimeNs();
+  frame->level = safetySystem != nullptr ? safetySystem->getCurrentLevel().getLevelId() : 0;
+  frame->reserved = 0;
+  // the output signals of input blocks are plain signals, the qualified calls avoid the virtual dispatch
+  auto sample = reinterpret_cast<recording::Sample*>(frame + 1);
+  for (auto s : reals) {
+    sample->value = s->Signal<double>::getValue();
+    sample->timestamp = s->Signal<double>::getTimestamp();
+    sample++;
+  }
+  for (auto s : logics) {
+    sample->value = s->Signal<bool>::getValue() ? 1.0 : 0.0;
+    sample->timestamp = s->Signal<bool>::getTimestamp();
+    sample++;
+  }
+  head.store(h + 1, std::memory_order_release);
+}
+
+uint64_t InputRecorder::getFrameCount() const {
+  return cycle;
+}
+
+uint64_t InputRecorder::getDroppedCount() const {
+  return dropped;
+}
+
+std::size_t InputRecorder::getFrameSize() const {
+  return frameSize;
+}
+
+// writer thread, the file header is written with the first frame when the inputs are known
+void InputRecorder::write() {
+  bool headerWritten = false;
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    bool last = finished;
+    lock.unlock();
+    uint64_t h = head.load(std::memory_order_acquire);
+    uint64_t t = tail.load(std::memory_order_relaxed);
+    if (h > t && !headerWritten) {
+      recording::Header header;
+      std::memset(&header, 0, sizeof(header));
+      std::memcpy(header.magic, magic, sizeof(magic));
+      header.version = recording::version;
+      header.channels = realChannels.size() + logicChannels.size();
+      header.frameSize = frameSize;
+      header.dataOffset = sizeof(header) + header.channels * sizeof(recording::Channel);
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      for (auto& c : realChannels) file.write(reinterpret_cast<const char*>(&c), sizeof(c));
+      for (auto& c : logicChannels) file.write(reinterpret_cast<const char*>(&c), sizeof(c));
+      headerWritten = true;
+    }
+    while (t < h) {
+      // frames up to the end of the buffer are contiguous
+      uint64_t end = std::min(h, (t / bufferSize + 1) * bufferSize);
+      file.write(reinterpret_cast<const char*>(&buffer[(t % bufferSize) * (frameSize / sizeof(uint64_t))]), (end - t) * frameSize);
+      t = end;
+      tail.store(t, std::memory_order_release);
+    }
+    file.flush();
+    if (!file) {
+      log.error() << "Recording '" << filename << "' cannot be written";
+      return;
+    }
+    lock.lock();
+    if (last) return;
+    cv.wait_for(lock, std::chrono::milliseconds(10), [this]() { return finished.load(); });
+  }
+}
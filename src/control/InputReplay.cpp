@@ -0,0 +1,137 @@
+#include <eeros/control/InputReplay.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/hal/HAL.hpp>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+const char magic[8] = {'E', 'E', 'R', 'O', 'S', 'R', 'E', 'C'};
+
+// input reading one channel of the current frame of a replay
+template < typename T >
+class ReplayInput : public hal::Input<T> {
+ public:
+  ReplayInput(const std::string& id, const recording::Frame* const& frame, std::size_t index)
+      : hal::Input<T>(id, nullptr), frame(frame), index(index) { }
+  virtual T get() {
+    if (frame == nullptr) return T();
+    return static_cast<T>(sample().value);
+  }
+  virtual uint64_t getTimestamp() {
+    if (frame == nullptr) return System::getCycleTimeNs();
+    return sample().timestamp;
+  }
+ private:
+  const recording::Sample& sample() {
+    return reinterpret_cast<const recording::Sample*>(frame + 1)[index];
+  }
+  const recording::Frame* const& frame;
+  std::size_t index;
+};
+
+}
+
+InputReplay::InputReplay(const std::string& filename)
+    : filename(filename), map(nullptr), mapSize(0), frames(0), position(0), current(nullptr) {
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw Fault("Recording '" + filename + "' cannot be opened");
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(recording::Header)) {
+    ::close(fd);
+    throw Fault("Recording '" + filename + "' is truncated");
+  }
+  mapSize = st.st_size;
+  map = ::mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    map = nullptr;
+    throw Fault("Recording '" + filename + "' cannot be mapped");
+  }
+  try {
+    header = static_cast<const recording::Header*>(map);
+    if (std::memcmp(header->magic, magic, sizeof(magic)) != 0)
+      throw Fault("'" + filename + "' is not a recording");
+    if (header->version != recording::version)
+      throw Fault("Recording '" + filename + "' has an unsupported version");
+    uint64_t table = sizeof(recording::Header) + header->channels * sizeof(recording::Channel);
+    if (header->dataOffset != table || header->frameSize != sizeof(recording::Frame) + header->channels * sizeof(recording::Sample) || mapSize < table)
+      throw Fault("Recording '" + filename + "' is corrupt");
+    channels = reinterpret_cast<const recording::Channel*>(header + 1);
+    data = static_cast<const char*>(map) + header->dataOffset;
+    frames = (mapSize - header->dataOffset) / header->frameSize;
+    auto& hal = hal::HAL::instance();
+    for (uint32_t i = 0; i < header->channels; i++) {
+      std::string id(channels[i].id, strnlen(channels[i].id, sizeof(channels[i].id)));
+      if (channels[i].type == recording::Type::logic) inputs.emplace_back(new ReplayInput<bool>(id, current, i));
+      else inputs.emplace_back(new ReplayInput<double>(id, current, i));
+      replaced.push_back(hal.replaceInput(inputs.back().get()));
+    }
+  } catch (...) {
+    restore();
+    ::munmap(map, mapSize);
+    throw;
+  }
+}
+
+InputReplay::~InputReplay() {
+  restore();
+  ::munmap(map, mapSize);
+}
+
+void InputReplay::restore() {
+  auto& hal = hal::HAL::instance();
+  for (std::size_t i = 0; i < replaced.size(); i++) {
+    hal.removeInput(inputs[i].get());
+    if (replaced[i] != nullptr) hal.addInput(replaced[i]);
+  }
+}
+
+void InputReplay::run() {
+  if (position >= frames) return;
+  current = reinterpret_cast<const recording::Frame*>(data + position * header->frameSize);
+  position++;
+  if (System::isSimulatedTime()) System::setSimulatedTimeNs(current->timeNs);
+}
+
+void InputReplay::seek(uint64_t frame) {
+  if (frame > frames) throw Fault("Recording '" + filename + "' has only " + std::to_string(frames) + " frames");
+  position = frame;
+}
+
+bool InputReplay::atEnd() const {
+  return position >= frames;
+}
+
+uint64_t InputReplay::getFrameCount() const {
+  return frames;
+}
+
+uint64_t InputReplay::getPosition() const {
+  return position;
+}
+
+uint64_t InputReplay::getCycle() const {
+  return current != nullptr ? current->cycle : 0;
+}
+
+uint64_t InputReplay::getTimeNs() const {
+  return current != nullptr ? current->timeNs : 0;
+}
+
+uint32_t InputReplay::getLevel() const {
+  return current != nullptr ? current->level : 0;
+}
+
+std::vector<std::string> InputReplay::getIds() const {
+  std::vector<std::string> ids;
+  for (auto& in : inputs) ids.push_back(in->getId());
+  return ids;
+}
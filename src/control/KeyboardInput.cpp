@@ -5,7 +5,7 @@ using namespace eeros::control;
 KeyboardInput::KeyboardInput(int priority) : k(priority), isHomed(this), esc(this), emergency(this), reset(this), start(this), stop(this) { }
 
 void KeyboardInput::run() {
-	uint64_t time = eeros::System::getTimeNs();
+	uint64_t time = eeros::System::getCycleTimeNs();
 	out.getSignal().setTimestamp(time);
 	out.getSignal().setValue(Vector4{k.speed[0], k.speed[1], k.speed[2], k.speed[3]});
 	
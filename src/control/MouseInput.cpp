@@ -28,39 +28,42 @@ MouseInput::MouseInput(std::string dev, Vector4 scale, Vector4 min, Vector4 max,
 }
 
 void MouseInput::run() {
+  mouse.update();
+  auto& state = mouse.getState();
+  const MouseState& current = state.value;
   if (first) {
-    x = axisScale_x * -mouse.current.axis.y;
-    y = axisScale_y * -mouse.current.axis.x;
-    z = axisScale_z * -mouse.current.axis.z;
-    r = axisScale_r * -mouse.current.axis.r;
+    x = axisScale_x * -current.axis.y;
+    y = axisScale_y * -current.axis.x;
+    z = axisScale_z * -current.axis.z;
+    r = axisScale_r * -current.axis.r;
     first = false;
   }
 
-  double vx = axisScale_x * mouse.current.axis.x;
+  double vx = axisScale_x * current.axis.x;
   if ((x + vx) < min_x) x = (min_x - vx);
   else if ((x + vx) > max_x) x = (max_x - vx);
   vx += x;
 
-  double vy = axisScale_y * mouse.current.axis.y;
+  double vy = axisScale_y * current.axis.y;
   if ((y + vy) < min_y) y = (min_y - vy);
   else if ((y + vy) > max_y) y = (max_y - vy);
   vy += y;
 
-  double vz = axisScale_z * mouse.current.axis.z;
+  double vz = axisScale_z * current.axis.z;
   if ((z + vz) < min_z) z = (min_z - vz);
   else if ((z + vz) > max_z) z = (max_z - vz);
   vz += z;
   
-  double vr = axisScale_r * mouse.current.axis.r;
+  double vr = axisScale_r * current.axis.r;
   if ((r + vr) < min_r) r = (min_r - vr);
   else if ((r + vr) > max_r) r = (max_r - vr);
   vr += r;
 
-  uint64_t time = eeros::System::getTimeNs();
+  uint64_t time = state.sequence > 0 ? state.timestamp : eeros::System::getCycleTimeNs();
   out.getSignal().setValue(Vector4{ vx, vy, vz, vr });
   out.getSignal().setTimestamp(time);
   
-  buttonOut.getSignal().setValue(Matrix<3,1,bool>{mouse.current.button.left, mouse.current.button.middle, mouse.current.button.right});
+  buttonOut.getSignal().setValue(Matrix<3,1,bool>{current.button.left, current.button.middle, current.button.right});
   buttonOut.getSignal().setTimestamp(time);
 }
 
@@ -78,8 +81,9 @@ void MouseInput::setInitPos(Matrix<4> pos) {
 }
 
 void MouseInput::reset(double x, double y, double z, double r) {
-  this->x = (x - axisScale_x * mouse.current.axis.y);
-  this->y = (y - axisScale_y * mouse.current.axis.x);
-  this->z = (z - axisScale_z * mouse.current.axis.z);
-  this->r = (r - axisScale_r * mouse.current.axis.r);
+  const MouseState& current = mouse.getState().value;
+  this->x = (x - axisScale_x * current.axis.y);
+  this->y = (y - axisScale_y * current.axis.x);
+  this->z = (z - axisScale_z * current.axis.z);
+  this->r = (r - axisScale_r * current.axis.r);
 }
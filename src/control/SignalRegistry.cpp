@@ -0,0 +1,94 @@
+#include <eeros/control/SignalRegistry.hpp>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+using namespace eeros::control;
+
+namespace {
+
+struct Entry {
+  std::string name;
+  std::string unit;
+  Block* source = nullptr;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::unordered_map<uint32_t, Entry> entries;
+};
+
+// never destroyed, signals of static objects may be destroyed after the end of main
+Registry& registry() {
+  static Registry* r = new Registry();
+  return *r;
+}
+
+std::atomic<uint32_t> counter(1);
+
+}
+
+uint32_t SignalRegistry::nextId() {
+  return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SignalRegistry::setName(uint32_t id, const std::string& name) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.entries[id].name = name;
+}
+
+std::string SignalRegistry::getName(uint32_t id) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto e = r.entries.find(id);
+  return e != r.entries.end() ? e->second.name : "";
+}
+
+void SignalRegistry::setUnit(uint32_t id, const std::string& unit) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.entries[id].unit = unit;
+}
+
+std::string SignalRegistry::getUnit(uint32_t id) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto e = r.entries.find(id);
+  return e != r.entries.end() ? e->second.unit : "";
+}
+
+void SignalRegistry::setSource(uint32_t id, Block* block) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.entries[id].source = block;
+}
+
+Block* SignalRegistry::getSource(uint32_t id) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto e = r.entries.find(id);
+  return e != r.entries.end() ? e->second.source : nullptr;
+}
+
+void SignalRegistry::copy(uint32_t from, uint32_t to) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto e = r.entries.find(from);
+  if (e != r.entries.end()) {
+    Entry copy = e->second;
+    r.entries[to] = copy;
+  }
+}
+
+void SignalRegistry::remove(uint32_t id) {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.entries.erase(id);
+}
+
+std::size_t SignalRegistry::size() {
+  auto& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  return r.entries.size();
+}
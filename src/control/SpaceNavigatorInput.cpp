@@ -3,31 +3,38 @@
 using namespace eeros::control;
 using namespace eeros::math;
 
-SpaceNavigatorInput::SpaceNavigatorInput(std::string dev, int priority) : sn(dev, priority), rotOut(this), buttonOut(this) {
+SpaceNavigatorInput::SpaceNavigatorInput(std::string dev, int priority) : sn(dev, priority), rotOut(this), buttonOut(this), newOut(this) {
 	setInitPos({0,0,0});
 }
 
 SpaceNavigatorInput::~SpaceNavigatorInput() { }
 
 void SpaceNavigatorInput::run() {
-	out.getSignal().setValue(Matrix<SPACENAVIGATOR_AXIS_COUNT>{
-		sn.current.axis[SpaceNav::Axis::X],
-		sn.current.axis[SpaceNav::Axis::Y],
-		sn.current.axis[SpaceNav::Axis::Z],
-	});	
-	uint64_t ts = eeros::System::getTimeNs();
-	out.getSignal().setTimestamp(ts);
-	rotOut.getSignal().setValue(Matrix<SPACENAVIGATOR_ROT_AXIS_COUNT>{
-		sn.current.rotAxis[SpaceNav::RotAxis::RX],
-		sn.current.rotAxis[SpaceNav::RotAxis::RY],
-		sn.current.rotAxis[SpaceNav::RotAxis::RZ],
-	});	
-	rotOut.getSignal().setTimestamp(ts);
-	buttonOut.getSignal().setValue(Matrix<SPACENAVIGATOR_BUTTON_COUNT,1,bool>{
-		sn.current.button[SpaceNav::Button::L],
-		sn.current.button[SpaceNav::Button::R]
-	});
-	buttonOut.getSignal().setTimestamp(ts);
+	bool isNew = sn.update();
+	auto& state = sn.getState();
+	uint64_t ts = state.timestamp;
+	if (isNew) {
+		const SpaceState& current = state.value;
+		out.getSignal().setValue(Matrix<SPACENAVIGATOR_AXIS_COUNT>{
+			current.axis[SpaceNav::Axis::X],
+			current.axis[SpaceNav::Axis::Y],
+			current.axis[SpaceNav::Axis::Z],
+		});	
+		out.getSignal().setTimestamp(ts);
+		rotOut.getSignal().setValue(Matrix<SPACENAVIGATOR_ROT_AXIS_COUNT>{
+			current.rotAxis[SpaceNav::RotAxis::RX],
+			current.rotAxis[SpaceNav::RotAxis::RY],
+			current.rotAxis[SpaceNav::RotAxis::RZ],
+		});	
+		rotOut.getSignal().setTimestamp(ts);
+		buttonOut.getSignal().setValue(Matrix<SPACENAVIGATOR_BUTTON_COUNT,1,bool>{
+			current.button[SpaceNav::Button::L],
+			current.button[SpaceNav::Button::R]
+		});
+		buttonOut.getSignal().setTimestamp(ts);
+	}
+	newOut.getSignal().setValue(isNew);
+	newOut.getSignal().setTimestamp(ts);
 }
 
 Output<Matrix<SPACENAVIGATOR_ROT_AXIS_COUNT,1,double>>& SpaceNavigatorInput::getRotOut() {
@@ -38,6 +45,10 @@ Output<Matrix<SPACENAVIGATOR_BUTTON_COUNT,1,bool>>& SpaceNavigatorInput::getButt
 	return buttonOut;
 }
 
+Output<bool>& SpaceNavigatorInput::getNewOut() {
+	return newOut;
+}
+
 void SpaceNavigatorInput::setInitPos(Matrix<SPACENAVIGATOR_AXIS_COUNT> initPos) {
 	out.getSignal().setValue(initPos);
 }
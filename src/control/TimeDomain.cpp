@@ -1,9 +1,37 @@
 #include <eeros/control/TimeDomain.hpp>
+#include <eeros/control/Block.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <pthread.h>
 
 using namespace eeros::control;
 
+namespace {
+
+// applies the scheduling policy and priority of thread to the calling thread
+void followScheduling(pthread_t thread) {
+  int policy;
+  sched_param param;
+  if (pthread_getschedparam(thread, &policy, &param) == 0) pthread_setschedparam(pthread_self(), policy, &param);
+}
+
+std::size_t findRoot(std::vector<std::size_t>& parent, std::size_t i) {
+  while (parent[i] != i) i = parent[i] = parent[parent[i]];
+  return i;
+}
+
+}
+
 TimeDomain::TimeDomain(std::string name, double period, bool realtime) 
-    : name(name), period(period), realtime(realtime), safetySystem(nullptr), safetyEvent(nullptr) { }
+    : name(name), period(period), realtime(realtime), safetySystem(nullptr), safetyEvent(nullptr),
+      runner(pthread_self()), cycleTimeNs(0), done(0), workersRunning(false) { }
+
+TimeDomain::~TimeDomain() {
+  stopWorkers();
+}
 
 std::string TimeDomain::getName() {
   return name;
@@ -22,21 +50,43 @@ void TimeDomain::registerSafetyEvent(SafetySystem& ss, SafetyEvent& e) {
   safetyEvent = &e;
 }
 
+void TimeDomain::setParallel(unsigned int threads, std::vector<int> cpus) {
+  this->threads = std::max(threads, 1u);
+  this->cpus = cpus;
+  partition();
+}
+
+unsigned int TimeDomain::getParallelGroups() {
+  return std::max<std::size_t>(shares.size(), 1);
+}
+
 void TimeDomain::run() {
   if(!running) return;
+  FaultStatus::Scope scope(faultStatus);
+  System::Cycle now;
   try {
-    for(auto block : blocks) block->run();
-  } catch (NotConnectedFault const& e) {
-    if(safetySystem != nullptr && safetyEvent != nullptr) {
-      safetySystem->triggerEvent(*safetyEvent);
-      safetySystem->log.error() << e.what();
-    } else throw eeros::Fault(std::string(e.what()) + ", time domain cannot trigger safety event");
+    if (threads > 1) runParallel(now.getTimeNs());
+    else for(auto block : blocks) block->run();
+  } catch (NotConnectedFault const& e) {   // thrown by blocks not using the fault status
+    handleFault(e.what());
   } catch (NaNOutputFault const& e) {
-    if(safetySystem != nullptr && safetyEvent != nullptr) {
-      safetySystem->triggerEvent(*safetyEvent);
-      safetySystem->log.error() << e.what();
-    } else throw eeros::Fault(std::string(e.what()) + ", time domain cannot trigger safety event");
+    handleFault(e.what());
   }
+  if (faultStatus.get() != 0) {
+    bool canTrigger = safetySystem != nullptr && safetyEvent != nullptr;
+    if (canTrigger) safetySystem->triggerEvent(*safetyEvent);   // fire first, format the message afterwards
+    std::string message = faultStatus.getMessage();
+    faultStatus.clear();
+    if (canTrigger) safetySystem->log.error() << message;
+    else throw eeros::Fault(message + ", time domain cannot trigger safety event");
+  }
+}
+
+void TimeDomain::handleFault(const std::string& message) {
+  if(safetySystem != nullptr && safetyEvent != nullptr) {
+    safetySystem->triggerEvent(*safetyEvent);
+    safetySystem->log.error() << message;
+  } else throw eeros::Fault(message + ", time domain cannot trigger safety event");
 }
 
 void TimeDomain::start() {
@@ -49,18 +99,159 @@ void TimeDomain::stop() {
 
 void TimeDomain::addBlock(eeros::Runnable* block) {
   blocks.push_back(block);
+  if (threads > 1) partition();
 }
 
 void TimeDomain::addBlock(eeros::Runnable& block) {
   blocks.push_back(&block);
+  if (threads > 1) partition();
 }
 
 void TimeDomain::removeBlock(eeros::Runnable* block) {
   blocks.remove(block);
+  if (threads > 1) partition();
 }
 
 void TimeDomain::removeBlock(eeros::Runnable& block) {
   blocks.remove(&block);
+  if (threads > 1) partition();
+}
+
+void TimeDomain::runParallel(uint64_t timeNs) {
+  unsigned int others = shares.size() - 1;
+  runner = pthread_self();
+  done.store(0, std::memory_order_relaxed);
+  cycleTimeNs.store(timeNs, std::memory_order_relaxed);
+  for (unsigned int share = 1; share <= others; share++) wakeups[share]->post();
+  runShare(0);
+  if (others > 0) finished.wait();
+  for (auto& f : faults) {
+    if (f) {
+      std::exception_ptr e = f;
+      for (auto& g : faults) g = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+}
+
+void TimeDomain::runShare(unsigned int share) {
+  try {
+    for (auto block : shares[share]) block->run();
+  } catch (...) {
+    faults[share] = std::current_exception();
+  }
+}
+
+void TimeDomain::partition() {
+  stopWorkers();
+  shares.clear();
+  if (threads <= 1) return;
+  std::vector<Runnable*> list(blocks.begin(), blocks.end());
+  std::size_t n = list.size();
+  std::map<Block*, std::size_t> index;
+  bool serial = false;
+  for (std::size_t i = 0; i < n; i++) {
+    Block* b = dynamic_cast<Block*>(list[i]);
+    if (b != nullptr) index[b] = i;
+    else serial = true;
+  }
+  
+  // blocks connected to each other belong to the same group
+  std::vector<std::size_t> parent(n);
+  std::iota(parent.begin(), parent.end(), 0);
+  for (auto& b : index) {
+    for (auto input : b.first->getInputs()) {
+      if (!input->isConnected()) continue;
+      Block* source = input->getSourceBlock();
+      if (source == nullptr) {
+        serial = true;
+        continue;
+      }
+      auto s = index.find(source);   // sources of other timedomains are no dependency
+      if (s != index.end()) parent[findRoot(parent, b.second)] = findRoot(parent, s->second);
+    }
+  }
+  
+  // the blocks reading from inputs without owner are unknown, they may be in this timedomain
+  unsigned int unowned = 0;
+  for (auto source : InputBase::getSourcesWithoutOwner()) {
+    if (source == nullptr || index.count(source) > 0) unowned++;
+  }
+  
+  std::map<std::size_t, std::vector<std::size_t>> groups;
+  std::string reason;
+  if (serial) reason = "contains runnables with unknown connections";
+  else if (unowned > 0) reason = "reads " + std::to_string(unowned) + " connected inputs without owner";
+  if (!reason.empty()) {
+    if (reason != serialReason) eeros::logger::Logger::getLogger().warn() << "Time domain '" << name << "' " << reason << ", blocks are run serially";
+    for (std::size_t i = 0; i < n; i++) groups[0].push_back(i);
+  } else {
+    for (std::size_t i = 0; i < n; i++) groups[findRoot(parent, i)].push_back(i);
+  }
+  serialReason = reason;
+  
+  // assign the largest groups first, each to the thread with the fewest blocks
+  std::vector<std::vector<std::size_t>> sorted;
+  for (auto& g : groups) sorted.push_back(g.second);
+  std::stable_sort(sorted.begin(), sorted.end(), [](const std::vector<std::size_t>& a, const std::vector<std::size_t>& b) {
+    return a.size() > b.size();
+  });
+  std::vector<std::vector<std::size_t>> assigned(std::min<std::size_t>(threads, std::max<std::size_t>(sorted.size(), 1)));
+  for (auto& g : sorted) {
+    auto least = std::min_element(assigned.begin(), assigned.end(), [](const std::vector<std::size_t>& a, const std::vector<std::size_t>& b) {
+      return a.size() < b.size();
+    });
+    least->insert(least->end(), g.begin(), g.end());
+  }
+  shares.clear();
+  for (auto& a : assigned) {
+    std::sort(a.begin(), a.end());
+    shares.emplace_back();
+    for (auto i : a) shares.back().push_back(list[i]);
+  }
+  faults.assign(shares.size(), nullptr);
+  startWorkers();
+}
+
+void TimeDomain::startWorkers() {
+  workersRunning = true;
+  unsigned int others = shares.size() - 1;
+  wakeups.clear();
+  for (unsigned int share = 0; share < shares.size(); share++) wakeups.emplace_back(new Wakeup());
+  for (unsigned int share = 1; share < shares.size(); share++) {
+    workers.emplace_back([this, share, others] {
+      FaultStatus::Scope scope(faultStatus);
+      bool scheduled = false;
+      pthread_t following;
+      while (true) {
+        wakeups[share]->wait();
+        if (!workersRunning.load(std::memory_order_relaxed)) break;
+        if (!scheduled || !pthread_equal(following, runner)) {
+          following = runner;
+          followScheduling(following);
+          scheduled = true;
+        }
+        System::Cycle now(cycleTimeNs.load(std::memory_order_relaxed));
+        runShare(share);
+        if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == others) finished.post();
+      }
+    });
+    if (share <= cpus.size()) {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(cpus[share - 1], &set);
+      if (pthread_setaffinity_np(workers.back().native_handle(), sizeof(set), &set) != 0) {
+        eeros::logger::Logger::getLogger().warn() << "Time domain '" << name << "' cannot pin worker to cpu " << cpus[share - 1];
+      }
+    }
+  }
+}
+
+void TimeDomain::stopWorkers() {
+  workersRunning = false;
+  for (unsigned int share = 1; share <= workers.size(); share++) wakeups[share]->post();
+  for (auto& w : workers) w.join();
+  workers.clear();
 }
 
 // void TimeDomain::sortBlocks() {
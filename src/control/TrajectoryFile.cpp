@@ -0,0 +1,162 @@
+#include <eeros/control/TrajectoryFile.hpp>
+#include <eeros/core/Fault.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+const char magic[8] = {'E', 'E', 'R', 'O', 'S', 'T', 'R', 'J'};
+
+// header of the binary format, followed by the segments, all in host byte order
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t segmentSize;
+  uint64_t count;
+  uint64_t checksum;
+};
+
+// FNV-1a over the 64 bit words of the segments
+uint64_t checksum(const TrajectoryFile::Segment* s, std::size_t count) {
+  const uint64_t* w = reinterpret_cast<const uint64_t*>(s);
+  std::size_t n = count * sizeof(TrajectoryFile::Segment) / sizeof(uint64_t);
+  uint64_t h = 14695981039346656037ull;
+  for (std::size_t i = 0; i < n; i++) {
+    h ^= w[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+// unmaps a file if loading fails, released once the trajectory owns the mapping
+class Mapping {
+ public:
+  Mapping(void* addr, std::size_t size) : addr(addr), size(size) { }
+  ~Mapping() { if (addr != nullptr) ::munmap(addr, size); }
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+  void* get() const { return addr; }
+  void* release() {
+    void* a = addr;
+    addr = nullptr;
+    return a;
+  }
+ private:
+  void* addr;
+  std::size_t size;
+};
+
+}
+
+constexpr uint32_t TrajectoryFile::version;
+
+TrajectoryFile::TrajectoryFile(const std::string& filename) : segments(nullptr), count(0), map(nullptr), mapSize(0) {
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw Fault("File for loading trajectory cannot be opened");
+  char m[sizeof(magic)];
+  bool binary = ::read(fd, m, sizeof(m)) == sizeof(m) && std::memcmp(m, magic, sizeof(magic)) == 0;
+  try {
+    if (binary) loadBinary(fd, filename);
+    else loadText(filename);
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+}
+
+TrajectoryFile::TrajectoryFile(std::vector<Segment> segments) : storage(std::move(segments)), map(nullptr), mapSize(0) {
+  setEnd();
+}
+
+TrajectoryFile::~TrajectoryFile() {
+  if (map != nullptr) ::munmap(map, mapSize);
+}
+
+void TrajectoryFile::loadBinary(int fd, const std::string& filename) {
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header))
+    throw Fault("Trajectory file '" + filename + "' is truncated");
+  std::size_t size = st.st_size;
+  void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+  if (addr == MAP_FAILED) throw Fault("Trajectory file '" + filename + "' cannot be mapped");
+  Mapping mapping(addr, size);
+  const Header* h = static_cast<const Header*>(mapping.get());
+  if (h->version != version || h->segmentSize != sizeof(Segment))
+    throw Fault("Trajectory file '" + filename + "' has an unsupported version");
+  if (h->count > (size - sizeof(Header)) / sizeof(Segment) || size != sizeof(Header) + h->count * sizeof(Segment))
+    throw Fault("Trajectory file '" + filename + "' is truncated");
+  const Segment* s = reinterpret_cast<const Segment*>(h + 1);
+  if (checksum(s, h->count) != h->checksum)
+    throw Fault("Trajectory file '" + filename + "' has a wrong checksum");
+  map = mapping.release();
+  mapSize = size;
+  segments = s;
+  count = h->count;
+}
+
+void TrajectoryFile::loadText(const std::string& filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) throw Fault("File for loading trajectory cannot be opened");
+  std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  const char* p = text.c_str();
+  while (true) {
+    char* e;
+    double v[5] = {0, 0, 0, 0, 0};
+    v[0] = std::strtod(p, &e);
+    if (e == p) break;  // no more segments
+    p = e;
+    for (int i = 1; i < 5; i++) {
+      v[i] = std::strtod(p, &e);
+      p = e;
+    }
+    storage.push_back({v[0], v[1], v[2], v[3], v[4], 0});
+  }
+  setEnd();
+}
+
+void TrajectoryFile::setEnd() {
+  double end = 0;
+  for (auto& s : storage) {
+    end += s.duration;
+    s.end = end;
+  }
+  segments = storage.data();
+  count = storage.size();
+}
+
+void TrajectoryFile::save(const std::string& filename) const {
+  Header h;
+  std::memcpy(h.magic, magic, sizeof(magic));
+  h.version = version;
+  h.segmentSize = sizeof(Segment);
+  h.count = count;
+  h.checksum = checksum(segments, count);
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) throw Fault("File for saving trajectory cannot be opened");
+  file.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  file.write(reinterpret_cast<const char*>(segments), count * sizeof(Segment));
+  if (!file) throw Fault("Trajectory file '" + filename + "' cannot be written");
+}
+
+std::size_t TrajectoryFile::convert(const std::string& textFile, const std::string& binaryFile) {
+  TrajectoryFile t(textFile);
+  t.save(binaryFile);
+  return t.size();
+}
+
+std::size_t TrajectoryFile::find(double time) const {
+  const Segment* s = std::lower_bound(segments, segments + count, time,
+                                      [](const Segment& a, double t) { return a.end < t; });
+  return s - segments;
+}
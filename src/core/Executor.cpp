@@ -12,6 +12,7 @@
 #include <unistd.h>
 
 #include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
 #include <eeros/task/Async.hpp>
 #include <eeros/task/Lambda.hpp>
 #include <eeros/task/HarmonicTaskList.hpp>
@@ -31,15 +32,144 @@ namespace {
 using Logger = logger::Logger;
 
 struct TaskThread {
-  TaskThread(double period, task::Periodic &task, task::HarmonicTaskList tasks) 
-      : taskList(tasks), async(taskList, task.getRealtime(), task.getNice()) {
-    async.counter.setPeriod(period);
-    async.counter.monitors = task.monitors;
+  TaskThread(double period, task::Periodic &task, task::HarmonicTaskList tasks, bool simulated) 
+      : taskList(tasks), name(task.getName()), period(period) {
+    if (simulated) return; // task list is run directly by the executor thread
+    async = std::make_unique<task::Async>(taskList, task.getRealtime(), task.getNice());
+    async->counter.setPeriod(period);
+    async->counter.monitors = task.monitors;
+    task.applyOverrunPolicy(*async);
+  }
+  Runnable &runnable() {
+    if (async) return *async;
+    return taskList;
   }
   task::HarmonicTaskList taskList;
-  task::Async async;
+  std::string name;
+  double period;
+  std::unique_ptr<task::Async> async;
+};
+
+// number of base periods of a periodic
+int harmonicFactor(task::Periodic &task, double basePeriod) {
+  return static_cast<int>(std::lround(task.getPeriod() / basePeriod));
+}
+
+constexpr long maxHyperperiod = 100000;
+
+struct Activation {
+  int k;        // period in base ticks
+  int phase;    // phase offset in base ticks
+  double load;  // run time per activation
 };
 
+long gcd(long a, long b) {
+  while (b != 0) {
+    long t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// number of base ticks after which the activation pattern repeats, 0 if too long
+long hyperperiod(const std::vector<Activation> &activations) {
+  long h = 1;
+  for (auto &a: activations) {
+    h = h / gcd(h, a.k) * a.k;
+    if (h > maxHyperperiod) return 0;
+  }
+  return h;
+}
+
+void addLoad(std::vector<double> &load, const Activation &a) {
+  for (std::size_t t = (a.k - 1 + a.phase) % a.k; t < load.size(); t += a.k) load[t] += a.load;
+}
+
+// summed run time of all activations per base tick over one hyperperiod
+std::vector<double> tickLoad(const std::vector<Activation> &activations) {
+  if (activations.empty()) return {};
+  std::vector<double> load(hyperperiod(activations), 0.0);
+  for (auto &a: activations) addLoad(load, a);
+  return load;
+}
+
+void logTickLoad(Logger &log, const std::string &what, const std::vector<double> &load) {
+  if (load.empty()) return;
+  auto peak = std::max_element(load.begin(), load.end());
+  double mean = 0;
+  for (double l: load) mean += l;
+  mean /= load.size();
+  log.info() << what << " harmonic load per base tick: peak " << *peak << " s at tick " << (peak - load.begin())
+    << ", mean " << mean << " s over " << load.size() << " ticks";
+}
+
+// activations of a list of periodics, periodics without expected run time get the mean of the others
+std::vector<Activation> activationsOf(std::vector<task::Periodic> &tasks, double basePeriod) {
+  double sum = 0;
+  int count = 0;
+  for (auto &t: tasks) {
+    if (t.getExpectedRunTime() > 0) {
+      sum += t.getExpectedRunTime();
+      count++;
+    }
+  }
+  double defaultLoad = (count > 0) ? sum / count : 1.0;
+  std::vector<Activation> activations;
+  for (auto &t: tasks) {
+    double load = (t.getExpectedRunTime() > 0) ? t.getExpectedRunTime() : defaultLoad;
+    activations.push_back({std::max(harmonicFactor(t, basePeriod), 1), t.getPhase(), load});
+  }
+  return activations;
+}
+
+// assigns phases to all periodics of a list which have none, recursively for nested periodics
+void spreadPhases(Logger &log, std::vector<task::Periodic> &tasks, double basePeriod) {
+  if (tasks.empty()) return;
+  std::vector<Activation> activations = activationsOf(tasks, basePeriod);
+  long h = hyperperiod(activations);
+  if (h == 0) {
+    log.warn() << "hyperperiod of harmonic tasks too long, phases are not assigned";
+  } else {
+    // place fixed phases first, then the heaviest and most frequent periodics
+    std::vector<std::size_t> order(tasks.size());
+    for (std::size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&activations] (std::size_t a, std::size_t b) -> bool {
+      const Activation &x = activations[a], &y = activations[b];
+      if ((x.phase >= 0) != (y.phase >= 0)) return x.phase >= 0;
+      if (x.load != y.load) return x.load > y.load;
+      return x.k < y.k;
+    });
+    std::vector<double> load(h, 0.0);
+    for (std::size_t i: order) {
+      Activation &a = activations[i];
+      if (a.phase < 0) {
+        double bestPeak = 0, bestSum = 0;
+        for (int p = 0; p < a.k; p++) {
+          double peak = 0, sum = 0;
+          for (long t = (a.k - 1 + p) % a.k; t < h; t += a.k) {
+            peak = std::max(peak, load[t]);
+            sum += load[t];
+          }
+          if (p == 0 || peak < bestPeak || (peak == bestPeak && sum < bestSum)) {
+            a.phase = p;
+            bestPeak = peak;
+            bestSum = sum;
+          }
+        }
+        tasks[i].setPhase(a.phase);
+        log.trace() << "assigning phase " << a.phase << " to periodic '" << tasks[i].getName() << "'";
+      }
+      a.phase %= a.k;
+      addLoad(load, a);
+    }
+  }
+  for (auto &t: tasks) {
+    spreadPhases(log, t.before, t.getPeriod());
+    spreadPhases(log, t.after, t.getPeriod());
+  }
+}
+
 template < typename F >
 void traverse(std::vector<task::Periodic> &tasks, F func) {
   for (auto &t: tasks) {
@@ -49,26 +179,26 @@ void traverse(std::vector<task::Periodic> &tasks, F func) {
   }
 }
 
-void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, std::vector<task::Harmonic> &output);
+void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, std::vector<task::Harmonic> &output, bool simulated);
 
-void createThreads(Logger &log, std::vector<task::Periodic> &tasks, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, task::HarmonicTaskList &output) {
+void createThreads(Logger &log, std::vector<task::Periodic> &tasks, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, task::HarmonicTaskList &output, bool simulated) {
   for (task::Periodic &t: tasks) {
-    createThread(log, t, baseTask, threads, output.tasks);
+    createThread(log, t, baseTask, threads, output.tasks, simulated);
   }
 }
 
-void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, std::vector<task::Harmonic> &output) {
-  int k = static_cast<int>(task.getPeriod() / baseTask.getPeriod());
+void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, std::vector<task::Harmonic> &output, bool simulated) {
+  int k = harmonicFactor(task, baseTask.getPeriod());
   double actualPeriod = k * baseTask.getPeriod();
   double deviation = std::abs(task.getPeriod() - actualPeriod) / task.getPeriod();
   task::HarmonicTaskList taskList;
 
   if (task.before.size() > 0) {
-    createThreads(log, task.before, task, threads, taskList);
+    createThreads(log, task.before, task, threads, taskList, simulated);
   }
   taskList.add(task.getTask());
   if (task.after.size() > 0) {
-    createThreads(log, task.after, task, threads, taskList);
+    createThreads(log, task.after, task, threads, taskList, simulated);
   }
 
   if (task.getRealtime())
@@ -89,15 +219,17 @@ void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, s
   if (taskList.tasks.size() == 0)
     throw std::runtime_error("no task to execute");
 
-  threads.push_back(std::make_shared<TaskThread>(actualPeriod, task, taskList));
-  output.emplace_back(threads.back()->async, k);
+  int phase = (k > 0) ? std::max(task.getPhase(), 0) % k : 0;
+  threads.push_back(std::make_shared<TaskThread>(actualPeriod, task, taskList, simulated));
+  output.emplace_back(threads.back()->runnable(), k, phase);
 }
 }
 
 Executor::Executor() 
     : period(0), mainTask(nullptr), syncWithEtherCatStackIsSet(false), 
       syncWithRosTimeIsSet(false), syncWithRosTopicIsSet(false), 
-      log(logger::Logger::getLogger('E')) { }
+      simulationIsSet(false), simulationDuration(0), autoPhaseIsSet(false), 
+      watchdog(nullptr), watchdogPeriods(3), log(logger::Logger::getLogger('E')) { }
 
 Executor::~Executor() { }
 
@@ -154,6 +286,21 @@ void Executor::add(control::TimeDomain &td) {
   tasks.push_back(task);
 }
 
+void Executor::useSimulatedTime(double duration) {
+  simulationIsSet = true;
+  simulationDuration = duration;
+  System::useSimulatedTime();
+}
+
+void Executor::useAutoPhase(bool enable) {
+  autoPhaseIsSet = enable;
+}
+
+void Executor::setWatchdog(Watchdog &watchdog, unsigned int periods) {
+  this->watchdog = &watchdog;
+  watchdogPeriods = periods;
+}
+
 void Executor::prefault_stack() {
   unsigned char dummy[8*1024] = {};
     (void)dummy;
@@ -216,6 +363,16 @@ void Executor::assignPriorities() {
   }
 }
 
+void Executor::assignPhases() {
+  std::vector<Activation> unshifted = activationsOf(tasks, period);
+  for (auto &a: unshifted) a.phase = 0;
+  spreadPhases(log, tasks, period);
+  std::vector<Activation> shifted = activationsOf(tasks, period);
+  for (auto &a: shifted) a.phase %= a.k;
+  logTickLoad(log, "expected", tickLoad(shifted));
+  logTickLoad(log, "expected without phase offsets", tickLoad(unshifted));
+}
+
 void Executor::run() {
   log.trace() << "starting executor with base period " << period << " sec and priority " << (int)(basePriority) << " (thread " << getpid() << ":" << syscall(SYS_gettid) << ")";
 
@@ -224,6 +381,18 @@ void Executor::run() {
 
   log.trace() << "assigning priorities";
   assignPriorities();
+  if (autoPhaseIsSet) {
+    log.trace() << "assigning phases";
+    assignPhases();
+  }
+
+  log.trace() << "partitioning parallel time domains";
+  auto partition = [](task::Periodic *t) {
+    auto td = dynamic_cast<control::TimeDomain*>(&t->getTask());
+    if (td != nullptr) td->partition();
+  };
+  if (this->mainTask != nullptr) partition(this->mainTask);
+  traverse(tasks, partition);
 
   Runnable *mainTask = nullptr;
 
@@ -238,24 +407,59 @@ void Executor::run() {
 
   counter.monitors = this->mainTask->monitors;
 
-  createThreads(log, tasks, executorTask, threads, taskList);
+  createThreads(log, tasks, executorTask, threads, taskList, simulationIsSet);
+
+  Watchdog::Heartbeat *heartbeat = nullptr;
+  std::vector<Watchdog::Heartbeat*> heartbeats;
+  if (watchdog != nullptr && !simulationIsSet) {
+    log.trace() << "adding heartbeats to watchdog";
+    heartbeat = &watchdog->add("executor", period, watchdogPeriods);
+    heartbeats.push_back(heartbeat);
+    for (auto &t: threads) {
+      if (!t->async) continue;
+      heartbeats.push_back(&watchdog->add(t->name, t->period, watchdogPeriods));
+      t->async->setHeartbeat(*heartbeats.back());
+    }
+  }
 
   using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
 
-  // TODO: implement this with ready-flag (wait for all threads to be ready instead of blind sleep)
-  std::this_thread::sleep_for(seconds(1)); // wait 1 sec to allow threads to be created
+  bool useDefaultExecutor = true;
+  if (simulationIsSet) {
+    log.trace() << "starting simulated execution";
+    if (syncWithEtherCatStackIsSet) log.error() << "Can't use both simulated time and etherCAT to sync executor";
+    if (syncWithRosTimeIsSet) log.error() << "Can't use both simulated time and RosTime to sync executor";
+    if (syncWithRosTopicIsSet) log.error() << "Can't use both simulated time and RosTopic to sync executor";
+    useDefaultExecutor = false;
 
-  if (!set_priority(0))
-    log.error() << "could not set realtime priority";
+    uint64_t periodNs = static_cast<uint64_t>(std::llround(period * 1.0e9));
+    uint64_t time = System::getTimeNs();
+    uint64_t endTime = time + static_cast<uint64_t>(std::llround(simulationDuration * 1.0e9));
+    while (running && (simulationDuration <= 0 || time < endTime)) {
+      time += periodNs;
+      System::setSimulatedTimeNs(time);
 
-  prefault_stack();
+      counter.tick();
+      taskList.run();
+      if (mainTask != nullptr)
+        mainTask->run();
+      counter.tock();
+    }
+  } else {
+    // TODO: implement this with ready-flag (wait for all threads to be ready instead of blind sleep)
+    std::this_thread::sleep_for(seconds(1)); // wait 1 sec to allow threads to be created
 
-  if (!lock_memory())
-    log.error() << "could not lock memory in RAM";
+    if (!set_priority(0))
+      log.error() << "could not set realtime priority";
+
+    prefault_stack();
+
+    if (!lock_memory())
+      log.error() << "could not lock memory in RAM";
+  }
 
-  bool useDefaultExecutor = true;
 #ifdef USE_ETHERCAT
-  if (etherCATStack) {
+  if (etherCATStack && !simulationIsSet) {
     log.trace() << "starting execution synced to etcherCAT stack";
     if (syncWithRosTimeIsSet)	log.error() << "Can't use both etherCAT and RosTime to sync executor";
     if (syncWithRosTopicIsSet)	log.error() << "Can't use both etherCAT and RosTopic to sync executor";
@@ -268,11 +472,12 @@ void Executor::run() {
       if (mainTask != nullptr)
         mainTask->run();
       counter.tock();
+      if (heartbeat != nullptr) heartbeat->kick();
     }
   }
 #endif
 #ifdef USE_ROS
-  if (syncWithRosTimeIsSet) {
+  if (syncWithRosTimeIsSet && !simulationIsSet) {
     log.trace() << "starting execution synced to rosTime";
     if (syncWithEtherCatStackIsSet)	log.error() << "Can't use both RosTime and etherCAT to sync executor";
     if (syncWithRosTopicIsSet)		log.error() << "Can't use both RosTime and RosTopic to sync executor";
@@ -290,11 +495,12 @@ void Executor::run() {
       if (mainTask != nullptr)
         mainTask->run();
       counter.tock();
+      if (heartbeat != nullptr) heartbeat->kick();
       next_cycle += periodNsec;
     }
     
   }
-  else if (syncWithRosTopicIsSet) {
+  else if (syncWithRosTopicIsSet && !simulationIsSet) {
     log.trace() << "starting execution synced to gazebo";
     if (syncWithRosTimeIsSet)		log.error() << "Can't use both RosTopic and RosTime to sync executor";
     if (syncWithEtherCatStackIsSet)	log.error() << "Can't use both RosTopic and etherCAT to sync executor";
@@ -329,6 +535,7 @@ void Executor::run() {
       if (mainTask != nullptr)
         mainTask->run();
       counter.tock();
+      if (heartbeat != nullptr) heartbeat->kick();
     }
     
   }
@@ -344,19 +551,40 @@ void Executor::run() {
       if (mainTask != nullptr)
         mainTask->run();
       counter.tock();
+      if (heartbeat != nullptr) heartbeat->kick();
       next_cycle += seconds(period);
     }
   }
 
+  // the tasks stop being kicked now, logging and joining must not be reported as a hang
+  for (auto hb: heartbeats) hb->disarm();
+
+  if (autoPhaseIsSet) {
+    // observed load of the harmonic tasks of the executor from the measured run times
+    std::vector<Activation> observed;
+    for (auto &h: taskList.tasks) {
+      for (auto &t: threads) {
+        if (&t->runnable() != h.getTask() || !t->async) continue;
+        double mean = t->async->counter.run.mean;
+        log.info() << "periodic '" << t->name << "': phase " << h.getPhase() << ", mean run time " << mean << " s";
+        observed.push_back({h.getN(), h.getPhase(), mean});
+      }
+    }
+    logTickLoad(log, "observed", tickLoad(observed));
+  }
+
   log.trace() << "stopping all threads";
 
   for (auto &t: threads)
-    t->async.stop();
+    if (t->async) t->async->stop();
 
   log.trace() << "joining all threads";
 
   for (auto &t: threads)
-    t->async.join();
+    if (t->async) t->async->join();
+
+  // a periodic may have kicked its heartbeat once more before it stopped
+  for (auto hb: heartbeats) hb->disarm();
 
   log.trace() << "exiting executor " << " (thread " << getpid() << ":" << syscall(SYS_gettid) << ")";
 }
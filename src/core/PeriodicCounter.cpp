@@ -1,13 +1,27 @@
 #include <eeros/core/PeriodicCounter.hpp>
 #include <eeros/logger/Pretty.hpp>
 #include <eeros/logger/StreamLogWriter.hpp>
+#include <eeros/core/System.hpp>
 using namespace eeros;
 
+namespace {
+
+// With a simulated clock the periods are measured in simulated time, 
+// the run time is always measured in real time.
+std::chrono::steady_clock::time_point periodTime(std::chrono::steady_clock::time_point now) {
+  if (System::isSimulatedTime())
+    return std::chrono::steady_clock::time_point(std::chrono::nanoseconds(System::getTimeNs()));
+  return now;
+}
+
+}
+
 PeriodicCounter::PeriodicCounter(double period, unsigned logger_category) :
   reset_after(20), log(logger::Logger::getLogger('P')) {
     
   setPeriod(period);
-  start = clk::now();
+  runStart = clk::now();
+  start = periodTime(runStart);
   first = true;
 }
 
@@ -26,12 +40,13 @@ void PeriodicCounter::addDefaultMonitor(double tolerance) {
 
 void PeriodicCounter::tick() {
   last = start;
-  start = clk::now();
+  runStart = clk::now();
+  start = periodTime(runStart);
 }
 
 void PeriodicCounter::tock() {
   time_point stop = clk::now();
-  double new_run = std::chrono::duration<double>(stop - start).count();
+  double new_run = std::chrono::duration<double>(stop - runStart).count();
   run.add(new_run);
   
   if (first) {
@@ -52,6 +67,7 @@ void PeriodicCounter::reset() {
   period.reset();
   jitter.reset();
   run.reset();
+  latency.reset();
   reset_counter = (int)(reset_after / counter_period);
 }
 
@@ -73,6 +89,11 @@ void PeriodicCounter:: operator >> (eeros::logger::LogEntry &event) {
   event << "run   \t";
   l(event, run) << endl;
 
+  if (latency.count > 0) {
+    event << "wake  \t";
+    l(event, latency) << endl;
+  }
+
   event << "count = " << period.count;
 }
 
@@ -1,6 +1,7 @@
 #include <eeros/core/System.hpp>
 #include <eeros/core/Fault.hpp>
 #include <time.h>
+#include <atomic>
 
 #define NS_PER_SEC 1000000000
 #define CLOCK CLOCK_MONOTONIC_RAW
@@ -12,6 +13,13 @@
 
 using namespace eeros;
 
+namespace {
+	std::atomic<bool> simulatedTimeIsUsed(false);
+	std::atomic<uint64_t> simulatedTimeNs(0);
+	thread_local bool cycleActive = false;
+	thread_local uint64_t cycleTimeNs = 0;
+}
+
 uint64_t timespec2nsec(struct timespec ts) {
 	return static_cast<uint64_t>(ts.tv_sec) * NS_PER_SEC + static_cast<uint64_t>(ts.tv_nsec);
 }
@@ -38,7 +46,24 @@ void System::useRosTime() {
 }
 #endif
 
+void System::useSimulatedTime(uint64_t startNs) {
+	simulatedTimeNs = startNs;
+	simulatedTimeIsUsed = true;
+}
+
+void System::setSimulatedTimeNs(uint64_t timeNs) {
+	simulatedTimeNs.store(timeNs, std::memory_order_release);
+}
+
+bool System::isSimulatedTime() {
+	return simulatedTimeIsUsed.load(std::memory_order_relaxed);
+}
+
 uint64_t System::getTimeNs() {
+	if (simulatedTimeIsUsed.load(std::memory_order_relaxed)) {
+		return simulatedTimeNs.load(std::memory_order_acquire);
+	}
+	
 #ifdef USE_ROS
 	if (rosTimeIsUsed) {
 		auto time = ros::Time::now();
@@ -54,3 +79,28 @@ uint64_t System::getTimeNs() {
 }
 
 
+
+uint64_t System::getCycleTimeNs() {
+	if (cycleActive) return cycleTimeNs;
+	return getTimeNs();
+}
+
+double System::getCycleTime() {
+	return static_cast<double>(System::getCycleTimeNs()) / NS_PER_SEC;
+}
+
+System::Cycle::Cycle() : Cycle(System::getTimeNs()) { }
+
+System::Cycle::Cycle(uint64_t timeNs) : timeNs(timeNs), previousTimeNs(cycleTimeNs), previousActive(cycleActive) {
+	cycleTimeNs = timeNs;
+	cycleActive = true;
+}
+
+System::Cycle::~Cycle() {
+	cycleTimeNs = previousTimeNs;
+	cycleActive = previousActive;
+}
+
+uint64_t System::Cycle::getTimeNs() const {
+	return timeNs;
+}
@@ -0,0 +1,53 @@
+#include <eeros/core/Wakeup.hpp>
+#include <chrono>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace eeros;
+
+namespace {
+
+constexpr uint32_t idle = 0;
+constexpr uint32_t posted = 1;
+constexpr uint32_t sleeping = 2;
+
+void futexWait(std::atomic<uint32_t>* addr, uint32_t expected) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t>* addr) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+
+}
+
+Wakeup::Wakeup() : state(idle), postTime(0) { }
+
+bool Wakeup::post() {
+  uint32_t s = state.load(std::memory_order_relaxed);
+  if (s == posted) return false;
+  postTime.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+  s = state.exchange(posted, std::memory_order_release);
+  if (s == sleeping) futexWake(&state);
+  return s != posted;
+}
+
+void Wakeup::wait() {
+  uint32_t s = state.load(std::memory_order_acquire);
+  while (true) {
+    if (s == posted) {
+      if (state.compare_exchange_weak(s, idle, std::memory_order_acquire)) return;
+      continue;
+    }
+    if (s == idle && !state.compare_exchange_weak(s, sleeping, std::memory_order_acquire)) continue;
+    futexWait(&state, sleeping);
+    s = state.load(std::memory_order_acquire);
+  }
+}
+
+int64_t Wakeup::getPostTimeNs() const {
+  return postTime.load(std::memory_order_relaxed);
+}
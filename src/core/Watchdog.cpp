@@ -0,0 +1,191 @@
+#include <eeros/core/Watchdog.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/safety/SafetySystem.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <limits>
+#include <poll.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+using namespace eeros;
+
+namespace {
+
+// steady clock, the same as CLOCK_MONOTONIC of the timer
+int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+Watchdog::Heartbeat::Heartbeat(const std::string& name, int64_t timeoutNs)
+    : name(name), timeoutNs(timeoutNs), lastKick(0), misses(0), missing(false), missedKick(0) { }
+
+void Watchdog::Heartbeat::kick() {
+  lastKick.store(nowNs(), std::memory_order_release);
+}
+
+void Watchdog::Heartbeat::disarm() {
+  lastKick.store(0, std::memory_order_release);
+}
+
+const std::string& Watchdog::Heartbeat::getName() const {
+  return name;
+}
+
+double Watchdog::Heartbeat::getTimeout() const {
+  return timeoutNs / 1.0e9;
+}
+
+uint64_t Watchdog::Heartbeat::getMissCount() const {
+  return misses;
+}
+
+bool Watchdog::Heartbeat::isMissing() const {
+  return missing;
+}
+
+Watchdog::Watchdog(int priority)
+    : safetySystem(nullptr), event(nullptr), exitHandler(false), misses(0), finished(false),
+      log(logger::Logger::getLogger('W')) {
+  timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  if (timerFd < 0) throw Fault("Watchdog: could not create timer");
+  wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wakeFd < 0) {
+    close(timerFd);
+    throw Fault("Watchdog: could not create event descriptor");
+  }
+  thread = std::thread([this, priority]() { run(priority); });
+}
+
+Watchdog::~Watchdog() {
+  finished = true;
+  uint64_t one = 1;
+  if (write(wakeFd, &one, sizeof(one)) < 0) log.error() << "Watchdog: could not stop thread";
+  if (thread.joinable()) thread.join();
+  close(wakeFd);
+  close(timerFd);
+  if (latency.count > 0)
+    log.info() << "Watchdog: " << misses << " misses, detection latency mean " << latency.mean
+               << " s, max " << latency.max << " s";
+}
+
+Watchdog::Heartbeat& Watchdog::add(const std::string& name, double period, unsigned int periods) {
+  if (!(period > 0) || periods < 1) throw Fault("Watchdog: heartbeat '" + name + "' needs a period and at least one period until it misses");
+  Heartbeat* hb;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    heartbeats.emplace_back(name, static_cast<int64_t>(std::llround(period * periods * 1.0e9)));
+    hb = &heartbeats.back();
+  }
+  uint64_t one = 1;
+  if (write(wakeFd, &one, sizeof(one)) < 0) log.error() << "Watchdog: could not wake thread";
+  return *hb;
+}
+
+void Watchdog::setSafetyEvent(safety::SafetySystem& ss, safety::SafetyEvent& event) {
+  std::lock_guard<std::mutex> lock(mutex);
+  safetySystem = &ss;
+  this->event = &event;
+  exitHandler = false;
+}
+
+void Watchdog::useExitHandler() {
+  std::lock_guard<std::mutex> lock(mutex);
+  exitHandler = true;
+  safetySystem = nullptr;
+  event = nullptr;
+}
+
+Statistics Watchdog::getDetectionLatency() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return latency;
+}
+
+uint64_t Watchdog::getMissCount() const {
+  return misses;
+}
+
+void Watchdog::run(int priority) {
+  if (priority != 20) {
+    struct sched_param schedulingParam;
+    schedulingParam.sched_priority = (priority == 0) ? sched_get_priority_max(SCHED_FIFO) : priority;
+    if (sched_setscheduler(0, SCHED_FIFO, &schedulingParam) != 0) log.error() << "could not set realtime priority";
+  }
+  struct pollfd fds[2];
+  fds[0].fd = timerFd;
+  fds[0].events = POLLIN;
+  fds[1].fd = wakeFd;
+  fds[1].events = POLLIN;
+  while (!finished) {
+    int64_t deadline;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      deadline = check(nowNs());
+    }
+    struct itimerspec t = { };
+    if (deadline != std::numeric_limits<int64_t>::max()) {
+      t.it_value.tv_sec = deadline / 1000000000;
+      t.it_value.tv_nsec = deadline % 1000000000;
+    }
+    timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &t, nullptr);
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) continue;
+      log.error() << "Watchdog: poll failed, errno " << errno;
+      return;
+    }
+    uint64_t count;
+    if (fds[0].revents & POLLIN) (void)!read(timerFd, &count, sizeof(count));
+    if (fds[1].revents & POLLIN) (void)!read(wakeFd, &count, sizeof(count));
+  }
+}
+
+// checks all heartbeats and returns the time of the next check
+int64_t Watchdog::check(int64_t now) {
+  int64_t next = std::numeric_limits<int64_t>::max();
+  for (auto& hb : heartbeats) {
+    int64_t kick = hb.lastKick.load(std::memory_order_acquire);
+    if (kick == 0) {
+      // not armed yet, poll for the first kick
+      next = std::min(next, now + hb.timeoutNs);
+      continue;
+    }
+    if (hb.missing) {
+      if (kick != hb.missedKick) {
+        hb.missing = false;
+        log.warn() << "Watchdog: heartbeat '" << hb.name << "' recovered after " << (kick - hb.missedKick) / 1.0e9 << " s";
+      } else {
+        next = std::min(next, now + hb.timeoutNs);
+        continue;
+      }
+    }
+    int64_t deadline = kick + hb.timeoutNs;
+    if (now >= deadline) {
+      missed(hb, now, deadline);
+      hb.missedKick = kick;
+      next = std::min(next, now + hb.timeoutNs);
+    } else {
+      next = std::min(next, deadline);
+    }
+  }
+  return next;
+}
+
+void Watchdog::missed(Heartbeat& hb, int64_t now, int64_t deadline) {
+  hb.missing = true;
+  hb.misses++;
+  misses++;
+  double l = (now - deadline) / 1.0e9;
+  latency.add(l);
+  for (auto& a : actions) a();
+  if (safetySystem != nullptr) safetySystem->triggerEvent(*event);
+  if (exitHandler) safety::SafetySystem::exitHandler();
+  log.error() << "Watchdog: heartbeat '" << hb.name << "' missed, not kicked for " << (now - deadline + hb.timeoutNs) / 1.0e9
+              << " s, detected " << l << " s after the deadline";
+}
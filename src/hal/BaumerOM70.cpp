@@ -5,6 +5,7 @@ using namespace eeros::hal;
 BaumerOM70::BaumerOM70 (std::string dev, int port, int slaveId, int priority) 
     : Thread (priority), starting(true), running(false), log(Logger::getLogger()) {
   id = slaveId;
+  distance.fill(0);
   ctx = modbus_new_tcp ( dev.c_str(), port ); // Create new tcp connection
   modbus_set_slave ( ctx, slaveId ); // Set slave
   log.info() << "Baumer OM70, Modbus new TCP connection " << dev.c_str() << ", slaveId " << slaveId;
@@ -27,13 +28,14 @@ BaumerOM70::~BaumerOM70() {
 }
 
 void BaumerOM70::getMeasurements() {
-  modbus_read_input_registers (ctx, 200, 17, tabReg);
+  if (modbus_read_input_registers (ctx, 200, 17, tabReg) == -1) return;
+  uint64_t timestamp = System::getTimeNs();
 
   // Distance [mm]
   uint32_t* ptr_i = (uint32_t*) &tabReg[3];
   float* ptr_f = reinterpret_cast<float*> (ptr_i);
 
-  distance = (*ptr_f) * 0.001; // from [mm] to [m]
+  distance.publish((*ptr_f) * 0.001, timestamp); // from [mm] to [m]
 
   // Measurement rate [Hz]
 //   uint32_t* ptr_i_rate = (uint32_t*) &tabReg[5];
@@ -75,7 +77,7 @@ void BaumerOM70::switchOffLaser() {
 }
 
 float BaumerOM70::getDistance() {
-  return distance;
+  return distance.get().value;
 }
 
 void BaumerOM70::run() {
@@ -78,6 +78,23 @@ bool HAL::addInput(InputInterface* systemInput) {
 	}
 	throw Fault("System input is null");
 }
+InputInterface* HAL::replaceInput(InputInterface* systemInput) {
+	if(systemInput == nullptr) throw Fault("System input is null");
+	InputInterface*& entry = inputs[systemInput->getId()];
+	InputInterface* replaced = entry;
+	entry = systemInput;
+	return replaced;
+}
+
+void HAL::removeInput(InputInterface* systemInput) {
+	auto it = inputs.find(systemInput->getId());
+	if(it != inputs.end() && it->second == systemInput) inputs.erase(it);
+	exclusiveReservedInputs.erase(systemInput);
+	nonExclusiveInputs.erase(systemInput);
+	std::lock_guard<std::mutex> lock(featureMutex);
+	features.erase(systemInput);
+}
+
 bool HAL::addOutput(OutputInterface* systemOutput) {
 	if(systemOutput != nullptr) {
 		if( outputs.find(systemOutput->getId()) != outputs.end() ){
@@ -89,6 +106,15 @@ bool HAL::addOutput(OutputInterface* systemOutput) {
 	throw Fault("System output is null");
 }
 
+void HAL::removeOutput(OutputInterface* systemOutput) {
+	auto it = outputs.find(systemOutput->getId());
+	if(it != outputs.end() && it->second == systemOutput) outputs.erase(it);
+	exclusiveReservedOutputs.erase(systemOutput);
+	nonExclusiveOutputs.erase(systemOutput);
+	std::lock_guard<std::mutex> lock(featureMutex);
+	features.erase(systemOutput);
+}
+
 void HAL::releaseInput(std::string name) {
 	bool found = false;
 	auto inIt = nonExclusiveInputs.find(inputs[name]);
@@ -227,20 +253,30 @@ ScalableInput<double>* HAL::getScalableInput(std::string name, bool exclusive) {
 	return in;
 }
 
-void * HAL::getOutputFeature(std::string name, std::string featureName){
+void * HAL::getOutputFeature(const std::string& name, const std::string& featureName){
 	auto outObj = outputs[name];
 	return getOutputFeature(outObj, featureName);
 }
 
-void* HAL::getOutputFeature(OutputInterface * obj, std::string featureName){
-	return dlsym(obj->getLibHandle(), featureName.c_str());
+void* HAL::getOutputFeature(OutputInterface * obj, const std::string& featureName){
+	return getFeature(obj, obj->getLibHandle(), featureName);
 }
 
-void * HAL::getInputFeature(std::string name, std::string featureName){
+void * HAL::getInputFeature(const std::string& name, const std::string& featureName){
 	auto inObj = inputs[name];
 	return getInputFeature(inObj, featureName);
 }
 
-void* HAL::getInputFeature(InputInterface * obj, std::string featureName){
-	return dlsym(obj->getLibHandle(), featureName.c_str());
+void* HAL::getInputFeature(InputInterface * obj, const std::string& featureName){
+	return getFeature(obj, obj->getLibHandle(), featureName);
+}
+
+void* HAL::getFeature(void* obj, void* libHandle, const std::string& featureName){
+	std::lock_guard<std::mutex> lock(featureMutex);
+	auto& objFeatures = features[obj];
+	auto it = objFeatures.find(featureName);
+	if(it != objFeatures.end()) return it->second;
+	void* featureFunction = dlsym(libHandle, featureName.c_str());
+	if(featureFunction != nullptr) objFeatures.emplace(featureName, featureFunction);
+	return featureFunction;
 }
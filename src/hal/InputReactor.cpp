@@ -0,0 +1,94 @@
+#include <eeros/hal/InputReactor.hpp>
+#include <eeros/core/Fault.hpp>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sched.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+
+using namespace eeros;
+using namespace eeros::hal;
+
+std::shared_ptr<InputReactor> InputReactor::instance(int priority) {
+  static std::mutex m;
+  static std::weak_ptr<InputReactor> reactor;
+  std::lock_guard<std::mutex> lock(m);
+  std::shared_ptr<InputReactor> r = reactor.lock();
+  if (!r) {
+    r.reset(new InputReactor(priority));
+    reactor = r;
+  }
+  return r;
+}
+
+InputReactor::InputReactor(int priority) : log(logger::Logger::getLogger('I')) {
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  if (epollFd < 0) throw Fault("InputReactor: could not create epoll instance");
+  stopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (stopFd < 0) {
+    close(epollFd);
+    throw Fault("InputReactor: could not create event descriptor");
+  }
+  struct epoll_event e = { };
+  e.events = EPOLLIN;
+  e.data.fd = stopFd;
+  epoll_ctl(epollFd, EPOLL_CTL_ADD, stopFd, &e);
+  thread = std::thread([this, priority]() { run(priority); });
+}
+
+InputReactor::~InputReactor() {
+  uint64_t one = 1;
+  if (write(stopFd, &one, sizeof(one)) < 0) log.error() << "InputReactor: could not stop thread";
+  if (thread.joinable()) thread.join();
+  close(stopFd);
+  close(epollFd);
+}
+
+void InputReactor::add(int fd, Device* device) {
+  std::lock_guard<std::mutex> lock(mutex);
+  struct epoll_event e = { };
+  e.events = EPOLLIN;
+  e.data.fd = fd;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &e) < 0) throw Fault("InputReactor: could not add device");
+  devices[fd] = device;
+}
+
+void InputReactor::remove(int fd) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (devices.erase(fd) > 0) epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+std::size_t InputReactor::getDevices() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return devices.size();
+}
+
+void InputReactor::run(int priority) {
+  if (priority != 20) {
+    struct sched_param schedulingParam;
+    schedulingParam.sched_priority = priority;
+    if (sched_setscheduler(0, SCHED_FIFO, &schedulingParam) != 0) log.error() << "could not set realtime priority";
+  }
+  struct epoll_event events[16];
+  while (true) {
+    int n = epoll_wait(epollFd, events, 16, -1);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      log.error() << "InputReactor: epoll failed, errno " << errno;
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < n; i++) {
+      int fd = events[i].data.fd;
+      if (fd == stopFd) return;
+      auto it = devices.find(fd);
+      if (it == devices.end()) continue;  // removed while waiting
+      if (!it->second->drain()) {
+        log.warn() << "InputReactor: device on descriptor " << fd << " removed";
+        devices.erase(it);
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+      }
+    }
+  }
+}
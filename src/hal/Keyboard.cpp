@@ -2,33 +2,39 @@
 #include <eeros/hal/KeyList.hpp>
 #include <unistd.h>
 #include <fcntl.h>
+#include <cerrno>
 
 using namespace eeros::hal;
 
-Keyboard::Keyboard(int priority) : Thread(priority) {
+Keyboard::Keyboard(int priority) {
   tcgetattr(STDIN_FILENO, &tio);
   tio.c_lflag &=(~ICANON & ~ECHO);
   tcsetattr(STDIN_FILENO, TCSANOW, &tio);
+  reactor = InputReactor::instance(priority);
+  reactor->add(STDIN_FILENO, this);
 }
 
 Keyboard::~Keyboard() {     
-  running = false; 
-  join(); 
+  reactor->remove(STDIN_FILENO);
   tio.c_lflag |=(ICANON | ECHO);
   tcsetattr(STDIN_FILENO, TCSANOW, &tio);
 }
 
-void Keyboard::run() {
-  running = true;
+bool Keyboard::drain() {
+  // the standard input is shared with the application and stays blocking, 
+  // it is read once per wake up, which returns all characters typed so far
+  char c[64];
+  ssize_t n = read(STDIN_FILENO, c, sizeof(c));
+  if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+  if (n == 0) return false;
   auto& list = KeyList::instance();
-  while (running) {
-    char c = std::cin.get();
+  for (ssize_t j = 0; j < n; j++) {
     for (uint8_t i = 0; i < list.nofKeys; i++) {
-      if (c == list.asciiCode[i]) {
+      if (c[j] == list.asciiCode[i]) {
         list.state[i] = true;
         list.event[i] = true;
       }
     }
-    usleep(10000);
   }
+  return true;
 }
@@ -4,12 +4,14 @@
 #include <eeros/core/Fault.hpp>
 
 #include <cstdio>
+#include <cerrno>
 #include <fcntl.h>
 #include <unistd.h>
 
+using namespace eeros;
 using namespace eeros::hal;
 
-Mouse::Mouse(std::string dev, int priority) : Thread(priority) {
+Mouse::Mouse(std::string dev, int priority) : buttons(0), log(logger::Logger::getLogger('T')) {
   open(dev.c_str());
   left = new MouseDigIn("leftMouseButton", this);
   middle = new MouseDigIn("middleMouseButton", this);
@@ -28,13 +30,16 @@ Mouse::Mouse(std::string dev, int priority) : Thread(priority) {
   current.axis.z = 0;
   current.axis.r = 0;
 
-  last = current;
+  states.fill(current);
+  if (fd >= 0) {
+    reactor = InputReactor::instance(priority);
+    reactor->add(fd, this);
+  }
 }
 
 Mouse::~Mouse() {
-  running = false; 
-  join(); 
-  close(); 
+  if (reactor) reactor->remove(fd);
+  close();
 }
 
 bool Mouse::open(const char* device) {
@@ -44,7 +49,7 @@ bool Mouse::open(const char* device) {
 }
 
 void Mouse::close() {
-        ::close(fd);
+  if (fd >= 0) ::close(fd);
 }
 
 std::string Mouse::name() {
@@ -68,14 +73,23 @@ void Mouse::on_axis(std::function<void(int, signed)> action) {
         axis_action = action;
 }
 
+bool Mouse::getButton(int code) {
+  switch (code) {
+    case BTN_LEFT: return buttons.load(std::memory_order_relaxed) & 1;
+    case BTN_MIDDLE: return buttons.load(std::memory_order_relaxed) & 2;
+    case BTN_RIGHT: return buttons.load(std::memory_order_relaxed) & 4;
+    default: return false;
+  }
+}
 
-void Mouse::run() {
-  running = true;
-  if (fd < 0) return;
-  struct input_event e;
-  while (running) {
-    ssize_t n = read(fd, &e, sizeof(struct input_event));
-    if (n > 0) {
+bool Mouse::drain() {
+  struct input_event events[64];
+  while (true) {
+    ssize_t n = read(fd, events, sizeof(events));
+    if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+    if (n == 0) return false;
+    for (size_t i = 0; i < n / sizeof(struct input_event); i++) {
+      struct input_event& e = events[i];
       if (e.type == EV_KEY) {
         switch (e.code) {
           case BTN_LEFT: current.button.left = e.value; break;
@@ -83,6 +97,7 @@ void Mouse::run() {
           case BTN_RIGHT: current.button.right = e.value; break;
           default: break;
         }
+        buttons.store(current.button.left | current.button.middle << 1 | current.button.right << 2, std::memory_order_relaxed);
 
         if (button_action != nullptr) button_action(e.code, e.value);
       } else if (e.type == EV_REL) {
@@ -95,11 +110,11 @@ void Mouse::run() {
         }
 
         if (axis_action != nullptr) axis_action(e.code, e.value);
+      } else if (e.type == EV_SYN) {  // all events of a report have been read
+        states.publish(current, System::getTimeNs());
       }
 
       if (event_action != nullptr) event_action(e);
-
-      last = current;
-    } else usleep(1000);
+    }
   }
 }
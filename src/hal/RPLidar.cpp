@@ -5,6 +5,11 @@ using namespace eeros::hal;
 RPLidar::RPLidar(std::string dev, int priority) 
     : Thread(priority), starting(true), running(false), log(Logger::getLogger('P')) {
   bufSize = LASER_COUNT_MAX;
+  Scan empty;
+  empty.angles.fill(std::numeric_limits<double>::infinity());
+  empty.ranges.fill(std::numeric_limits<double>::infinity());
+  empty.intensities.fill(std::numeric_limits<double>::infinity());
+  scans.fill(empty);
   ld = RPlidarDriver::CreateDriver(CHANNEL_TYPE_SERIALPORT);
   if (!ld){
     log.error() << "RPLidar Create driver instance: insufficent memory, exit";
@@ -64,15 +69,15 @@ float RPLidar::getScanFrequency(){
 }
 
 Vector<LASER_COUNT_MAX,double> RPLidar::getAngles() {
-  return angles;
+  return scans.get().value.angles;
 }
 
 Vector<LASER_COUNT_MAX,double> RPLidar::getRanges() {
-  return ranges;
+  return scans.get().value.ranges;
 }
 
 Vector<LASER_COUNT_MAX,double> RPLidar::getIntensities() {
-  return intensities;
+  return scans.get().value.intensities;
 }
 
 void RPLidar::run() {
@@ -84,8 +89,13 @@ void RPLidar::run() {
     size_t count = (int)(sizeof(nodes) / sizeof(nodes[0]));
     // fetch extactly one 0-360 degrees' scan
     ans = ld->grabScanDataHq(nodes, count);
+    uint64_t timestamp = System::getTimeNs();
     bufSize = count; 
     if (IS_OK(ans)){  
+      Scan& scan = scans.back();
+      Vector<LASER_COUNT_MAX,double>& angles = scan.angles;
+      Vector<LASER_COUNT_MAX,double>& ranges = scan.ranges;
+      Vector<LASER_COUNT_MAX,double>& intensities = scan.intensities;
       ld->ascendScanData(nodes, count);
       // Set angles
 //      int start_node = 0, end_node = 0;
@@ -116,6 +126,7 @@ void RPLidar::run() {
         intensities[pos] = std::numeric_limits<float>::infinity();
         angles[pos] = std::numeric_limits<float>::infinity();
       }
+      scans.publish(timestamp);
     } else if(ans == RESULT_OPERATION_TIMEOUT){
       log.error() << "RPLidar Laser Timeout! error code: " << ans;
     } else {
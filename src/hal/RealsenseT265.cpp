@@ -5,6 +5,14 @@ using namespace eeros::hal;
 
 RealsenseT265::RealsenseT265(std::string dev, int priority) 
     : Thread(priority), starting(true), running (false), log(Logger::getLogger('P')) {
+  Pose zero;
+  zero.translation.zero();
+  zero.velocity.zero();
+  zero.acceleration.zero();
+  zero.angVelocity.zero();
+  zero.angAcceleration.zero();
+  zero.quaternion << 1, 0, 0, 0;
+  poses.fill(zero);
   cfg.enable_stream(RS2_STREAM_POSE, RS2_FORMAT_6DOF);  // Add pose stream
   pipe.start(cfg);                                      // Start pipeline with chosen configuration
   starting = false;
@@ -21,18 +29,21 @@ void RealsenseT265::run(){
   while (running) {
     // Wait for the next set of frames from the camera
     auto frames = pipe.wait_for_frames();
+    uint64_t timestamp = System::getTimeNs();
     // Get a frame from the pose stream
     auto f = frames.first_or_default(RS2_STREAM_POSE);
     // Cast the frame to pose_frame and get its data
     auto pose_data = f.as<rs2::pose_frame>().get_pose_data();
     
     // outputs for eeros
-    translation     << pose_data.translation.x, pose_data.translation.y, pose_data.translation.z;
-    velocity        << pose_data.velocity.x, pose_data.velocity.y, pose_data.velocity.z;
-    acceleration    << pose_data.acceleration.x, pose_data.acceleration.y, pose_data.acceleration.z;
-    quaternion      << pose_data.rotation.w, pose_data.rotation.x, pose_data.rotation.y, pose_data.rotation.z;
-    angVelocity     << pose_data.angular_velocity.x, pose_data.angular_velocity.y, pose_data.angular_velocity.z;
-    angAcceleration << pose_data.angular_acceleration.x, pose_data.angular_acceleration.y, pose_data.angular_acceleration.z;
+    Pose& p = poses.back();
+    p.translation     << pose_data.translation.x, pose_data.translation.y, pose_data.translation.z;
+    p.velocity        << pose_data.velocity.x, pose_data.velocity.y, pose_data.velocity.z;
+    p.acceleration    << pose_data.acceleration.x, pose_data.acceleration.y, pose_data.acceleration.z;
+    p.quaternion      << pose_data.rotation.w, pose_data.rotation.x, pose_data.rotation.y, pose_data.rotation.z;
+    p.angVelocity     << pose_data.angular_velocity.x, pose_data.angular_velocity.y, pose_data.angular_velocity.z;
+    p.angAcceleration << pose_data.angular_acceleration.x, pose_data.angular_acceleration.y, pose_data.angular_acceleration.z;
+    poses.publish(timestamp);
     
     // Calculate current transformation matrix
     float r[16];
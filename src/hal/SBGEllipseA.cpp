@@ -2,9 +2,52 @@
 
 using namespace eeros::hal;
 
-Vector3 SBGEllipseA::eulerData, SBGEllipseA::accData, SBGEllipseA::gyroData;
-Vector4 SBGEllipseA::quatData;
-uint32_t SBGEllipseA::timestampEuler, SBGEllipseA::timestampQuat, SBGEllipseA::timestampAcc, SBGEllipseA::timestampGyro;
-uint32_t SBGEllipseA::count, SBGEllipseA::count0, SBGEllipseA::countEuler, SBGEllipseA::countQuat, SBGEllipseA::countImu;
-
+SbgErrorCode SBGEllipseA::onLogReceived(SbgEComHandle *pHandle, SbgEComClass msgClass, SbgEComMsgId msg, const SbgBinaryLogData *pLogData, void *pUserArg) {
+  SBGEllipseA* self = static_cast<SBGEllipseA*>(pUserArg);
+  ImuData& d = self->current;
+  self->count++;
+  switch (msg) {
+    case SBG_ECOM_LOG_EKF_EULER:    
+      d.euler << pLogData->ekfEulerData.euler[0],   
+                 pLogData->ekfEulerData.euler[1],    
+                 pLogData->ekfEulerData.euler[2];
+      d.timestampEuler = pLogData->ekfEulerData.timeStamp;
+      self->countEuler++;
+      break;
+    case SBG_ECOM_LOG_EKF_QUAT: 
+      d.quat << pLogData->ekfQuatData.quaternion[0],   
+                pLogData->ekfQuatData.quaternion[1],    
+                pLogData->ekfQuatData.quaternion[2],    
+                pLogData->ekfQuatData.quaternion[3];
+      d.timestampQuat = pLogData->ekfQuatData.timeStamp;
+      self->countQuat++;
+      break;
+    case SBG_ECOM_LOG_IMU_DATA: 
+      d.acc << pLogData->imuData.accelerometers[0],   
+               pLogData->imuData.accelerometers[1],    
+               pLogData->imuData.accelerometers[2];
+      d.timestampAcc = pLogData->imuData.timeStamp;
+      d.gyro << pLogData->imuData.gyroscopes[0],   
+                pLogData->imuData.gyroscopes[1],    
+                pLogData->imuData.gyroscopes[2];
+      d.timestampGyro = pLogData->imuData.timeStamp;
+      self->countImu++;
+      break;
+    case SBG_ECOM_LOG_FAST_IMU_DATA: // sbgEComBinaryLogImu.h
+      d.acc << pLogData->fastImuData.accelerometers[0],   
+               pLogData->fastImuData.accelerometers[1],    
+               pLogData->fastImuData.accelerometers[2];
+      d.timestampAcc = pLogData->fastImuData.timeStamp;
+      d.gyro << pLogData->fastImuData.gyroscopes[0],   
+                pLogData->fastImuData.gyroscopes[1],    
+                pLogData->fastImuData.gyroscopes[2];
+      d.timestampGyro = pLogData->fastImuData.timeStamp;
+      break;
+    default:
+      self->count0++;
+      return SBG_NO_ERROR;
+  }
+  self->samples.publish(d, System::getTimeNs());
+  return SBG_NO_ERROR;
+}
 
@@ -1,9 +1,16 @@
 #include <eeros/hal/SysFsDigIn.hpp>
 #include <eeros/core/Fault.hpp>
+#include <fstream>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
 
 using namespace eeros::hal;
 
-SysFsDigIn::SysFsDigIn(std::string id, void* libHandle, unsigned int gpio, bool inverted) : Input<bool>(id, libHandle), basePath("/sys/class/gpio/gpio" + std::to_string(gpio) + "/") {
+SysFsDigIn::SysFsDigIn(std::string id, void* libHandle, unsigned int gpio, bool inverted, SysFsEdge edge) 
+	: Input<bool>(id, libHandle), inverted(inverted), edge(edge), basePath("/sys/class/gpio/gpio" + std::to_string(gpio) + "/"), 
+	  valueFd(-1), stopFd(-1), level(false), seenByRead(false), edgeLatched(false), edgeCount(0) {
 	std::ofstream exportFile;
 	std::ofstream directionFile;
 	
@@ -15,28 +22,134 @@ SysFsDigIn::SysFsDigIn(std::string id, void* libHandle, unsigned int gpio, bool
 	exportFile << gpio;
 	exportFile.close();
 	
-	// Set GPIO direction to output
+	// Set GPIO direction to input
 	directionFile.open(basePath + "direction");
 	if(!directionFile.is_open()) {
-		throw Fault("Failed to set direction to output for GPIO" +  std::to_string(gpio) + "!");
+		throw Fault("Failed to set direction to input for GPIO" +  std::to_string(gpio) + "!");
 	}
 	directionFile << "in";
 	directionFile.close();
 	
+	open();
+}
+
+SysFsDigIn::SysFsDigIn(std::string id, void* libHandle, std::string basePath, bool inverted, SysFsEdge edge) 
+	: Input<bool>(id, libHandle), inverted(inverted), edge(edge), basePath(basePath), 
+	  valueFd(-1), stopFd(-1), level(false), seenByRead(false), edgeLatched(false), edgeCount(0) {
+	if(!this->basePath.empty() && this->basePath.back() != '/') this->basePath += '/';
+	open();
+}
+
+SysFsDigIn::~SysFsDigIn(){
+	if(edgeThread.joinable()) {
+		uint64_t stop = 1;
+		if(write(stopFd, &stop, sizeof(stop)) < 0) { }
+		edgeThread.join();
+	}
+	if(stopFd >= 0) close(stopFd);
+	if(valueFd >= 0) close(valueFd);
+}
+
+// the destructor is not run if a constructor throws, the files are closed here on failure
+void SysFsDigIn::open() {
 	// Open value file
-	valueFile.open(basePath + "value");
-	if(!valueFile.is_open()) {
-		throw Fault("Failed to open value file for GPIO" +  std::to_string(gpio) + "!");
+	valueFd = ::open((basePath + "value").c_str(), O_RDONLY);
+	if(valueFd < 0) {
+		throw Fault("Failed to open value file " + basePath + "value!");
+	}
+	try {
+		bool initial;
+		if(read(initial)) level = initial;
+		if(edge == SysFsEdge::none) return;
+		
+		// Configure edge, the kernel signals it with POLLPRI on the value file
+		std::ofstream edgeFile(basePath + "edge");
+		if(!edgeFile.is_open()) {
+			throw Fault("Failed to set edge for " + basePath + "!");
+		}
+		switch(edge) {
+			case SysFsEdge::rising: edgeFile << "rising"; break;
+			case SysFsEdge::falling: edgeFile << "falling"; break;
+			default: edgeFile << "both"; break;
+		}
+		edgeFile.close();
+		
+		stopFd = eventfd(0, EFD_CLOEXEC);
+		if(stopFd < 0) {
+			throw Fault("Failed to create event for " + basePath + "!");
+		}
+		edgeThread = std::thread(&SysFsDigIn::watchEdges, this);
+	}
+	catch(...) {
+		if(stopFd >= 0) close(stopFd);
+		close(valueFd);
+		stopFd = -1;
+		valueFd = -1;
+		throw;
 	}
 }
 
-SysFsDigIn::~SysFsDigIn(){
-	valueFile.close();
+bool SysFsDigIn::read(bool& value) {
+	char buf[2];
+	if(pread(valueFd, buf, sizeof(buf), 0) < 1) return false;
+	value = (buf[0] == '1');
+	return true;
 }
+
+void SysFsDigIn::latch() {
+	edgeCount.fetch_add(1, std::memory_order_relaxed);
+	edgeLatched.store(true, std::memory_order_release);
+}
+
+void SysFsDigIn::watchEdges() {
+	char buf[2];
+	// a read is necessary to arm the notification
+	if(pread(valueFd, buf, sizeof(buf), 0) < 0) return;
+	bool rising = (edge != SysFsEdge::falling);
+	bool falling = (edge != SysFsEdge::rising);
+	struct pollfd fds[2];
+	fds[0].fd = valueFd;
+	fds[0].events = POLLPRI | POLLERR;
+	fds[1].fd = stopFd;
+	fds[1].events = POLLIN;
+	while(true) {
+		fds[0].revents = 0;
+		fds[1].revents = 0;
+		if(poll(fds, 2, -1) < 0) continue;
+		if(fds[1].revents & POLLIN) break;
+		if(fds[0].revents & POLLPRI) {
+			bool value;
+			if(!read(value)) break;
+			bool previous = level.exchange(value);
+			bool seen = seenByRead.exchange(false);
+			if(value != previous) {
+				if(value ? rising : falling) latch();
+			}
+			else if(!seen) {
+				// a pulse which is over already, it contains the chosen edge if it ends at the level before the edge
+				if(value ? falling : rising) latch();
+			}
+		}
+	}
+}
+
 bool SysFsDigIn::get() {
-	int value;
-	if(!valueFile.is_open()) return false;
-	valueFile >> value;
-	if(inverted) value = !value;
-	return static_cast<bool>(value);
+	bool value;
+	if(!read(value)) return false;
+	if(edge != SysFsEdge::none) {
+		bool previous = level.exchange(value);
+		if(value != previous && (edge == SysFsEdge::both || (edge == SysFsEdge::rising) == value)) {
+			seenByRead.store(true);
+			latch();
+		}
+	}
+	return value != inverted;
+}
+
+bool SysFsDigIn::fetchEdge() {
+	return edgeLatched.exchange(false, std::memory_order_acq_rel);
+}
+
+uint32_t SysFsDigIn::getEdgeCount() const {
+	return edgeCount.load(std::memory_order_relaxed);
 }
@@ -3,14 +3,16 @@
 #include <eeros/hal/XBoxDigIn.hpp>
 
 #include <cstdio>
+#include <cerrno>
 #include <fcntl.h>
 #include <unistd.h>
 
+using namespace eeros;
 using namespace eeros::hal;
 
 const double XBoxState::axis_max = 0x7fff;
 
-XBox::XBox(std::string dev, int priority) : Thread(priority) {
+XBox::XBox(std::string dev, int priority) : buttons(0), log(logger::Logger::getLogger('T')) {
 	open(dev.c_str());
 	button[0] = new XBoxDigIn("XBoxButtonA", this);
 	button[1] = new XBoxDigIn("XBoxButtonB", this);
@@ -35,22 +37,26 @@ XBox::XBox(std::string dev, int priority) : Thread(priority) {
 		current.button_up[i] = false;
 		current.button_down[i] = false;
 	}
+	states.fill(current);
+	if (fd >= 0) {
+		reactor = InputReactor::instance(priority);
+		reactor->add(fd, this);
+	}
 }
 
 
 XBox::~XBox() {
-	running = false; 
-	join(); 
+	if (reactor) reactor->remove(fd);
 	close(); 
 }
 
 bool XBox::open(const char* device) {
-	fd = ::open(device, O_RDONLY);
+	fd = ::open(device, O_RDONLY | O_NONBLOCK);
 	if (fd < 0) log.error() << "XBox: could not open input device on " + std::string(device);
 	return fd;
 }
 
-void XBox::close() { ::close(fd); }
+void XBox::close() { if (fd >= 0) ::close(fd); }
 
 std::string XBox::name() {
 	if (!fd) return "";
@@ -75,44 +81,50 @@ void XBox::on_axis(std::function<void(int, double)> action) {
 }
 
 
-void XBox::run() {
-	running = true;
-	if (fd < 0) return;
-	struct js_event e;
-	while (running) 	{
-		if (read(fd, &e, sizeof(struct js_event)));
-		
-		switch (e.type) {
-			case (JS_EVENT_BUTTON | JS_EVENT_INIT):
-			case JS_EVENT_BUTTON:
-				if (e.number < XBOX_BUTTON_COUNT) {
-					current.button_state[e.number] = e.value;
-					current.button_up[e.number] = (!current.button_state[e.number] & last.button_state[e.number]);
-					current.button_down[e.number] = (current.button_state[e.number] & !last.button_state[e.number]);
+bool XBox::drain() {
+	struct js_event events[64];
+	while (true) {
+		ssize_t n = read(fd, events, sizeof(events));
+		if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+		if (n == 0) return false;
+		for (size_t i = 0; i < n / sizeof(struct js_event); i++) {
+			struct js_event& e = events[i];
+			switch (e.type) {
+				case (JS_EVENT_BUTTON | JS_EVENT_INIT):
+				case JS_EVENT_BUTTON:
+					if (e.number < XBOX_BUTTON_COUNT) {
+						current.button_state[e.number] = e.value;
+						current.button_up[e.number] = (!current.button_state[e.number] & last.button_state[e.number]);
+						current.button_down[e.number] = (current.button_state[e.number] & !last.button_state[e.number]);
+						uint8_t b = buttons.load(std::memory_order_relaxed) & ~(1 << e.number);
+						buttons.store(b | (current.button_state[e.number] << e.number), std::memory_order_relaxed);
+						
+						if (e.type != (JS_EVENT_BUTTON | JS_EVENT_INIT))
+							if (button_action != nullptr)
+								button_action(e.number, e.value);
+					}
+					break;
 					
-					if (e.type != (JS_EVENT_BUTTON | JS_EVENT_INIT))
-						if (button_action != nullptr)
-							button_action(e.number, e.value);
-				}
-				break;
-				
-			case (JS_EVENT_AXIS | JS_EVENT_INIT):
-			case JS_EVENT_AXIS:
-				if (e.number < XBOX_AXIS_COUNT) {
-					current.axis[e.number] = (e.value / XBoxState::axis_max);
+				case (JS_EVENT_AXIS | JS_EVENT_INIT):
+				case JS_EVENT_AXIS:
+					if (e.number < XBOX_AXIS_COUNT) {
+						current.axis[e.number] = (e.value / XBoxState::axis_max);
+						
+						if (e.type != (JS_EVENT_AXIS | JS_EVENT_INIT))
+							if (axis_action != nullptr)
+								axis_action(e.number, current.axis[e.number]);
+					}
+					break;
 					
-					if (e.type != (JS_EVENT_AXIS | JS_EVENT_INIT))
-						if (axis_action != nullptr)
-							axis_action(e.number, current.axis[e.number]);
-				}
-				break;
-				
-			default:
-				break;
-		}
-		
-		if (event_action != nullptr) event_action(e);
+				default:
+					break;
+			}
+			
+			if (event_action != nullptr) event_action(e);
 
-		last = current;
+			last = current;
+		}
+		// the joystick interface has no end of report, publish once per batch
+		states.publish(current, System::getTimeNs());
 	}
 }
@@ -0,0 +1,160 @@
+#include <eeros/hal/sim/Channels.hpp>
+#include <eeros/core/System.hpp>
+#include <map>
+
+using namespace eeros;
+using namespace eeros::hal;
+using namespace eeros::hal::sim;
+
+namespace {
+
+std::mutex outputsMtx;
+std::map<std::string, SimOutput*> outputs;
+std::atomic<uint64_t> outputsGeneration(0);
+
+}
+
+constexpr unsigned int SimOutput::historySize;
+constexpr uint64_t SimInput::lookUp;
+
+SimOutput::SimOutput(const std::string& id) : id(id), started(1), written(1), historyNs(0) {
+  history[0].time.store(0, std::memory_order_relaxed);
+  history[0].value.store(0.0, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(outputsMtx);
+  outputs[id] = this;
+  outputsGeneration.fetch_add(1, std::memory_order_release);
+}
+
+SimOutput::~SimOutput() {
+  std::lock_guard<std::mutex> lock(outputsMtx);
+  auto it = outputs.find(id);
+  if (it != outputs.end() && it->second == this) outputs.erase(it);
+  outputsGeneration.fetch_add(1, std::memory_order_release);
+}
+
+SimOutput* SimOutput::find(const std::string& id) {
+  std::lock_guard<std::mutex> lock(outputsMtx);
+  auto it = outputs.find(id);
+  if (it == outputs.end()) return nullptr;
+  return it->second;
+}
+
+uint64_t SimOutput::getGeneration() {
+  return outputsGeneration.load(std::memory_order_acquire);
+}
+
+void SimOutput::keepHistory(uint64_t delayNs) {
+  uint64_t kept = historyNs.load(std::memory_order_relaxed);
+  while (delayNs > kept && !historyNs.compare_exchange_weak(kept, delayNs, std::memory_order_relaxed));
+}
+
+void SimOutput::write(double value) {
+  uint64_t now = System::getTimeNs();
+  uint64_t n = written.load(std::memory_order_relaxed);
+  Sample& last = history[(n - 1) % historySize];
+  if (last.time.load(std::memory_order_relaxed) == now) {
+    last.value.store(value, std::memory_order_relaxed);
+    return;
+  }
+  // a reader seeing started move past its sample reads again
+  started.store(n + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  Sample& s = history[n % historySize];
+  s.time.store(now, std::memory_order_relaxed);
+  s.value.store(value, std::memory_order_relaxed);
+  written.store(n + 1, std::memory_order_release);
+}
+
+double SimOutput::valueAt(uint64_t timeNs) {
+  while (true) {
+    uint64_t n = written.load(std::memory_order_acquire);
+    uint64_t oldest = n > historySize ? n - historySize : 0;
+    uint64_t i = n;
+    while (i > oldest + 1 && history[(i - 1) % historySize].time.load(std::memory_order_relaxed) > timeNs) i--;
+    double value = history[(i - 1) % historySize].value.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // the sample is valid if the writer has not started to overwrite it
+    if (started.load(std::memory_order_relaxed) <= i - 1 + historySize) return value;
+  }
+}
+
+SimInput::SimInput(const std::string& config) : generator(config), source(nullptr), generation(lookUp), fault(false) { }
+
+SimInput::~SimInput() { }
+
+void SimInput::setGenerator(const std::string& config) {
+  Generator g(config);
+  std::lock_guard<std::mutex> lock(mtx);
+  pending.back() = g;
+  pending.publish();
+}
+
+bool SimInput::hasFault() const {
+  return fault;
+}
+
+double SimInput::read() {
+  uint64_t now = System::getTimeNs();
+  if (pending.update()) {
+    std::swap(generator, pending.front());
+    source = nullptr;
+    generation = lookUp;
+    fault = false;
+  }
+  if (generator.getKind() != Generator::Kind::loopback) return generator.get(now);
+  uint64_t g = SimOutput::getGeneration();
+  if (g != generation) {
+    // the output may be created after the input, it is looked up again whenever outputs come and go
+    generation = g;
+    source = SimOutput::find(generator.getSource());
+    if (source != nullptr) source->keepHistory(generator.getDelayNs());
+    fault = (source == nullptr);
+  }
+  if (source == nullptr) return 0.0;
+  uint64_t delay = generator.getDelayNs();
+  return source->valueAt(now > delay ? now - delay : 0);
+}
+
+SimDigIn::SimDigIn(std::string id, void* libHandle, bool inverted, std::string config) 
+    : Input<bool>(id, libHandle), SimInput(config), inverted(inverted) { }
+
+bool SimDigIn::get() {
+  bool value = read() > 0.5;
+  return value != inverted;
+}
+
+SimDigOut::SimDigOut(std::string id, void* libHandle, bool inverted) 
+    : Output<bool>(id, libHandle), SimOutput(id), inverted(inverted), value(false) { }
+
+bool SimDigOut::get() {
+  return value;
+}
+
+void SimDigOut::set(bool value) {
+  this->value = value;
+  write((value != inverted) ? 1.0 : 0.0);
+}
+
+SimAnalogIn::SimAnalogIn(std::string id, void* libHandle, double scale, double offset, double rangeMin, double rangeMax, std::string unit, std::string config) 
+    : ScalableInput<double>(id, libHandle, scale, offset, rangeMin, rangeMax, unit), SimInput(config) { }
+
+double SimAnalogIn::get() {
+  double value = (read() - offset) / scale;
+  if (value > maxIn) value = maxIn;
+  if (value < minIn) value = minIn;
+  return value;
+}
+
+SimAnalogOut::SimAnalogOut(std::string id, void* libHandle, double scale, double offset, double rangeMin, double rangeMax, std::string unit) 
+    : ScalableOutput<double>(id, libHandle, scale, offset, rangeMin, rangeMax, unit), SimOutput(id), value(0) { }
+
+double SimAnalogOut::get() {
+  return value;
+}
+
+void SimAnalogOut::set(double value) {
+  if (value > maxOut) value = maxOut;
+  if (value < minOut) value = minOut;
+  this->value = value;
+  write(value * scale + offset);
+}
@@ -0,0 +1,115 @@
+#include <eeros/hal/sim/Generator.hpp>
+#include <eeros/core/Fault.hpp>
+#include <algorithm>
+#include <fstream>
+#include <cmath>
+
+using namespace eeros;
+using namespace eeros::hal::sim;
+
+Generator::Generator(const std::string& config) : kind(Kind::constant), delayNs(0), fileIndex(0) {
+  std::string kindName = "constant";
+  std::string token;
+  auto addToken = [&]() {
+    if (token.empty()) return;
+    auto pos = token.find('=');
+    if (pos == std::string::npos) kindName = token;
+    else params.emplace_back(token.substr(0, pos), token.substr(pos + 1));
+    token.clear();
+  };
+  for (char c : config) {
+    if (c == ' ' || c == '\t' || c == ';' || c == ',') addToken();
+    else token += c;
+  }
+  addToken();
+
+  value = param("value", 0.0);
+  amplitude = param("amplitude", 1.0);
+  frequency = param("frequency", 1.0);
+  phase = param("phase", 0.0);
+  offset = param("offset", 0.0);
+  duty = param("duty", 0.5);
+  mean = param("mean", 0.0);
+  stddev = param("stddev", 1.0);
+  rng.seed(static_cast<uint64_t>(param("seed", 1)));
+  normal = std::normal_distribution<double>(mean, stddev);
+
+  if (kindName == "constant") kind = Kind::constant;
+  else if (kindName == "sine") kind = Kind::sine;
+  else if (kindName == "square") kind = Kind::square;
+  else if (kindName == "noise") kind = Kind::noise;
+  else if (kindName == "file") {
+    kind = Kind::file;
+    std::string path;
+    for (auto& p : params) if (p.first == "path") path = p.second;
+    loadFile(path);
+  }
+  else if (kindName == "loopback") {
+    kind = Kind::loopback;
+    for (auto& p : params) if (p.first == "source") source = p.second;
+    if (source.empty()) throw Fault("loopback generator without source");
+    delayNs = static_cast<uint64_t>(std::llround(param("delay", 0.0) * 1e9));
+  }
+  else throw Fault("unknown generator '" + kindName + "'");
+}
+
+double Generator::param(const std::string& key, double defaultValue) const {
+  for (auto& p : params) {
+    if (p.first == key) {
+      try {
+        return std::stod(p.second);
+      } catch (std::exception const&) {
+        throw Fault("invalid generator parameter '" + key + "=" + p.second + "'");
+      }
+    }
+  }
+  return defaultValue;
+}
+
+void Generator::loadFile(const std::string& path) {
+  std::ifstream file(path);
+  if (!file.is_open()) throw Fault("could not open generator file '" + path + "'");
+  double t, v;
+  while (file >> t >> v) {
+    fileTimes.push_back(static_cast<uint64_t>(std::llround(t * 1e9)));
+    fileValues.push_back(v);
+  }
+  if (fileTimes.empty()) throw Fault("generator file '" + path + "' is empty");
+}
+
+double Generator::get(uint64_t timeNs) {
+  double t = timeNs * 1e-9;
+  switch (kind) {
+    case Kind::sine:
+      return offset + amplitude * std::sin(2 * M_PI * frequency * t + phase);
+    case Kind::square: {
+      double cycle = frequency * t + phase / (2 * M_PI);
+      return offset + ((cycle - std::floor(cycle)) < duty ? amplitude : 0.0);
+    }
+    case Kind::noise:
+      return normal(rng);
+    case Kind::file: {
+      // replay runs forward, seeking back is only needed after a time jump
+      if (timeNs < fileTimes[fileIndex]) {
+        fileIndex = std::upper_bound(fileTimes.begin(), fileTimes.end(), timeNs) - fileTimes.begin();
+        if (fileIndex > 0) fileIndex--;
+      }
+      while (fileIndex + 1 < fileTimes.size() && fileTimes[fileIndex + 1] <= timeNs) fileIndex++;
+      return fileValues[fileIndex];
+    }
+    default:
+      return value;
+  }
+}
+
+Generator::Kind Generator::getKind() const {
+  return kind;
+}
+
+const std::string& Generator::getSource() const {
+  return source;
+}
+
+uint64_t Generator::getDelayNs() const {
+  return delayNs;
+}
@@ -0,0 +1,54 @@
+#include <eeros/hal/sim/Channels.hpp>
+#include <eeros/core/Fault.hpp>
+
+using namespace eeros;
+using namespace eeros::hal;
+using namespace eeros::hal::sim;
+
+/*
+ * Entry points of the simulated hardware library. They are resolved by the
+ * JsonParser with "create" + channel type, the features with HAL::feature().
+ * The generator of an input is configured with "additionalArguments".
+ */
+
+extern "C" {
+
+Input<bool>* createDigIn(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, bool inverted, std::string additionalArguments) {
+  return new SimDigIn(id, libHandle, inverted, additionalArguments);
+}
+
+Output<bool>* createDigOut(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, bool inverted, std::string additionalArguments) {
+  return new SimDigOut(id, libHandle, inverted);
+}
+
+Output<bool>* createWatchdog(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, bool inverted, std::string additionalArguments) {
+  return new SimDigOut(id, libHandle, inverted);
+}
+
+ScalableInput<double>* createAnalogIn(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, double scale, double offset, double rangeMin, double rangeMax, std::string unit, std::string additionalArguments) {
+  return new SimAnalogIn(id, libHandle, scale, offset, rangeMin, rangeMax, unit, additionalArguments);
+}
+
+ScalableInput<double>* createFqd(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, double scale, double offset, double rangeMin, double rangeMax, std::string unit, std::string additionalArguments) {
+  return new SimAnalogIn(id, libHandle, scale, offset, rangeMin, rangeMax, unit, additionalArguments);
+}
+
+ScalableOutput<double>* createAnalogOut(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, double scale, double offset, double rangeMin, double rangeMax, std::string unit, std::string additionalArguments) {
+  return new SimAnalogOut(id, libHandle, scale, offset, rangeMin, rangeMax, unit);
+}
+
+ScalableOutput<double>* createPwm(std::string id, void* libHandle, std::string device, uint32_t subDeviceNumber, uint32_t channel, double scale, double offset, double rangeMin, double rangeMax, std::string unit, std::string additionalArguments) {
+  return new SimAnalogOut(id, libHandle, scale, offset, rangeMin, rangeMax, unit);
+}
+
+void simSetGenerator(InputInterface* obj, std::string config) {
+  SimInput* in = dynamic_cast<SimInput*>(obj);
+  if (in == nullptr) throw Fault("'" + obj->getId() + "' is not a simulated input");
+  in->setGenerator(config);
+}
+
+void simSetValue(InputInterface* obj, double value) {
+  simSetGenerator(obj, "constant value=" + std::to_string(value));
+}
+
+}
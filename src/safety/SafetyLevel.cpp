@@ -78,10 +78,20 @@ namespace eeros {
 
 		void SafetyLevel::setInputAction(InputAction* action) {
 			inputAction.push_back(action);
+			compileInputActions();
 		}
 
 		void SafetyLevel::setInputActions(std::vector<InputAction*> actionList) {
 			inputAction = actionList;
+			compileInputActions();
+		}
+
+		void SafetyLevel::compileInputActions() {
+			inputCheck.clear();
+			inputCheck.reserve(inputAction.size());
+			for(auto ia : inputAction) {
+				if(ia != nullptr) inputCheck.push_back(ia->compile());
+			}
 		}
 
 		void SafetyLevel::setOutputAction(OutputAction* action) {
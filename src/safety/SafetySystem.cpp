@@ -88,18 +88,16 @@ namespace eeros {
 				level->nofActivations++;
 				
 				// 2) Read inputs
-				for(auto ia : level->inputAction) {
-					if(ia != nullptr) {
-						SafetyLevel* oldLevel = currentLevel;
-						if(ia->check(&privateContext)) {
-							SafetyLevel* newLevel = nextLevel;
-							using namespace logger;
-							hal::InputInterface* input = (hal::InputInterface*)(ia->getInput());
-							if(oldLevel != newLevel) {
-								log.info()	<< "level changed due to input action: " << input->getId()
-											<< " from level '" << oldLevel << "'"
-											<< " to level '" << newLevel << "'";
-							}
+				for(const auto& ic : level->inputCheck) {
+					SafetyLevel* oldLevel = currentLevel;
+					if(ic(&privateContext)) {
+						SafetyLevel* newLevel = nextLevel;
+						using namespace logger;
+						hal::InputInterface* input = ic.action->getInput();
+						if(oldLevel != newLevel) {
+							log.info()	<< "level changed due to input action: " << input->getId()
+										<< " from level '" << oldLevel << "'"
+										<< " to level '" << newLevel << "'";
 						}
 					}
 				}
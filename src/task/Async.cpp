@@ -5,17 +5,21 @@
 
 #include <eeros/task/Async.hpp>
 #include <eeros/core/Executor.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/safety/SafetySystem.hpp>
 
 using namespace eeros::task;
 using namespace eeros::logger;
 
 Async::Async(Runnable &task, bool realtime , int nice) 
-    : task(task), realtime(realtime), nice(nice), thread(&Async::run_thread, this), 
-      finished(false), log(Logger::getLogger('A')) { }
+    : task(task), realtime(realtime), nice(nice), policy(OverrunPolicy::coalesce),
+      safetySystem(nullptr), overrunEvent(nullptr), heartbeat(nullptr), busy(false), queued(0), overruns(0), skipped(0),
+      overrunning(false), finished(false), log(Logger::getLogger('A')), thread(&Async::run_thread, this) { }
 
 Async::Async(Runnable *task, bool realtime , int nice) 
-    : task(*task), realtime(realtime), nice(nice), thread(&Async::run_thread, this), 
-      finished(false), log(Logger::getLogger('A')) { }
+    : task(*task), realtime(realtime), nice(nice), policy(OverrunPolicy::coalesce),
+      safetySystem(nullptr), overrunEvent(nullptr), heartbeat(nullptr), busy(false), queued(0), overruns(0), skipped(0),
+      overrunning(false), finished(false), log(Logger::getLogger('A')), thread(&Async::run_thread, this) { }
 
 Async::~Async() {
   stop();
@@ -23,18 +27,54 @@ Async::~Async() {
 }
 
 void Async::run() {
-  semaphore.post();
+  bool running = busy.load(std::memory_order_acquire);
+  bool accepted = wakeup.post();
+  if (accepted && !running) {
+    overrunning = false;
+    return;
+  }
+  // the previous activation is still running or was not even started yet
+  overruns++;
+  if (!accepted) {
+    if (policy == OverrunPolicy::queue) queued++;
+    else skipped++;
+  }
+  if (policy == OverrunPolicy::safetyEvent && !overrunning) safetySystem->triggerEvent(*overrunEvent);
+  overrunning = true;
 }
 
 void Async::stop() {
   finished = true;
-  semaphore.post();
+  wakeup.post();
 }
 
 void Async::join() {
   if (thread.joinable()) thread.join();
 }
 
+void Async::setOverrunPolicy(OverrunPolicy policy) {
+  if (policy == OverrunPolicy::safetyEvent) throw Fault("overrun policy safetyEvent needs a safety system and an event");
+  this->policy = policy;
+}
+
+void Async::setOverrunPolicy(safety::SafetySystem &ss, safety::SafetyEvent &event) {
+  safetySystem = &ss;
+  overrunEvent = &event;
+  policy = OverrunPolicy::safetyEvent;
+}
+
+uint64_t Async::getOverrunCount() const {
+  return overruns;
+}
+
+uint64_t Async::getSkippedCount() const {
+  return skipped;
+}
+
+void Async::setHeartbeat(Watchdog::Heartbeat &heartbeat) {
+  this->heartbeat = &heartbeat;
+}
+
 void Async::run_thread() {
   const auto pid = getpid();
   const auto tid = syscall(SYS_gettid);
@@ -55,13 +95,27 @@ void Async::run_thread() {
     log.trace() << "starting thread " << pid << ":" << tid;
   }
 
-  semaphore.wait();
+  wakeup.wait();
   while (!finished) {
+    busy.store(true, std::memory_order_release);
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
     counter.tick();
+    counter.latency.add((now - wakeup.getPostTimeNs()) / 1.0e9);
     task.run();
     counter.tock();
-    semaphore.wait();
+    if (heartbeat != nullptr) heartbeat->kick();
+    while (queued > 0 && !finished) {
+      queued--;
+      counter.tick();
+      task.run();
+      counter.tock();
+      if (heartbeat != nullptr) heartbeat->kick();
+    }
+    busy.store(false, std::memory_order_release);
+    wakeup.wait();
   }
 
+  if (overruns > 0) log.warn() << overruns << " overruns, " << skipped << " activations skipped";
   log.trace() << "stopping thread " << pid << ":" << tid;
 }
@@ -3,16 +3,25 @@
 using namespace eeros::task;
 
 
-Harmonic::Harmonic(Runnable &task, int n) :
-	n(n), k(0), task(&task) { }
+// the task runs on every call c (counted from 1) with c % n == phase % n
+Harmonic::Harmonic(Runnable &task, int n, int phase) :
+	n(n), k(n > 0 ? (n - phase % n) % n : 0), phase(phase), task(&task) { }
 
-Harmonic::Harmonic(Runnable *task, int n) :
-	n(n), k(0), task(task) { }
+Harmonic::Harmonic(Runnable *task, int n, int phase) :
+	n(n), k(n > 0 ? (n - phase % n) % n : 0), phase(phase), task(task) { }
 
 eeros::Runnable * Harmonic::getTask() {
 	return task;
 }
 
+int Harmonic::getN() {
+	return n;
+}
+
+int Harmonic::getPhase() {
+	return phase;
+}
+
 void Harmonic::run() {
 	if (++k >= n) {
 		task->run();
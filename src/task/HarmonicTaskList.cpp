@@ -8,10 +8,10 @@ void HarmonicTaskList::run() {
 		t.run();
 }
 
-void HarmonicTaskList::add(Runnable *t, int n) {
-	tasks.push_back(Harmonic(t, n));
+void HarmonicTaskList::add(Runnable *t, int n, int phase) {
+	tasks.push_back(Harmonic(t, n, phase));
 }
 
-void HarmonicTaskList::add(Runnable &t, int n) {
-	tasks.push_back(Harmonic(t, n));
+void HarmonicTaskList::add(Runnable &t, int n, int phase) {
+	tasks.push_back(Harmonic(t, n, phase));
 }
@@ -0,0 +1,100 @@
+#include <eeros/config/FileConfig.hpp>
+#include <eeros/config/TableFile.hpp>
+#include <eeros/core/Fault.hpp>
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::config;
+
+namespace {
+	class TableConfig : public FileConfig {
+	public:
+		TableConfig(const char *name) : FileConfig(name) {
+			add("gain", gain);
+			add("linearization", table);
+		}
+		double gain = 1.0;
+		std::shared_ptr<TableFile> table;
+	};
+
+	std::vector<double> ramp(std::size_t n) {
+		std::vector<double> v(n);
+		for (std::size_t i = 0; i < n; i++) v[i] = 0.5 * i;
+		return v;
+	}
+}
+
+TEST(configTableFile, memory) {
+	TableFile t({3, 4}, {0, -1}, {1, 1}, ramp(12));
+	EXPECT_FALSE(t.isMapped());
+	EXPECT_EQ(t.getDims(), 2u);
+	EXPECT_EQ(t.getSize(0), 3u);
+	EXPECT_EQ(t.getSize(1), 4u);
+	EXPECT_EQ(t.getMin(1), -1);
+	EXPECT_EQ(t.getMax(1), 1);
+	EXPECT_EQ(t.count(), 12u);
+	EXPECT_EQ(t.data()[11], 5.5);
+	EXPECT_TRUE(t.getFilename().empty());
+}
+
+TEST(configTableFile, invalid) {
+	EXPECT_THROW(TableFile({3, 4}, {0, 0}, {1, 1}, ramp(11)), Fault);
+	EXPECT_THROW(TableFile({1}, {0}, {1}, ramp(1)), Fault);
+	EXPECT_THROW(TableFile({2}, {1}, {0}, ramp(2)), Fault);
+	EXPECT_THROW(TableFile({2, 2, 2, 2}, {0, 0, 0, 0}, {1, 1, 1, 1}, ramp(16)), Fault);
+}
+
+TEST(configTableFile, saveAndMap) {
+	TableFile t({2, 3, 4}, {0, 0, 0}, {1, 2, 3}, ramp(24));
+	t.save("table.bin");
+	EXPECT_EQ(t.getFilename(), "table.bin");
+	TableFile m("table.bin");
+	EXPECT_TRUE(m.isMapped());
+	EXPECT_EQ(m.getDims(), 3u);
+	EXPECT_EQ(m.getSize(2), 4u);
+	EXPECT_EQ(m.getMax(2), 3);
+	ASSERT_EQ(m.count(), 24u);
+	for (std::size_t i = 0; i < 24; i++) EXPECT_EQ(m.data()[i], t.data()[i]);
+	std::remove("table.bin");
+}
+
+TEST(configTableFile, corrupt) {
+	TableFile t({5}, {0}, {1}, ramp(5));
+	t.save("table.bin");
+	{
+		std::fstream f("table.bin", std::ios::in | std::ios::out | std::ios::binary);
+		f.seekp(-8, std::ios::end);
+		double v = 99;
+		f.write(reinterpret_cast<char*>(&v), sizeof(v));
+	}
+	EXPECT_THROW(TableFile("table.bin"), Fault);
+	{
+		std::ofstream f("table.bin", std::ios::binary | std::ios::trunc);
+		f << "this is not a table file, but some text which is long enough for a header";
+	}
+	EXPECT_THROW(TableFile("table.bin"), Fault);
+	std::remove("table.bin");
+	EXPECT_THROW(TableFile("table.bin"), Fault);
+}
+
+TEST(configTableFile, config) {
+	TableFile t({4}, {0}, {3}, ramp(4));
+	t.save("table.bin");
+	TableConfig config("tableConfig.txt");
+	config.table = std::make_shared<TableFile>("table.bin");
+	config.gain = 2.0;
+	config.save();
+	TableConfig loaded("tableConfig.txt");
+	EXPECT_FALSE(loaded.table);
+	loaded.load();
+	EXPECT_EQ(loaded.gain, 2.0);
+	ASSERT_TRUE(loaded.table);
+	EXPECT_TRUE(loaded.table->isMapped());
+	EXPECT_EQ(loaded.table->data()[3], 1.5);
+	std::remove("table.bin");
+	std::remove("tableConfig.txt");
+}
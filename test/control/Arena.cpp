@@ -0,0 +1,114 @@
+#include <eeros/control/Arena.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/Sum.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+class controlArenaTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::cout.setstate(std::ios_base::badbit);
+    logger::Logger::setDefaultStreamLogger(std::cout);
+  }
+  void TearDown() override {
+    std::cout.clear();
+  }
+};
+
+// block recording the order of destruction
+class Tracked : public Blockio<0,0> {
+ public:
+  Tracked(std::vector<int>& destroyed, int id) : destroyed(destroyed), id(id) { }
+  ~Tracked() { destroyed.push_back(id); }
+  std::vector<int>& destroyed;
+  int id;
+};
+
+class Throwing : public Blockio<0,0> {
+ public:
+  Throwing() { throw Fault("not constructible"); }
+};
+
+}
+
+TEST_F(controlArenaTest, scheduleOrder) {
+  TimeDomain td("td", 0.001, false);
+  Arena arena(td, 4096);
+  auto& c = arena.create<Constant<>>(2.0);
+  auto& g1 = arena.create<Gain<>>(3.0);
+  auto& g2 = arena.create<Gain<>>(0.5);
+  auto& s = arena.create<Sum<2>>();
+  g1.getIn().connect(c.getOut());
+  g2.getIn().connect(g1.getOut());
+  s.getIn(0).connect(g1.getOut());
+  s.getIn(1).connect(g2.getOut());
+  EXPECT_TRUE(arena.contains(&c));
+  EXPECT_TRUE(arena.contains(&s.getOut().getSignal()));
+  EXPECT_LT(static_cast<void*>(&c), static_cast<void*>(&g1));
+  EXPECT_LT(static_cast<void*>(&g1), static_cast<void*>(&g2));
+  EXPECT_LT(static_cast<void*>(&g2), static_cast<void*>(&s));
+  EXPECT_LE(arena.getUsed(), sizeof(c) + sizeof(g1) + sizeof(g2) + sizeof(s) + 3 * alignof(std::max_align_t));
+  td.run();
+  EXPECT_DOUBLE_EQ(g2.getOut().getSignal().getValue(), 3.0);
+  EXPECT_DOUBLE_EQ(s.getOut().getSignal().getValue(), 9.0);
+  EXPECT_EQ(s.getInputs().size(), 2u);
+  EXPECT_EQ(s.getIn(0).getSourceBlock(), &g1);
+}
+
+TEST_F(controlArenaTest, removedFromTimeDomain) {
+  TimeDomain td("td", 0.001, false);
+  Constant<> other(1.0);
+  td.addBlock(other);
+  {
+    Arena arena(td, 4096);
+    auto& c = arena.create<Constant<>>(2.0);
+    auto& g = arena.create<Gain<>>(3.0);
+    g.getIn().connect(c.getOut());
+    td.run();
+    EXPECT_DOUBLE_EQ(g.getOut().getSignal().getValue(), 6.0);
+  }
+  other.setValue(2.0);
+  td.run();  // runs only the block outside of the destroyed arena
+  EXPECT_DOUBLE_EQ(other.getOut().getSignal().getValue(), 2.0);
+}
+
+TEST_F(controlArenaTest, names) {
+  Arena arena(1024);
+  auto& g = arena.create<Gain<>>(1.0);
+  EXPECT_EQ(g.getName(), "");
+  g.setName("gain with a name longer than the small string buffer of std::string");
+  EXPECT_EQ(g.getName(), "gain with a name longer than the small string buffer of std::string");
+}
+
+TEST_F(controlArenaTest, destroyedInReverseOrder) {
+  std::vector<int> destroyed;
+  {
+    Arena arena(1024);
+    for (int i = 0; i < 3; i++) arena.create<Tracked>(destroyed, i);
+    EXPECT_TRUE(destroyed.empty());
+  }
+  EXPECT_EQ(destroyed, std::vector<int>({2, 1, 0}));
+}
+
+TEST_F(controlArenaTest, full) {
+  Arena arena(1);
+  EXPECT_EQ(arena.getSize(), static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+  EXPECT_THROW(arena.create<Throwing>(), Fault);
+  EXPECT_EQ(arena.getUsed(), 0u);
+  std::size_t blocks = 0;
+  EXPECT_THROW(while (true) { arena.create<Gain<>>(1.0); blocks++; }, Fault);
+  EXPECT_GT(blocks, 0u);
+  EXPECT_LE(arena.getUsed(), arena.getSize());
+  EXPECT_THROW(Arena empty(0), Fault);
+}
@@ -0,0 +1,130 @@
+#include <eeros/control/BlockArray.hpp>
+#include <eeros/control/Output.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <eeros/core/Fault.hpp>
+#include <gtest/gtest.h>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::math;
+
+namespace {
+
+void set(Output<Matrix<3,1>>& o, Matrix<3,1> v, timestamp_t t) {
+  o.getSignal().setValue(v);
+  o.getSignal().setTimestamp(t);
+}
+
+}
+
+TEST(controlBlockArrayTest, gain) {
+  Output<Matrix<3,1>> src;
+  BlockArray<Gain<>, 3> g(2.0);
+  g.getIn().connect(src);
+  set(src, {1.0, 2.0, 3.0}, 10);
+  g.run();
+  EXPECT_EQ(g.getOut().getSignal().getValue(), (Matrix<3,1>{2.0, 4.0, 6.0}));
+  EXPECT_EQ(g.getOut().getSignal().getTimestamp(), 10u);
+  g.setGain(1, -1.0);
+  g.disable(2);
+  g.run();
+  EXPECT_EQ(g.getOut().getSignal().getValue(), (Matrix<3,1>{2.0, -2.0, 3.0}));
+  EXPECT_DOUBLE_EQ(g.getGain(1), -1.0);
+  g.setGain(Matrix<3,1>{3.0, 3.0, 3.0});
+  g.enable();
+  g.run();
+  EXPECT_EQ(g.getOut().getSignal().getValue(), (Matrix<3,1>{3.0, 6.0, 9.0}));
+  EXPECT_THROW(g.setGain(3, 1.0), IndexOutOfBoundsFault);
+}
+
+TEST(controlBlockArrayTest, saturation) {
+  Output<Matrix<3,1>> src;
+  BlockArray<Saturation<>, 3> s(-1.0, 1.0);
+  s.getIn().connect(src);
+  set(src, {-2.0, 0.5, 2.0}, 0);
+  s.run();
+  EXPECT_EQ(s.getOut().getSignal().getValue(), (Matrix<3,1>{-1.0, 0.5, 1.0}));
+  s.setLimit(1, 0.0, 0.2);
+  s.disable(2);
+  s.run();
+  EXPECT_EQ(s.getOut().getSignal().getValue(), (Matrix<3,1>{-1.0, 0.2, 2.0}));
+}
+
+TEST(controlBlockArrayTest, integrator) {
+  Output<Matrix<3,1>> src;
+  BlockArray<I<>, 3> i;
+  i.getIn().connect(src);
+  i.setLimit(2, 0.5, -0.5);
+  i.setInitCondition(1, 1.0);
+  i.enable();
+  set(src, {1.0, 1.0, 1.0}, 0);
+  i.run();
+  EXPECT_EQ(i.getOut().getSignal().getValue(), (Matrix<3,1>{0.0, 1.0, 0.0}));
+  set(src, {1.0, 1.0, 1.0}, 250000000);
+  i.run();
+  EXPECT_EQ(i.getOut().getSignal().getValue(), (Matrix<3,1>{0.25, 1.25, 0.25}));
+  set(src, {1.0, 1.0, 1.0}, 500000000);
+  i.run();
+  EXPECT_EQ(i.getOut().getSignal().getValue(), (Matrix<3,1>{0.5, 1.5, 0.25}));   // limited
+  i.disable(0);
+  set(src, {1.0, 1.0, 1.0}, 750000000);
+  i.run();
+  EXPECT_EQ(i.getOut().getSignal().getValue(), (Matrix<3,1>{0.5, 1.75, 0.25}));
+}
+
+TEST(controlBlockArrayTest, differentiator) {
+  Output<Matrix<3,1>> src;
+  BlockArray<D<>, 3> d;
+  d.getIn().connect(src);
+  set(src, {0.0, 1.0, 2.0}, 1000000000);
+  d.run();
+  EXPECT_EQ(d.getOut().getSignal().getValue(), (Matrix<3,1>{0.0, 0.0, 0.0}));
+  set(src, {1.0, 3.0, 2.0}, 1500000000);
+  d.run();
+  EXPECT_EQ(d.getOut().getSignal().getValue(), (Matrix<3,1>{2.0, 4.0, 0.0}));
+  EXPECT_EQ(d.getOut().getSignal().getTimestamp(), 1250000000u);
+}
+
+TEST(controlBlockArrayTest, rateLimiter) {
+  Output<Matrix<3,1>> src;
+  BlockArray<RateLimiter<>, 3> r(-1.0, 2.0);
+  r.getIn().connect(src);
+  set(src, {0.0, 0.0, 0.0}, 1000000000);
+  r.run();
+  r.enable();
+  set(src, {10.0, -10.0, 0.5}, 2000000000);
+  r.run();
+  EXPECT_EQ(r.getOut().getSignal().getValue(), (Matrix<3,1>{2.0, -1.0, 0.5}));
+  r.disable(0);
+  r.setRate(1, -3.0, 3.0);
+  set(src, {10.0, -10.0, 0.5}, 3000000000);
+  r.run();
+  EXPECT_EQ(r.getOut().getSignal().getValue(), (Matrix<3,1>{10.0, -4.0, 0.5}));
+}
+
+TEST(controlBlockArrayTest, channels) {
+  Output<double> src[3];
+  BlockArray<Gain<>, 3> g(Matrix<3,1>{1.0, 2.0, 3.0});
+  g.setName("g");
+  for (uint8_t i = 0; i < 3; i++) {
+    src[i].getSignal().setValue(1.0);
+    src[i].getSignal().setTimestamp(5);
+    g.getIn(i).connect(src[i]);
+  }
+  Output<double>& out = g.getOut(2);
+  g.run();
+  EXPECT_DOUBLE_EQ(out.getSignal().getValue(), 3.0);
+  EXPECT_DOUBLE_EQ(g.getOut(1).getSignal().getValue(), 2.0);
+  EXPECT_EQ(g.getOut().getSignal().getValue(), (Matrix<3,1>{1.0, 2.0, 3.0}));
+  EXPECT_EQ(out.getSignal().getTimestamp(), 5u);
+  EXPECT_THROW(g.getIn(3), IndexOutOfBoundsFault);
+
+  BlockArray<Gain<>, 3> u;
+  u.setName("u");
+  try {
+    u.run();
+    FAIL();
+  } catch(eeros::Fault const & err) {
+    EXPECT_EQ(err.what(), std::string("Read from an unconnected input in block 'u'"));
+  }
+}
@@ -0,0 +1,78 @@
+#include <eeros/control/can/CanReceiveFaulhaber.hpp>
+#include <eeros/control/can/CanHandle.hpp>
+#include <eeros/control/can/CanTransport.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <iostream>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+// sends one frame and returns the frames received by rx
+unsigned int transfer(CanTransport& tx, CanTransport& rx, canid_t id, const uint8_t* data, uint8_t len) {
+  tx.queue(id, data, len);
+  tx.flush();
+  usleep(10000);
+  return rx.receive();
+}
+
+}
+
+// Test an SDO round trip after the block is constructed, a datagram socket pair stands in for the bus
+TEST(controlCanReceiveFaulhaberTest, sdoAfterConstruction) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+  {
+    CanReceiveFaulhaber<1> receive(sv[1], {1}, {CANOPEN_FC_PDO1_TX, CANOPEN_FC_PDO2_TX});
+    CanTransport driveBus(sv[0]), masterBus(sv[1]);
+    const uint8_t request[8] = {0x40, 0x41, 0x60, 0, 0, 0, 0, 0};
+    const uint8_t response[8] = {0x4b, 0x41, 0x60, 0, 0x37, 0x02, 0, 0};
+    ASSERT_EQ(transfer(masterBus, driveBus, 0x601, request, sizeof(request)), 1u);
+    ASSERT_EQ(transfer(driveBus, masterBus, 0x581, response, sizeof(response)), 1u);
+    EXPECT_EQ(masterBus.getFrame(0).can_id, 0x581u);
+    EXPECT_THROW(receive.enable(), Fault);   // a socket pair cannot be filtered
+  }
+  close(sv[0]);
+  close(sv[1]);
+}
+
+// Test that SDO transfers on the socket of the block work until it is enabled, needs vcan0 to be up
+TEST(controlCanReceiveFaulhaberTest, sdoBeforeEnable) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  std::unique_ptr<CanHandle> drive, master;
+  try {
+    drive.reset(new CanHandle("vcan0"));
+    master.reset(new CanHandle("vcan0"));
+  } catch (Fault& e) {
+    GTEST_SKIP() << "vcan0 not available";
+  }
+  CanReceiveFaulhaber<1> receive(master->getSocket(), {1}, {CANOPEN_FC_PDO1_TX, CANOPEN_FC_PDO2_TX});
+  CanTransport driveBus(drive->getSocket()), masterBus(master->getSocket());
+  const uint8_t request[8] = {0x40, 0x41, 0x60, 0, 0, 0, 0, 0};      // upload status word
+  const uint8_t response[8] = {0x4b, 0x41, 0x60, 0, 0x37, 0x02, 0, 0};
+  
+  ASSERT_EQ(transfer(masterBus, driveBus, 0x601, request, sizeof(request)), 1u);
+  ASSERT_EQ(transfer(driveBus, masterBus, 0x581, response, sizeof(response)), 1u);
+  EXPECT_EQ(masterBus.getFrame(0).can_id, 0x581u);
+  
+  receive.enable();
+  const uint8_t pdo1[6] = {0x37, 0x02, 100, 0, 0, 0};
+  driveBus.queue(0x581, response, sizeof(response));
+  driveBus.queue(CanTransport::cobId(CANOPEN_FC_PDO1_TX, 1), pdo1, sizeof(pdo1));
+  driveBus.flush();
+  usleep(10000);
+  receive.run();
+  EXPECT_DOUBLE_EQ(receive.getOutVel().getSignal().getValue()[0], 100);
+  EXPECT_EQ(masterBus.receive(), 0u);   // SDO response filtered
+  
+  receive.disable();
+  ASSERT_EQ(transfer(driveBus, masterBus, 0x581, response, sizeof(response)), 1u);
+  EXPECT_EQ(masterBus.getFrame(0).can_id, 0x581u);
+}
@@ -0,0 +1,88 @@
+#include <eeros/control/can/CanSendFaulhaber.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/FaultStatus.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::math;
+
+// Test sending to more nodes than one batch of the transport holds, a datagram socket pair stands in for the bus
+TEST(controlCanSendFaulhaberTest, moreNodesThanOneBatch) {
+  constexpr uint8_t N = 40;  // 1 sync and 2 RPDOs per node, more than CanTransport::maxFrames
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+  {
+    CanSendFaulhaber<N> send(sv[0], {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40}, {});
+    CanTransport rx(sv[1]);
+    Matrix<N,1,double> vel;
+    Matrix<N,1,uint16_t> ctrl;
+    for (int i = 0; i < N; i++) {
+      vel[i] = 100 + i;
+      ctrl[i] = 0x0f;
+    }
+    Constant<Matrix<N,1,double>> c(vel);
+    c.run();
+    send.getInVel().connect(c.getOut());
+    send.setCtrl(ctrl);
+    send.ipmodeEnable();
+    send.enable();
+    send.run();
+
+    std::vector<can_frame> frames;
+    for (unsigned int n = rx.receive(); n > 0; n = rx.receive()) {
+      for (unsigned int i = 0; i < n; i++) frames.push_back(rx.getFrame(i));
+    }
+    ASSERT_EQ(frames.size(), 1u + 2 * N);
+    EXPECT_EQ(frames[0].can_id, CanTransport::syncId);
+    for (int i = 0; i < N; i++) {
+      const can_frame& f1 = frames[1 + i];
+      EXPECT_EQ(f1.can_id, CanTransport::cobId(CANOPEN_FC_PDO1_RX, i + 1));
+      EXPECT_EQ(f1.data[0], 0x0f);
+      const can_frame& f2 = frames[1 + N + i];
+      EXPECT_EQ(f2.can_id, CanTransport::cobId(CANOPEN_FC_PDO2_RX, i + 1));
+      int32_t value;
+      std::memcpy(&value, f2.data, sizeof(value));
+      EXPECT_EQ(value, 100 + i);
+    }
+  }
+  close(sv[0]);
+  close(sv[1]);
+}
+
+// Test that frames the socket cannot take are counted and reported to the time domain instead of thrown
+TEST(controlCanSendFaulhaberTest, fullQueueRaisesFault) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+  {
+    CanSendFaulhaber<2> send(sv[0], {1, 2}, {});
+    send.setName("send");
+    Constant<Matrix<2,1,double>> c(Matrix<2,1,double>{1.0, 2.0});
+    c.run();
+    send.getInVel().connect(c.getOut());
+    send.ipmodeEnable();
+    send.enable();
+    FaultStatus status;
+    {
+      FaultStatus::Scope scope(status);
+      for (int i = 0; i < 100000 && status.get() == 0; i++) send.run();   // nothing is received
+    }
+    EXPECT_EQ(status.get(), static_cast<uint32_t>(FaultCode::framesDropped));
+    EXPECT_EQ(status.getMessage(), std::string("Frames dropped by block 'send', send queue of the bus is full"));
+    EXPECT_GT(send.getDropped(), 0u);
+    uint64_t dropped = send.getDropped();
+    EXPECT_THROW(send.run(), Fault);
+    EXPECT_EQ(send.getDropped(), dropped + 3);
+  }
+  close(sv[0]);
+  close(sv[1]);
+}
@@ -0,0 +1,103 @@
+#include <eeros/control/can/CanTransport.hpp>
+#include <eeros/control/can/CanHandle.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/core/Fault.hpp>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::control;
+
+// Test building and splitting CANopen identifiers
+TEST(controlCanTransportTest, cobId) {
+  EXPECT_EQ(CanTransport::cobId(3, 5), 0x185u);
+  EXPECT_EQ(CanTransport::cobId(6, 127), 0x37Fu);
+  EXPECT_EQ(CanTransport::cobId(1, 0), CanTransport::syncId);
+  EXPECT_EQ(CanTransport::functionCode(0x285), 5);
+  EXPECT_EQ(CanTransport::nodeId(0x285), 5);
+}
+
+// Test node lookup
+TEST(controlCanTransportTest, nodeTable) {
+  CanNodeTable t({10, 3, 127});
+  EXPECT_EQ(t[10], 0);
+  EXPECT_EQ(t[3], 1);
+  EXPECT_EQ(t[127], 2);
+  EXPECT_EQ(t[0], -1);
+  EXPECT_EQ(t[11], -1);
+}
+
+// Test sending and receiving frames in batches, a datagram socket pair stands in for the bus
+TEST(controlCanTransportTest, batch) {
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+  {
+    CanTransport tx(sv[0]), rx(sv[1]);
+    EXPECT_EQ(rx.receive(), 0u);
+    for (uint8_t i = 0; i < 10; i++) {
+      uint32_t value = 1000 + i;
+      EXPECT_TRUE(tx.queue(CanTransport::cobId(5, i), &value, sizeof(value)));
+    }
+    EXPECT_EQ(tx.getQueued(), 10u);
+    uint64_t before = System::getTimeNs();
+    EXPECT_EQ(tx.flush(), 10u);
+    EXPECT_EQ(tx.getQueued(), 0u);
+    ASSERT_EQ(rx.receive(), 10u);
+    for (unsigned int i = 0; i < 10; i++) {
+      const can_frame& f = rx.getFrame(i);
+      EXPECT_EQ(CanTransport::nodeId(f.can_id), i);
+      EXPECT_EQ(CanTransport::functionCode(f.can_id), 5);
+      EXPECT_EQ(f.can_dlc, 4);
+      uint32_t value;
+      memcpy(&value, f.data, sizeof(value));
+      EXPECT_EQ(value, 1000 + i);
+      EXPECT_GE(rx.getTimestamp(i), before);
+    }
+    EXPECT_EQ(rx.receive(), 0u);
+    EXPECT_EQ(rx.getErrors(), 0u);
+  }
+  close(sv[0]);
+  close(sv[1]);
+}
+
+// Test that the queue holds at most maxFrames frames and payloads at most 8 bytes
+TEST(controlCanTransportTest, queueLimits) {
+  CanTransport t(-1);
+  uint8_t data[9] = { };
+  EXPECT_FALSE(t.queue(1, data, 9));
+  for (unsigned int i = 0; i < CanTransport::maxFrames; i++) EXPECT_TRUE(t.queue(1, data, 8));
+  EXPECT_FALSE(t.queue(1, data, 8));
+  EXPECT_THROW(t.flush(), Fault);
+  EXPECT_EQ(t.getQueued(), 0u);
+}
+
+// Test the kernel filter and timestamps on a virtual CAN bus, needs vcan0 to be up
+TEST(controlCanTransportTest, vcanFilter) {
+  std::unique_ptr<CanHandle> h1, h2;
+  try {
+    h1.reset(new CanHandle("vcan0"));
+    h2.reset(new CanHandle("vcan0"));
+  } catch (Fault& e) {
+    GTEST_SKIP() << "vcan0 not available";
+  }
+  CanTransport tx(h1->getSocket()), rx(h2->getSocket());
+  rx.setFilter({CanTransport::cobId(3, 1), CanTransport::cobId(3, 2)});
+  rx.enableTimestamps();
+  uint8_t data[2] = {1, 2};
+  for (uint8_t node = 1; node <= 4; node++) tx.queue(CanTransport::cobId(3, node), data, sizeof(data));
+  tx.queue(CanTransport::cobId(5, 1), data, sizeof(data));
+  EXPECT_EQ(tx.flush(), 5u);
+  usleep(10000);
+  ASSERT_EQ(rx.receive(), 2u);
+  uint64_t now = System::getTimeNs();
+  EXPECT_EQ(rx.getFrame(0).can_id, CanTransport::cobId(3, 1));
+  EXPECT_EQ(rx.getFrame(1).can_id, CanTransport::cobId(3, 2));
+  for (unsigned int i = 0; i < 2; i++) {
+    // stamped by the kernel about 10 ms before reception
+    EXPECT_LT(rx.getTimestamp(i), now - 5000000);
+    EXPECT_GT(rx.getTimestamp(i), now - 1000000000);
+  }
+}
@@ -0,0 +1,180 @@
+#include <eeros/control/InputRecorder.hpp>
+#include <eeros/control/InputReplay.hpp>
+#include <eeros/control/PeripheralInput.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/hal/HAL.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+// hardware input with a value set by the test
+template < typename T >
+class TestInput : public hal::Input<T> {
+ public:
+  TestInput(const std::string& id) : hal::Input<T>(id, nullptr), value() {
+    hal::HAL::instance().addInput(this);
+  }
+  ~TestInput() {
+    hal::HAL::instance().removeInput(this);
+  }
+  virtual T get() { return value; }
+  T value;
+};
+
+class controlInputRecorderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::cout.setstate(std::ios_base::badbit);
+    logger::Logger::setDefaultStreamLogger(std::cout);
+  }
+  void TearDown() override {
+    std::cout.clear();
+    std::remove("recording.bin");
+  }
+};
+
+// control system with two analog inputs, one logic input and a gain
+struct Control {
+  Control() : td("td", 0.001, false), a("recA"), b("recB"), d("recD"), g(0.1) {
+    g.getIn().connect(a.getOut());
+    td.addBlock(a);
+    td.addBlock(b);
+    td.addBlock(d);
+    td.addBlock(g);
+  }
+  TimeDomain td;
+  PeripheralInput<> a, b;
+  PeripheralInput<bool> d;
+  Gain<> g;
+};
+
+}
+
+TEST_F(controlInputRecorderTest, recordAndReplay) {
+  std::vector<double> out;
+  std::vector<uint64_t> stamps;
+  {
+    TestInput<double> ia("recA"), ib("recB");
+    TestInput<bool> id("recD");
+    Control c;
+    InputRecorder rec("recording.bin");
+    rec.add(c.a);
+    rec.add(c.d);
+    rec.add(c.b);
+    c.td.addBlock(rec);
+    EXPECT_EQ(rec.getFrameSize(), sizeof(recording::Frame) + 3 * sizeof(recording::Sample));
+    for (int i = 0; i < 100; i++) {
+      ia.value = std::sin(i * 0.1) * 1e3;
+      ib.value = i;
+      id.value = (i % 3) == 0;
+      c.td.run();
+      out.push_back(c.g.getOut().getSignal().getValue());
+      stamps.push_back(c.a.getOut().getSignal().getTimestamp());
+    }
+    EXPECT_EQ(rec.getFrameCount(), 100u);
+    EXPECT_EQ(rec.getDroppedCount(), 0u);
+  }
+  InputReplay replay("recording.bin");
+  EXPECT_EQ(replay.getFrameCount(), 100u);
+  std::vector<std::string> ids = {"recA", "recB", "recD"};
+  EXPECT_EQ(replay.getIds(), ids);
+  Control c;
+  for (int i = 0; i < 100; i++) {
+    replay.run();
+    c.td.run();
+    EXPECT_EQ(c.g.getOut().getSignal().getValue(), out[i]);
+    EXPECT_EQ(c.a.getOut().getSignal().getTimestamp(), stamps[i]);
+    EXPECT_DOUBLE_EQ(c.b.getOut().getSignal().getValue(), i);
+    EXPECT_EQ(c.d.getOut().getSignal().getValue(), (i % 3) == 0);
+    EXPECT_EQ(replay.getCycle(), static_cast<uint64_t>(i));
+  }
+  EXPECT_TRUE(replay.atEnd());
+  replay.run();
+  EXPECT_DOUBLE_EQ(c.b.getOut().getSignal().getValue(), 99);
+  replay.seek(42);
+  replay.run();
+  c.td.run();
+  EXPECT_DOUBLE_EQ(c.b.getOut().getSignal().getValue(), 42);
+  EXPECT_EQ(c.a.getOut().getSignal().getTimestamp(), stamps[42]);
+  EXPECT_THROW(replay.seek(101), Fault);
+}
+
+TEST_F(controlInputRecorderTest, inputsReleased) {
+  {
+    TestInput<double> ia("recA"), ib("recB");
+    TestInput<bool> id("recD");
+    Control c;
+    InputRecorder rec("recording.bin");
+    rec.add(c.a);
+    c.td.addBlock(rec);
+    c.td.run();
+    EXPECT_THROW(rec.add(c.b), Fault);
+  }
+  {
+    InputReplay replay("recording.bin");
+    EXPECT_THROW(TestInput<double> conflict("recA"), Fault);
+  }
+  TestInput<double> ia("recA");
+  EXPECT_EQ(hal::HAL::instance().getInput("recA"), &ia);
+  hal::HAL::instance().releaseInput("recA");
+}
+
+TEST_F(controlInputRecorderTest, replacesHardwareInputs) {
+  TestInput<double> ia("recA"), ib("recB");
+  TestInput<bool> id("recD");
+  {
+    Control c;
+    InputRecorder rec("recording.bin");
+    rec.add(c.b);
+    c.td.addBlock(rec);
+    ib.value = 7;
+    c.td.run();
+  }
+  for (auto name : {"recA", "recB", "recD"}) hal::HAL::instance().releaseInput(name);
+  ib.value = 1;
+  {
+    InputReplay replay("recording.bin");
+    PeripheralInput<> b("recB");
+    replay.run();
+    b.run();
+    EXPECT_DOUBLE_EQ(b.getOut().getSignal().getValue(), 7);
+  }
+  EXPECT_EQ(hal::HAL::instance().getInput("recB"), &ib);
+  hal::HAL::instance().releaseInput("recB");
+}
+
+TEST_F(controlInputRecorderTest, dropped) {
+  TestInput<double> ia("recA");
+  PeripheralInput<> a("recA");
+  uint64_t frames;
+  {
+    InputRecorder rec("recording.bin", 4);
+    rec.add(a);
+    for (int i = 0; i < 1000; i++) rec.run();
+    EXPECT_GT(rec.getDroppedCount(), 0u);
+    frames = rec.getFrameCount() - rec.getDroppedCount();
+  }
+  std::ifstream f("recording.bin", std::ios::binary | std::ios::ate);
+  EXPECT_EQ(static_cast<uint64_t>(f.tellg()), sizeof(recording::Header) + sizeof(recording::Channel) + frames * (sizeof(recording::Frame) + sizeof(recording::Sample)));
+}
+
+TEST_F(controlInputRecorderTest, invalid) {
+  {
+    std::ofstream f("recording.bin", std::ios::binary | std::ios::trunc);
+    f << "this is not a recording, but some text which is long enough for a header";
+  }
+  EXPECT_THROW(InputReplay r("recording.bin"), Fault);
+  std::remove("recording.bin");
+  EXPECT_THROW(InputReplay r("recording.bin"), Fault);
+  EXPECT_THROW(InputRecorder r("no/such/dir/recording.bin"), Fault);
+}
@@ -1,8 +1,11 @@
-// #include <eeros/control/filter/KalmanFilter.hpp>
+#include <eeros/control/filter/KalmanFilter.hpp>
+#include <eeros/control/TimeDomain.hpp>
 #include <eeros/core/Fault.hpp>
 #include <eeros/math/Matrix.hpp>
 #include <eeros/control/Constant.hpp>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <thread>
 #include <Utils.hpp>
 
 using namespace eeros;
@@ -44,4 +47,120 @@ TEST(controlKLFTest, input) {
 //   }
 }
 
+namespace {
 
+constexpr double dt = 0.01;
+
+// position and velocity of a mass driven by a force u, the position y is measured
+struct MassFilter {
+  MassFilter()
+      : Ad(1.0, 0.0, dt, 1.0), Bd(0.0, dt), C(1.0, 0.0), Gd(0.0, dt), Q(1.0), R(0.01),
+        kf(Ad, Bd, C, Gd, Q, R), u(1.0), y(0.5) {
+    kf.getU(0).connect(u.getOut());
+    kf.getY(0).connect(y.getOut());
+    u.run();
+    y.run();
+  }
+  Matrix<2,2> Ad;
+  Matrix<2,1> Bd;
+  Matrix<1,2> C;
+  Matrix<2,1> Gd;
+  Matrix<1,1> Q, R;
+  KalmanFilter<1,1,2,1> kf;
+  Constant<> u, y;
+};
+
+}
+
+// Test prediction and correction in one time domain against the filter equations
+TEST(controlKLFTest, oneTimeDomain) {
+  MassFilter f;
+  TimeDomain td("kalman", 0.001, false);
+  td.addBlock(f.kf.correct);
+  td.addBlock(f.kf.predict);
+  Matrix<2,1> x;
+  Matrix<2,2> P, eye;
+  x.zero();
+  P.eye();
+  eye.eye();
+  Matrix<1,1> y(0.5);
+  for (int k = 0; k < 50; k++) {
+    td.run();
+    if (k > 0) {
+      Matrix<1,1> S;
+      Matrix<2,1> K;
+      S = f.C * P * f.C.transpose() + f.R;
+      K = P * f.C.transpose() * !S;
+      x = x + K * (y - f.C * x);
+      P = (eye - K * f.C) * P;
+    }
+    for (int i = 0; i < 2; i++) EXPECT_NEAR(f.kf.getXCorrected(i).getSignal().getValue(), x[i], 1e-12);
+    x = f.Ad * x + f.Bd * 1.0;
+    P = f.Ad * P * f.Ad.transpose() + f.Gd * f.Q * f.Gd.transpose();
+    for (int i = 0; i < 2; i++) EXPECT_NEAR(f.kf.getX(i).getSignal().getValue(), x[i], 1e-12);
+  }
+}
+
+// Test that each output is only written in the time domain of its block
+TEST(controlKLFTest, twoTimeDomains) {
+  MassFilter f;
+  TimeDomain tdPredict("predict", 0.001, false);
+  TimeDomain tdCorrect("correct", 0.01, false);
+  tdPredict.addBlock(f.kf.predict);
+  tdCorrect.addBlock(f.kf.correct);
+  for (int i = 0; i < 2; i++) {
+    EXPECT_EQ(f.kf.getX(i).getSourceBlock(), &f.kf.predict);
+    EXPECT_EQ(f.kf.getXCorrected(i).getSourceBlock(), &f.kf.correct);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    f.kf.getXCorrected(i).getSignal().setValue(-1.0);
+    f.kf.getXCorrected(i).getSignal().setTimestamp(0);
+  }
+  tdPredict.run();
+  tdPredict.run();
+  Matrix<2,1> x;
+  x = f.Ad * f.Bd + f.Bd;
+  for (int i = 0; i < 2; i++) {
+    EXPECT_NEAR(f.kf.getX(i).getSignal().getValue(), x[i], 1e-12);
+    EXPECT_EQ(f.kf.getXCorrected(i).getSignal().getTimestamp(), 0u);
+    EXPECT_EQ(f.kf.getXCorrected(i).getSignal().getValue(), -1.0);
+  }
+
+  tdCorrect.run();
+  tdCorrect.run();
+  double corrected = f.kf.getXCorrected(0).getSignal().getValue();
+  EXPECT_GT(corrected, x[0]);
+  EXPECT_LT(corrected, 0.5);
+  for (int i = 0; i < 2; i++) EXPECT_EQ(f.kf.getX(i).getSignal().getValue(), x[i]);
+
+  // the prediction continues from the corrected estimate
+  Matrix<2,1> xc;
+  for (int i = 0; i < 2; i++) xc[i] = f.kf.getXCorrected(i).getSignal().getValue();
+  tdPredict.run();
+  x = f.Ad * xc + f.Bd;
+  for (int i = 0; i < 2; i++) EXPECT_NEAR(f.kf.getX(i).getSignal().getValue(), x[i], 1e-12);
+  EXPECT_EQ(f.kf.getXCorrected(0).getSignal().getValue(), corrected);
+
+  // both time domains running at the same time, the position follows the measurement
+  f.u.setValue(0.0);
+  f.u.run();
+  std::thread correcting([&]() { for (int k = 0; k < 2000; k++) tdCorrect.run(); });
+  for (int k = 0; k < 20000; k++) tdPredict.run();
+  correcting.join();
+  tdCorrect.run();
+  EXPECT_NEAR(f.kf.getXCorrected(0).getSignal().getValue(), 0.5, 0.05);
+}
+
+// Test that a parallel time domain runs prediction and correction in one thread
+TEST(controlKLFTest, parallelTimeDomain) {
+  MassFilter f;
+  Constant<> other(1.0);
+  TimeDomain td("kalman", 0.001, false);
+  td.addBlock(f.kf.correct);
+  td.addBlock(f.kf.predict);
+  td.addBlock(other);
+  td.setParallel(3);
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+}
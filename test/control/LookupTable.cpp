@@ -0,0 +1,99 @@
+#include <eeros/control/LookupTable.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <gtest/gtest.h>
+#include <functional>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::config;
+using namespace eeros::math;
+
+namespace {
+
+// samples f on a grid with n samples between 0 and max in each dimension
+std::shared_ptr<TableFile> sample(std::vector<std::size_t> n, std::vector<double> max, std::function<double(double, double, double)> f) {
+  std::vector<double> v;
+  std::size_t dims = n.size();
+  n.resize(3, 1);
+  max.resize(3, 1);
+  for (std::size_t i = 0; i < n[0]; i++) {
+    for (std::size_t j = 0; j < n[1]; j++) {
+      for (std::size_t k = 0; k < n[2]; k++) {
+        double x = n[0] > 1 ? max[0] * i / (n[0] - 1) : 0;
+        double y = n[1] > 1 ? max[1] * j / (n[1] - 1) : 0;
+        double z = n[2] > 1 ? max[2] * k / (n[2] - 1) : 0;
+        v.push_back(f(x, y, z));
+      }
+    }
+  }
+  n.resize(dims);
+  max.resize(dims);
+  return std::make_shared<TableFile>(n, std::vector<double>(dims, 0.0), max, v);
+}
+
+}
+
+// Test the dimension of the table
+TEST(controlLookupTableTest, dims) {
+  auto t = sample({5, 5}, {1, 1}, [](double x, double y, double) { return x + y; });
+  EXPECT_THROW(LookupTable<1> l(t), Fault);
+  EXPECT_THROW(LookupTable<3> l(t), Fault);
+  EXPECT_THROW(LookupTable<1> l(nullptr), Fault);
+  LookupTable<2> l(t);
+  EXPECT_THROW(l.setTable(sample({5}, {1}, [](double x, double, double) { return x; })), Fault);
+}
+
+// Test linear interpolation in one dimension, at samples, between samples and outside of the table
+TEST(controlLookupTableTest, linear1) {
+  LookupTable<1> l(sample({11}, {5}, [](double x, double, double) { return x * x; }));
+  EXPECT_DOUBLE_EQ(l.get(0), 0);
+  EXPECT_DOUBLE_EQ(l.get(2), 4);
+  EXPECT_DOUBLE_EQ(l.get(5), 25);
+  EXPECT_DOUBLE_EQ(l.get(2.25), (4 + 6.25) / 2);
+  EXPECT_DOUBLE_EQ(l.get(-1), 0);
+  EXPECT_DOUBLE_EQ(l.get(7), 25);
+}
+
+// Test linear interpolation in two and three dimensions, exact for multilinear functions
+TEST(controlLookupTableTest, linear23) {
+  LookupTable<2> l2(sample({5, 9}, {2, 4}, [](double x, double y, double) { return 1 + 2 * x - y + 0.5 * x * y; }));
+  for (double x = 0; x <= 2; x += 0.3) {
+    for (double y = 0; y <= 4; y += 0.7) EXPECT_NEAR(l2.get(Vector2{x, y}), 1 + 2 * x - y + 0.5 * x * y, 1e-12);
+  }
+  EXPECT_NEAR(l2.get(Vector2{3, -1}), 1 + 4, 1e-12);
+  LookupTable<3> l3(sample({3, 4, 5}, {1, 1, 1}, [](double x, double y, double z) { return x + 2 * y + 3 * z + x * y * z; }));
+  for (double x = 0; x <= 1; x += 0.25) {
+    for (double y = 0; y <= 1; y += 0.2) {
+      for (double z = 0; z <= 1; z += 0.15) EXPECT_NEAR(l3.get(Vector3{x, y, z}), x + 2 * y + 3 * z + x * y * z, 1e-12);
+    }
+  }
+}
+
+// Test cubic interpolation, exact for quadratic functions away from the border
+TEST(controlLookupTableTest, cubic) {
+  LookupTable<1, Interpolation::cubic> l1(sample({11}, {10}, [](double x, double, double) { return x * x; }));
+  for (double x = 1; x <= 9; x += 0.35) EXPECT_NEAR(l1.get(x), x * x, 1e-9);
+  EXPECT_DOUBLE_EQ(l1.get(0), 0);
+  EXPECT_DOUBLE_EQ(l1.get(10), 100);
+  EXPECT_DOUBLE_EQ(l1.get(11), 100);
+  LookupTable<2, Interpolation::cubic> l2(sample({11, 11}, {10, 10}, [](double x, double y, double) { return x * x - y * y + x * y; }));
+  for (double x = 1; x <= 9; x += 0.7) {
+    for (double y = 1; y <= 9; y += 0.9) EXPECT_NEAR(l2.get(Vector2{x, y}), x * x - y * y + x * y, 1e-9);
+  }
+}
+
+// Test the block, the output follows the input through the table
+TEST(controlLookupTableTest, run) {
+  Constant<> c(1.5);
+  LookupTable<1> l(sample({4}, {3}, [](double x, double, double) { return 10 * x; }));
+  l.getIn().connect(c.getOut());
+  c.run();
+  l.run();
+  EXPECT_DOUBLE_EQ(l.getOut().getSignal().getValue(), 15);
+  EXPECT_EQ(l.getOut().getSignal().getTimestamp(), c.getOut().getSignal().getTimestamp());
+  l.setTable(sample({4}, {3}, [](double x, double, double) { return -x; }));
+  l.run();
+  EXPECT_DOUBLE_EQ(l.getOut().getSignal().getValue(), -1.5);
+}
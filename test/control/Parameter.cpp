@@ -0,0 +1,92 @@
+#include <eeros/control/Parameter.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/Constant.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+struct Pair {
+  int a, b;
+};
+
+}
+
+TEST(controlParameterTest, initialValue) {
+  Parameter<Pair> p(Pair{1, 2});
+  EXPECT_FALSE(p.update());
+  EXPECT_EQ(p.value().a, 1);
+  EXPECT_EQ(p.value().b, 2);
+  EXPECT_EQ(p.get().a, 1);
+}
+
+TEST(controlParameterTest, pickedUpByUpdate) {
+  Parameter<Pair> p(Pair{1, 2});
+  p.set(Pair{3, 4});
+  EXPECT_EQ(p.get().a, 3);
+  EXPECT_EQ(p.value().a, 1);
+  EXPECT_TRUE(p.update());
+  EXPECT_EQ(p.value().a, 3);
+  EXPECT_EQ(p.value().b, 4);
+  EXPECT_FALSE(p.update());
+  EXPECT_EQ(p.value().a, 3);
+}
+
+TEST(controlParameterTest, modifyKeepsOtherValues) {
+  Parameter<Pair> p(Pair{1, 2});
+  p.modify([](Pair& v) { v.a = 5; });
+  p.modify([](Pair& v) { v.b = 6; });
+  EXPECT_TRUE(p.update());
+  EXPECT_EQ(p.value().a, 5);
+  EXPECT_EQ(p.value().b, 6);
+}
+
+TEST(controlParameterTest, consistentUnderConcurrentWrites) {
+  Parameter<Pair> p(Pair{0, 0});
+  std::atomic<bool> stop{false};
+  std::thread writer([&]() {
+    for (int i = 1; i < 100000; i++) p.set(Pair{i, -i});
+    stop = true;
+  });
+  int last = 0;
+  bool consistent = true, monotonic = true;
+  while (!stop) {
+    p.update();
+    const Pair& v = p.value();
+    if (v.a != -v.b) consistent = false;
+    if (v.a < last) monotonic = false;
+    last = v.a;
+  }
+  writer.join();
+  p.update();
+  EXPECT_TRUE(consistent);
+  EXPECT_TRUE(monotonic);
+  EXPECT_EQ(p.value().a, 99999);
+}
+
+TEST(controlParameterTest, gainChangedWhileRunning) {
+  Constant<> c(1.0);
+  Gain<> g(2.0);
+  g.getIn().connect(c.getOut());
+  std::atomic<bool> stop{false};
+  std::thread writer([&]() {
+    for (int i = 0; i < 10000; i++) g.setGain(i % 2 ? 2.0 : 4.0);
+    g.setGain(3.0);
+    stop = true;
+  });
+  bool valid = true;
+  while (!stop) {
+    c.run();
+    g.run();
+    double v = g.getOut().getSignal().getValue();
+    if (v != 2.0 && v != 4.0 && v != 3.0) valid = false;
+  }
+  writer.join();
+  g.run();
+  EXPECT_TRUE(valid);
+  EXPECT_DOUBLE_EQ(g.getOut().getSignal().getValue(), 3.0);
+}
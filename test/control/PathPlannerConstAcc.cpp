@@ -72,3 +72,68 @@ TEST(controlPathPlannerConstAcc, init2) {
   EXPECT_TRUE(Utils::compareApprox(planner.getPosOut().getSignal().getValue()[0], 10, 1e-10));
   EXPECT_TRUE(Utils::compareApprox(planner.getPosOut().getSignal().getValue()[1], 15, 1e-10));
 }
+
+// Test samples against a step by step integration of the acceleration
+TEST(controlPathPlannerConstAcc, accuracy) {
+  PathPlannerConstAcc<Matrix<2,1,double>> planner({1,2}, {2,3}, {2,3}, 0.001);
+  Matrix<2,1,double> start{0, 1}, end{3, -2};
+  planner.move(start, end);
+  Matrix<2,1,double> pos = start, vel{0, 0};
+  double dt = 0.001;
+  int n = 0;
+  while (!planner.endReached() && n < 10000) {
+    planner.run();
+    n++;
+    auto acc = planner.getAccOut().getSignal().getValue();
+    pos += vel * dt + acc * (dt * dt / 2);
+    vel += acc * dt;
+    if (planner.endReached()) break;   // last sample holds the end position
+    for (int i = 0; i < 2; i++) {
+      EXPECT_NEAR(planner.getPosOut().getSignal().getValue()[i], pos[i], 1e-9);
+      EXPECT_NEAR(planner.getVelOut().getSignal().getValue()[i], vel[i], 1e-9);
+    }
+  }
+  EXPECT_EQ(n, 3501);
+  EXPECT_NEAR(pos[0], 3, 1e-9);
+  EXPECT_NEAR(pos[1], -2, 1e-9);
+  EXPECT_NEAR(vel[0], 0, 1e-9);
+  EXPECT_NEAR(vel[1], 0, 1e-9);
+}
+
+// Test a short move without a phase of constant velocity
+TEST(controlPathPlannerConstAcc, noConstVel) {
+  PathPlannerConstAcc<Matrix<1,1,double>> planner(10, 1, 1, 0.1);
+  planner.move(Matrix<1,1,double>(0), Matrix<1,1,double>(1));
+  int n = 0;
+  double pos = 0;
+  while (!planner.endReached() && n < 100) {
+    planner.run();
+    n++;
+    double p = planner.getPosOut().getSignal().getValue()[0];
+    if (!planner.endReached()) {
+      EXPECT_GT(p, pos);   // never holds an output
+    }
+    pos = p;
+  }
+  EXPECT_EQ(n, 21);
+  EXPECT_DOUBLE_EQ(pos, 1);
+}
+
+// Test many axes at once
+TEST(controlPathPlannerConstAcc, axes) {
+  using M = Matrix<12,1,double>;
+  M velMax, acc, start, end;
+  for (int i = 0; i < 12; i++) {
+    velMax[i] = 1; acc[i] = 1; start[i] = i; end[i] = -i - 1;
+  }
+  PathPlannerConstAcc<M> planner(velMax, acc, acc, 0.01);
+  planner.move(start, end);
+  planner.run();
+  auto p1 = planner.getPosOut().getSignal().getValue();
+  while (!planner.endReached()) planner.run();
+  for (int i = 0; i < 12; i++) {
+    // all axes move synchronized
+    EXPECT_NEAR((p1[i] - start[i]) / (end[i] - start[i]), (p1[0] - start[0]) / (end[0] - start[0]), 1e-12);
+    EXPECT_DOUBLE_EQ(planner.getPosOut().getSignal().getValue()[i], end[i]);
+  }
+}
@@ -30,3 +30,46 @@ TEST(controlPathPlannerConstJerk, nan) {
 //   EXPECT_TRUE(std::isnan(planner.getPosOut().getSignal().getValue()[1]));
 }
 
+
+// Test samples against a step by step integration of the jerk
+TEST(controlPathPlannerConstJerk, accuracy) {
+  PathPlannerConstJerk<Matrix<2,1,double>> planner({1,2}, {10,20}, 0.001);
+  Matrix<2,1,double> start{0, 1}, end{3, -2};
+  planner.move(start, end);
+  Matrix<2,1,double> pos = start, vel{0, 0}, acc{0, 0};
+  double dt = 0.001;
+  int n = 0;
+  while (!planner.endReached() && n < 10000) {
+    planner.run();
+    n++;
+    auto jerk = planner.getJerkOut().getSignal().getValue();
+    pos += vel * dt + acc * (dt * dt / 2) + jerk * (dt * dt * dt / 6);
+    vel += acc * dt + jerk * (dt * dt / 2);
+    acc += jerk * dt;
+    if (planner.endReached()) break;   // last sample holds the end position
+    for (int i = 0; i < 2; i++) {
+      EXPECT_NEAR(planner.getPosOut().getSignal().getValue()[i], pos[i], 1e-9);
+      EXPECT_NEAR(planner.getVelOut().getSignal().getValue()[i], vel[i], 1e-9);
+      EXPECT_NEAR(planner.getAccOut().getSignal().getValue()[i], acc[i], 1e-9);
+    }
+  }
+  EXPECT_EQ(n, 3637);
+  EXPECT_NEAR(pos[0], 3, 1e-9);
+  EXPECT_NEAR(pos[1], -2, 1e-9);
+  EXPECT_NEAR(vel[0], 0, 1e-9);
+  EXPECT_NEAR(acc[0], 0, 1e-9);
+}
+
+// Test a short move without a phase of constant velocity
+TEST(controlPathPlannerConstJerk, noConstVel) {
+  PathPlannerConstJerk<Matrix<1,1,double>> planner(10, 1, 0.1);
+  planner.move(Matrix<1,1,double>(0), Matrix<1,1,double>(1));
+  int n = 0;
+  while (!planner.endReached() && n < 1000) {
+    planner.run();
+    n++;
+  }
+  EXPECT_TRUE(planner.endReached());
+  EXPECT_DOUBLE_EQ(planner.getPosOut().getSignal().getValue()[0], 1);
+  EXPECT_DOUBLE_EQ(planner.getVelOut().getSignal().getValue()[0], 0);
+}
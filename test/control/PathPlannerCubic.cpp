@@ -2,6 +2,8 @@
 #include <eeros/core/Fault.hpp>
 #include <gtest/gtest.h>
 #include <Utils.hpp>
+#include <cstdio>
+#include <vector>
 
 using namespace eeros;
 using namespace eeros::control;
@@ -73,3 +75,55 @@ TEST(controlPathPlannerCubicTest, pos) {
 	EXPECT_TRUE(Utils::compareApprox(planner.getVelOut().getSignal().getValue(), 0, 1e-10));
 	EXPECT_TRUE(Utils::compareApprox(planner.getPosOut().getSignal().getValue(), 1183.04, 1e-3));
 }
+
+// Test that a binary trajectory file results in the same trajectory
+TEST(controlPathPlannerCubicTest, binary) {
+	TrajectoryFile::convert("path1.txt", "path2.bin");
+	PathPlannerCubic p1(0.01), p2(0.01);
+	p1.init("path1.txt");
+	p2.init("path2.bin");
+	p1.move(2, 10, 100);
+	p2.move(2, 10, 100);
+	int n = 0;
+	while (!p1.endReached() && n < 1000) {
+		p1.run();
+		p2.run();
+		EXPECT_EQ(p1.getPosOut().getSignal().getValue(), p2.getPosOut().getSignal().getValue());
+		EXPECT_EQ(p1.getJerkOut().getSignal().getValue(), p2.getJerkOut().getSignal().getValue());
+		n++;
+	}
+	EXPECT_EQ(n, 202);
+	EXPECT_TRUE(p2.endReached());
+	std::remove("path2.bin");
+}
+
+// Test restarting a trajectory in the middle
+TEST(controlPathPlannerCubicTest, seek) {
+	PathPlannerCubic p1(0.01), p2(0.01);
+	EXPECT_FALSE(p2.seek(0));
+	p1.init("path1.txt");
+	p2.init("path1.txt");
+	p1.move(200);
+	p2.move(200);
+	std::vector<double> pos;
+	while (!p1.endReached()) {
+		p1.run();
+		pos.push_back(p1.getPosOut().getSignal().getValue());
+	}
+	pos.pop_back();	// sample before end is detected
+	for (int i = 0; i < 10; i++) p2.run();
+	EXPECT_TRUE(p2.seek(1.0));	// jump while running
+	for (std::size_t i = 100; i < pos.size(); i++) {
+		p2.run();
+		EXPECT_NEAR(p2.getPosOut().getSignal().getValue(), pos[i], 1e-9);
+	}
+	p2.run();
+	EXPECT_TRUE(p2.endReached());
+	EXPECT_TRUE(p2.seek(1.5));	// restart after the end
+	EXPECT_FALSE(p2.endReached());
+	for (std::size_t i = 150; i < pos.size(); i++) {
+		p2.run();
+		EXPECT_NEAR(p2.getPosOut().getSignal().getValue(), pos[i], 1e-9);
+	}
+	EXPECT_FALSE(p2.seek(10));
+}
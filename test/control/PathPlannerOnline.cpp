@@ -0,0 +1,167 @@
+#include <eeros/control/PathPlannerOnline.hpp>
+#include <eeros/control/PathPlannerConstJerk.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::math;
+
+namespace {
+
+using M3 = Matrix<3,1,double>;
+
+// runs a planner until its end and checks the limits and the continuity of each sample
+template < typename T >
+int runChecked(PathPlannerOnline<T>& planner, T velMax, T accMax, T jerkMax, double dt, int max = 100000) {
+  T accPrev = planner.getAccOut().getSignal().getValue();
+  int n = 0;
+  do {
+    planner.run();
+    n++;
+    T vel = planner.getVelOut().getSignal().getValue();
+    T acc = planner.getAccOut().getSignal().getValue();
+    T jerk = planner.getJerkOut().getSignal().getValue();
+    for (unsigned int i = 0; i < vel.size(); i++) {
+      EXPECT_LE(std::fabs(vel[i]), velMax[i] * (1 + 1e-9));
+      EXPECT_LE(std::fabs(acc[i]), accMax[i] * (1 + 1e-9));
+      EXPECT_LE(std::fabs(jerk[i]), jerkMax[i] * (1 + 1e-9));
+      if (n > 1) {
+        EXPECT_LE(std::fabs(acc[i] - accPrev[i]), jerkMax[i] * dt * (1 + 1e-9));
+      }
+    }
+    accPrev = acc;
+  } while (!planner.endReached() && n < max);
+  return n;
+}
+
+}
+
+// Test name
+TEST(controlPathPlannerOnline, name) {
+  PathPlannerOnline<Matrix<1,1,double>> planner(1, 1, 1, 0.1);
+  EXPECT_EQ(planner.getName(), std::string(""));
+  planner.setName("path planner");
+  EXPECT_EQ(planner.getName(), std::string("path planner"));
+}
+
+// Test initial values for NaN
+TEST(controlPathPlannerOnline, nan) {
+  PathPlannerOnline<Matrix<1,1,double>> planner(1, 1, 1, 0.1);
+  EXPECT_TRUE(std::isnan(planner.getJerkOut().getSignal().getValue()[0]));
+  EXPECT_TRUE(std::isnan(planner.getAccOut().getSignal().getValue()[0]));
+  EXPECT_TRUE(std::isnan(planner.getVelOut().getSignal().getValue()[0]));
+  EXPECT_TRUE(std::isnan(planner.getPosOut().getSignal().getValue()[0]));
+}
+
+// Test a move from rest to rest within the limits
+TEST(controlPathPlannerOnline, restToRest) {
+  M3 velMax{1, 2, 3}, accMax{2, 2, 2}, jerkMax{10, 20, 5};
+  double dt = 0.001;
+  PathPlannerOnline<M3> planner(velMax, accMax, jerkMax, dt);
+  planner.setStart(M3{0, 1, 2});
+  planner.run();
+  EXPECT_TRUE(planner.endReached());
+  planner.move(M3{3, -2, 2.5});
+  EXPECT_FALSE(planner.endReached());
+  int n = runChecked(planner, velMax, accMax, jerkMax, dt);
+  EXPECT_TRUE(planner.endReached());
+  EXPECT_NEAR(n * dt, planner.getDuration(), dt);
+  EXPECT_EQ(planner.getPosOut().getSignal().getValue(), (M3{3, -2, 2.5}));
+  EXPECT_EQ(planner.getVelOut().getSignal().getValue(), (M3{0, 0, 0}));
+}
+
+// Test that all axes arrive at the same time
+TEST(controlPathPlannerOnline, synchronized) {
+  M3 velMax{1, 1, 1}, accMax{2, 2, 2}, jerkMax{10, 10, 10};
+  double dt = 0.001;
+  PathPlannerOnline<M3> planner(velMax, accMax, jerkMax, dt);
+  planner.setStart(M3{0, 0, 0});
+  planner.move(M3{5, 0.5, -0.01});
+  M3 end{5, 0.5, -0.01};
+  int arrived[3] = {0, 0, 0};
+  int n = 0;
+  while (!planner.endReached() && n < 100000) {
+    planner.run();
+    n++;
+    for (int i = 0; i < 3; i++) {
+      if (std::fabs(planner.getPosOut().getSignal().getValue()[i] - end[i]) > 1e-9) arrived[i] = n + 1;
+    }
+  }
+  EXPECT_NEAR(arrived[1], arrived[0], 2);
+  EXPECT_NEAR(arrived[2], arrived[0], 2);
+}
+
+// Test changing the target during the motion, including reversing
+TEST(controlPathPlannerOnline, newTarget) {
+  M3 velMax{1, 1, 1}, accMax{2, 2, 2}, jerkMax{10, 10, 10};
+  double dt = 0.001;
+  PathPlannerOnline<M3> planner(velMax, accMax, jerkMax, dt);
+  planner.setStart(M3{0, 0, 0});
+  planner.move(M3{2, 2, 2});
+  M3 posPrev{0, 0, 0}, velPrev{0, 0, 0}, accPrev{0, 0, 0};
+  for (int n = 0; n < 20000; n++) {
+    if (n == 500) planner.move(M3{3, -1, 0.2});
+    if (n == 800) planner.move(M3{-1, 0.5, 0.21});
+    if (n >= 1000 && n < 1100) planner.move(M3{-1 + 0.001 * (n - 1000), 0.5, 0.21});  // new target every cycle
+    planner.run();
+    M3 pos = planner.getPosOut().getSignal().getValue();
+    M3 vel = planner.getVelOut().getSignal().getValue();
+    M3 acc = planner.getAccOut().getSignal().getValue();
+    M3 jerk = planner.getJerkOut().getSignal().getValue();
+    for (int i = 0; i < 3; i++) {
+      SCOPED_TRACE(n);
+      EXPECT_LE(std::fabs(vel[i]), velMax[i] + 1e-9);
+      EXPECT_LE(std::fabs(acc[i]), accMax[i] + 1e-9);
+      EXPECT_LE(std::fabs(jerk[i]), jerkMax[i] + 1e-9);
+      EXPECT_LE(std::fabs(pos[i] - posPrev[i]), velMax[i] * dt + 1e-9);
+      EXPECT_LE(std::fabs(vel[i] - velPrev[i]), accMax[i] * dt + 1e-9);
+      EXPECT_LE(std::fabs(acc[i] - accPrev[i]), jerkMax[i] * dt + 1e-9);
+    }
+    posPrev = pos;
+    velPrev = vel;
+    accPrev = acc;
+    if (n >= 1100 && planner.endReached()) break;
+  }
+  EXPECT_TRUE(planner.endReached());
+  EXPECT_EQ(planner.getPosOut().getSignal().getValue(), (M3{-1 + 0.001 * 99, 0.5, 0.21}));
+}
+
+// Test a start state with velocity and acceleration
+TEST(controlPathPlannerOnline, movingStart) {
+  using M1 = Matrix<1,1,double>;
+  double dt = 0.001;
+  M1 velMax(1), accMax(2), jerkMax(10);
+  PathPlannerOnline<M1> planner(velMax, accMax, jerkMax, dt);
+  for (double v : {-1.0, -0.5, 0.0, 0.5, 1.0}) {
+    for (double a : {-2.0, 0.0, 2.0}) {
+      for (double d : {-1.0, 0.0, 0.001, 1.0}) {
+        std::array<M1, 4> start{M1(0), M1(v), M1(a), M1(0)}, end{M1(d), M1(0), M1(0), M1(0)};
+        planner.move(start, end);
+        runChecked(planner, M1(1.2), accMax, jerkMax, dt);
+        EXPECT_TRUE(planner.endReached());
+        EXPECT_EQ(planner.getPosOut().getSignal().getValue()[0], d);
+      }
+    }
+  }
+}
+
+// Test that the profile is not slower than the one of the constant jerk planner
+TEST(controlPathPlannerOnline, constJerk) {
+  M3 velMax{1, 2, 3}, accMax{100, 100, 100}, jerkMax{10, 20, 5};
+  double dt = 0.001;
+  M3 start{0, 1, 2}, end{3, -2, 2.5};
+  PathPlannerOnline<M3> online(velMax, accMax, jerkMax, dt);
+  PathPlannerConstJerk<M3> constJerk(velMax, jerkMax, dt);
+  online.setStart(start);
+  online.run();
+  online.move(end);
+  constJerk.move(start, end);
+  int n1 = 0, n2 = 0;
+  while (!online.endReached() && n1 < 100000) {online.run(); n1++;}
+  while (!constJerk.endReached() && n2 < 100000) {constJerk.run(); n2++;}
+  EXPECT_LE(n1, n2);
+  EXPECT_GE(n1, n2 - 5);  // same profile without rounding the phases to the sampling time
+  EXPECT_EQ(online.getPosOut().getSignal().getValue(), constJerk.getPosOut().getSignal().getValue());
+}
@@ -0,0 +1,114 @@
+#include <eeros/control/Signal.hpp>
+#include <eeros/control/SignalRegistry.hpp>
+#include <eeros/control/Output.hpp>
+#include <eeros/control/Gain.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::control;
+
+TEST(controlSignalTest, compact) {
+  EXPECT_LE(sizeof(Signal<double>), 32u);
+  EXPECT_LE(sizeof(Signal<bool>), 32u);
+  EXPECT_LE(sizeof(Output<double>), 40u);
+}
+
+TEST(controlSignalTest, nameAndUnit) {
+  std::size_t entries = SignalRegistry::size();
+  {
+    Signal<> s;
+    EXPECT_EQ(s.getName(), "");
+    EXPECT_EQ(s.getLabel(), "");
+    EXPECT_EQ(SignalRegistry::size(), entries);
+    s.setName("position");
+    EXPECT_EQ(s.getName(), "position");
+    EXPECT_EQ(s.getLabel(), "position");
+    s.setUnit("m");
+    EXPECT_EQ(s.getUnit(), "m");
+    EXPECT_EQ(s.getLabel(), "position [m]");
+    EXPECT_EQ(SignalRegistry::size(), entries + 1);
+  }
+  EXPECT_EQ(SignalRegistry::size(), entries);
+}
+
+TEST(controlSignalTest, ids) {
+  Signal<> a, b;
+  EXPECT_NE(a.getId(), b.getId());
+  EXPECT_EQ(a.getId() & 0xffff, 0u);
+  a.setName("a");
+  EXPECT_NE(a.getId(), b.getId());
+}
+
+TEST(controlSignalTest, copy) {
+  std::size_t entries = SignalRegistry::size();
+  Signal<> s;
+  s.setName("velocity");
+  s.setValue(1.5);
+  s.setTimestamp(42);
+  {
+    Signal<> c = s;
+    EXPECT_EQ(c.getValue(), 1.5);
+    EXPECT_EQ(c.getTimestamp(), 42u);
+    EXPECT_EQ(c.getId(), s.getId());
+    EXPECT_EQ(c.getName(), "velocity");
+    EXPECT_EQ(SignalRegistry::size(), entries + 1);
+    c.setName("copy");
+    EXPECT_NE(c.getId(), s.getId());
+    EXPECT_EQ(c.getName(), "copy");
+    EXPECT_EQ(s.getName(), "velocity");
+    EXPECT_EQ(SignalRegistry::size(), entries + 2);
+  }
+  EXPECT_EQ(SignalRegistry::size(), entries + 1);
+  Signal<> t;
+  t = s;
+  EXPECT_EQ(t.getValue(), 1.5);
+  EXPECT_EQ(t.getName(), "");
+}
+
+TEST(controlSignalTest, copyWithoutName) {
+  std::size_t entries = SignalRegistry::size();
+  Signal<> s;
+  Signal<> c(s);
+  EXPECT_EQ(c.getId(), s.getId());
+  s.setName("original");
+  EXPECT_EQ(c.getName(), "original");
+  c.setName("copy");
+  EXPECT_NE(c.getId(), s.getId());
+  EXPECT_EQ(c.getName(), "copy");
+  EXPECT_EQ(s.getName(), "original");
+  EXPECT_EQ(SignalRegistry::size(), entries + 2);
+}
+
+TEST(controlSignalTest, copyOutlivesOriginal) {
+  std::size_t entries = SignalRegistry::size();
+  std::unique_ptr<Signal<>> s(new Signal<>());
+  s->setName("force");
+  s->setUnit("N");
+  Signal<> c(*s);
+  Signal<> d(*s);
+  EXPECT_EQ(c.getLabel(), "force [N]");
+  d.setName("torque");
+  EXPECT_EQ(d.getLabel(), "torque [N]");
+  EXPECT_EQ(SignalRegistry::size(), entries + 2);
+  s.reset();
+  EXPECT_EQ(c.getName(), "");
+  EXPECT_EQ(c.getUnit(), "");
+  EXPECT_EQ(d.getLabel(), "torque [N]");
+  EXPECT_EQ(SignalRegistry::size(), entries + 1);
+  c.setName("force");
+  EXPECT_EQ(c.getName(), "force");
+  EXPECT_EQ(SignalRegistry::size(), entries + 2);
+}
+
+TEST(controlSignalTest, outputSource) {
+  Output<> o;
+  EXPECT_EQ(o.getSourceBlock(), nullptr);
+  Gain<> g(2.0);
+  EXPECT_EQ(g.getOut().getSourceBlock(), &g);
+  g.getOut().getSignal().setName("gain");
+  EXPECT_EQ(g.getOut().getSourceBlock(), &g);
+  EXPECT_EQ(g.getOut().getSignal().getName(), "gain");
+  EXPECT_TRUE(std::isnan(g.getOut().getSignal().getValue()));
+}
@@ -28,3 +28,72 @@ TEST(controlSocketDataTest, alloc) {
   SocketData<Vector2, std::nullptr_t> s8("192.168.1.1", 9876);
   SocketData<std::nullptr_t, Vector2> s9("192.168.1.1", 9876);
 }
+
+// Test schema of frames
+TEST(controlSocketDataTest, frameSchema) {
+  EXPECT_EQ((frameSchemaHash<Vector2>()), (frameSchemaHash<Matrix<2,1,double>>()));
+  EXPECT_EQ((frameSchemaHash<double>()), (frameSchemaHash<Matrix<1,1,double>>()));
+  EXPECT_NE((frameSchemaHash<Vector2>()), (frameSchemaHash<Vector3>()));
+  EXPECT_NE((frameSchemaHash<Vector2>()), (frameSchemaHash<Matrix<2,1,float>>()));
+  EXPECT_NE((frameSchemaHash<Matrix<2,1,int>>()), (frameSchemaHash<Matrix<2,1,unsigned int>>()));
+  EXPECT_NE((frameSchemaHash<bool>()), (frameSchemaHash<uint8_t>()));
+}
+
+// Test transfer of frames with sequence numbers
+TEST(controlSocketDataTest, frameTransfer) {
+  int fd[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fd), 0);
+  FrameBuffer<Vector2> tx, rx;
+  tx.data() = Vector2{1.5, -2.5};
+  tx.publish(100);
+  EXPECT_TRUE(tx.send(fd[0]));
+  EXPECT_TRUE(rx.receive(fd[1], 0.1));
+  EXPECT_TRUE(rx.newData);
+  const Frame<Vector2>& f = rx.latest();
+  EXPECT_EQ(f.header.sequence, 1);
+  EXPECT_EQ(f.header.timestamp, 100);
+  EXPECT_EQ(f.data, (Vector2{1.5, -2.5}));
+
+  rx.newData = false;
+  EXPECT_TRUE(tx.send(fd[0]));
+  EXPECT_TRUE(rx.receive(fd[1], 0.1));
+  EXPECT_FALSE(rx.newData);
+  EXPECT_EQ(rx.stale, 1);
+
+  for (int i = 0; i < 3; i++) {
+    tx.data() = Vector2{1.0 * i, 0.0};
+    tx.publish(200 + i);
+  }
+  EXPECT_TRUE(tx.send(fd[0]));
+  EXPECT_TRUE(rx.receive(fd[1], 0.1));
+  EXPECT_TRUE(rx.newData);
+  EXPECT_EQ(rx.lost, 2);
+  EXPECT_EQ(rx.latest().header.sequence, 4);
+  EXPECT_EQ(rx.latest().data, (Vector2{2.0, 0.0}));
+
+  rx.clear();
+  EXPECT_EQ(rx.latest().header.sequence, 0);
+  EXPECT_EQ(rx.latest().data, (Vector2{0.0, 0.0}));
+  close(fd[0]);
+  close(fd[1]);
+}
+
+// Test rejection of frames with wrong schema and incomplete frames
+TEST(controlSocketDataTest, frameInvalid) {
+  int fd[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fd), 0);
+  FrameBuffer<Matrix<2,1,float>> tx;
+  FrameBuffer<Vector2> rx;
+  tx.publish(0);
+  EXPECT_TRUE(tx.send(fd[0]));
+  EXPECT_FALSE(rx.receive(fd[1], 0.1));
+  EXPECT_EQ(rx.invalid, 1);
+  EXPECT_FALSE(rx.newData);
+
+  FrameHeader header = {frameMagic, frameSchemaHash<Vector2>(), 1, 0};
+  EXPECT_EQ(write(fd[0], &header, sizeof(header)), (ssize_t)sizeof(header));
+  EXPECT_FALSE(rx.receive(fd[1], 0.05));
+  EXPECT_FALSE(rx.newData);
+  close(fd[0]);
+  close(fd[1]);
+}
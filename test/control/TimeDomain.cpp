@@ -0,0 +1,312 @@
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/Sum.hpp>
+#include <eeros/control/I.hpp>
+#include <eeros/control/FaultStatus.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/logger/Logger.hpp>
+#include <eeros/safety/SafetySystem.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+using namespace eeros;
+using namespace eeros::control;
+
+namespace {
+
+// one axis: constant -> gain -> gain
+struct Axis {
+  Axis() : g1(2.0), g2(3.0) {
+    g1.getIn().connect(c.getOut());
+    g2.getIn().connect(g1.getOut());
+  }
+  void addTo(TimeDomain& td) {
+    td.addBlock(c);
+    td.addBlock(g1);
+    td.addBlock(g2);
+  }
+  Constant<> c;
+  Gain<> g1, g2;
+};
+
+class FaultProperties : public safety::SafetyProperties {
+ public:
+  FaultProperties() : fault("fault"), running("running"), stopped("stopped") {
+    addLevel(running);
+    addLevel(stopped);
+    running.addEvent(fault, stopped, safety::kPublicEvent);
+    setEntryLevel(running);
+  }
+  safety::SafetyEvent fault;
+  safety::SafetyLevel running, stopped;
+};
+
+}
+
+TEST(controlTimeDomainTest, serialByDefault) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  axes[0].c.setValue(1);
+  axes[1].c.setValue(2);
+  for (auto& a : axes) a.addTo(td);
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 1u);
+  EXPECT_DOUBLE_EQ(axes[0].g2.getOut().getSignal().getValue(), 6.0);
+  EXPECT_DOUBLE_EQ(axes[1].g2.getOut().getSignal().getValue(), 12.0);
+}
+
+TEST(controlTimeDomainTest, independentAxes) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[6];
+  for (int i = 0; i < 6; i++) axes[i].c.setValue(i + 1);
+  for (auto& a : axes) a.addTo(td);
+  td.setParallel(3);
+  for (int k = 1; k <= 100; k++) {
+    for (int i = 0; i < 6; i++) axes[i].c.setValue(k * (i + 1));
+    td.run();
+    for (int i = 0; i < 6; i++) {
+      EXPECT_DOUBLE_EQ(axes[i].g2.getOut().getSignal().getValue(), 6.0 * k * (i + 1));
+    }
+  }
+  EXPECT_EQ(td.getParallelGroups(), 3u);
+}
+
+TEST(controlTimeDomainTest, connectedAxesStayTogether) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[3];
+  for (int i = 0; i < 3; i++) axes[i].c.setValue(i + 1);
+  for (auto& a : axes) a.addTo(td);
+  Sum<2> sum;
+  sum.getIn(0).connect(axes[0].g2.getOut());
+  sum.getIn(1).connect(axes[1].g2.getOut());
+  td.addBlock(sum);
+  td.setParallel(4);
+  for (int k = 0; k < 10; k++) {
+    td.run();
+    EXPECT_DOUBLE_EQ(sum.getOut().getSignal().getValue(), 18.0);
+    EXPECT_DOUBLE_EQ(axes[2].g2.getOut().getSignal().getValue(), 18.0);
+  }
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+  td.removeBlock(sum);
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 3u);
+}
+
+TEST(controlTimeDomainTest, unknownRunnableRunsSerially) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  class Counter : public Runnable {
+   public:
+    void run() { count++; }
+    int count = 0;
+  } counter;
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  axes[0].c.setValue(1);
+  axes[1].c.setValue(2);
+  for (auto& a : axes) a.addTo(td);
+  td.addBlock(counter);
+  td.setParallel(2);
+  td.run();
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 1u);
+  EXPECT_EQ(counter.count, 2);
+  EXPECT_DOUBLE_EQ(axes[1].g2.getOut().getSignal().getValue(), 12.0);
+}
+
+TEST(controlTimeDomainTest, inputWithoutOwnerRunsSerially) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  // reads from an input which is not registered at the block
+  class Reader : public Block {
+   public:
+    void run() { value = in.getSignal().getValue(); }
+    Input<> in;
+    double value = 0;
+  };
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  axes[0].c.setValue(1);
+  axes[1].c.setValue(2);
+  for (auto& a : axes) a.addTo(td);
+  unsigned int unowned = InputBase::getConnectedWithoutOwner();
+  {
+    Reader reader;
+    reader.in.connect(axes[0].g2.getOut());
+    EXPECT_EQ(InputBase::getConnectedWithoutOwner(), unowned + 1);
+    td.addBlock(reader);
+    td.setParallel(2);
+    td.run();
+    EXPECT_EQ(td.getParallelGroups(), 1u);
+    EXPECT_DOUBLE_EQ(reader.value, 6.0);
+    td.removeBlock(reader);
+  }
+  EXPECT_EQ(InputBase::getConnectedWithoutOwner(), unowned);
+  td.partition();
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+}
+
+TEST(controlTimeDomainTest, inputWithoutOwnerInOtherTimeDomain) {
+  Input<> in;
+  Axis other;
+  in.connect(other.g2.getOut());
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  for (auto& a : axes) a.addTo(td);
+  td.setParallel(2);
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+}
+
+TEST(controlTimeDomainTest, partitionedOutsideTheCycle) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  axes[0].c.setValue(1);
+  axes[1].c.setValue(2);
+  for (auto& a : axes) a.addTo(td);
+  td.setParallel(2);
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+  Sum<2> sum;
+  td.addBlock(sum);
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+  sum.getIn(0).connect(axes[0].g2.getOut());
+  sum.getIn(1).connect(axes[1].g2.getOut());
+  EXPECT_EQ(td.getParallelGroups(), 2u);   // connections made later are not followed
+  td.partition();
+  EXPECT_EQ(td.getParallelGroups(), 1u);
+  td.run();
+  EXPECT_DOUBLE_EQ(sum.getOut().getSignal().getValue(), 18.0);
+}
+
+TEST(controlTimeDomainTest, workersSleepBetweenCycles) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[4];
+  for (auto& a : axes) a.addTo(td);
+  td.setParallel(4);
+  td.run();
+  ASSERT_EQ(td.getParallelGroups(), 4u);
+  auto cpuTime = [] {
+    timespec t;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec / 1.0e9;
+  };
+  double before = cpuTime();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_LT(cpuTime() - before, 0.05);   // three spinning workers would use 0.6 s
+  td.run();
+}
+
+TEST(controlTimeDomainTest, faultInWorker) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  axes[0].c.setValue(1);
+  axes[1].c.setValue(2);
+  for (auto& a : axes) a.addTo(td);
+  Gain<> g;
+  g.setName("g");
+  td.addBlock(g);
+  td.setParallel(3);
+  try {
+    td.run();
+    FAIL();
+  } catch (eeros::Fault const& e) {
+    EXPECT_EQ(e.what(), std::string("Read from an unconnected input in block 'g', time domain cannot trigger safety event"));
+  }
+  td.removeBlock(g);
+  td.run();
+  EXPECT_EQ(td.getParallelGroups(), 2u);
+}
+
+TEST(controlTimeDomainTest, faultStatus) {
+  FaultStatus status;
+  Gain<> g;
+  g.setName("g");
+  {
+    FaultStatus::Scope scope(status);
+    g.run();
+  }
+  EXPECT_EQ(status.get(), static_cast<uint32_t>(FaultCode::notConnected));
+  EXPECT_EQ(status.getMessage(), std::string("Read from an unconnected input in block 'g'"));
+  status.clear();
+  EXPECT_EQ(status.get(), 0u);
+  EXPECT_THROW(g.run(), NotConnectedFault);
+}
+
+TEST(controlTimeDomainTest, faultHoldsInput) {
+  FaultStatus status;
+  FaultStatus::Scope scope(status);
+  Constant<> c(2.0);
+  I<> i;
+  i.getIn().connect(c.getOut());
+  i.setInitCondition(0.0);
+  i.enable();
+  auto cycle = [&](uint64_t t) {
+    System::Cycle cycle(t);
+    c.run();
+    i.run();
+  };
+  cycle(1000000000);
+  cycle(1100000000);
+  EXPECT_NEAR(i.getOut().getSignal().getValue(), 0.2, 1e-12);
+  i.getIn().disconnect();
+  cycle(1200000000);
+  cycle(1300000000);
+  EXPECT_EQ(status.get(), static_cast<uint32_t>(FaultCode::notConnected));
+  EXPECT_NEAR(i.getOut().getSignal().getValue(), 0.2, 1e-12);  // state kept, no NaN
+  status.clear();
+  i.getIn().connect(c.getOut());
+  cycle(1400000000);
+  cycle(1500000000);
+  EXPECT_EQ(status.get(), 0u);
+  EXPECT_NEAR(i.getOut().getSignal().getValue(), 1.0, 1e-12);  // recovered, integrates from the held timestamp
+}
+
+TEST(controlTimeDomainTest, faultTriggersSafetyEvent) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  FaultProperties sp;
+  safety::SafetySystem ss(sp, 1);
+  TimeDomain td("td", 0.001, false);
+  Gain<> g;
+  g.setName("g");
+  Axis axis;
+  axis.c.setValue(1);
+  td.addBlock(g);
+  axis.addTo(td);
+  td.registerSafetyEvent(ss, sp.fault);
+  td.run();
+  EXPECT_DOUBLE_EQ(axis.g2.getOut().getSignal().getValue(), 6.0);  // cycle completes
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.stopped);
+}
+
+TEST(controlTimeDomainTest, cycleTime) {
+  TimeDomain td("td", 0.001, false);
+  Axis axes[2];
+  for (auto& a : axes) a.addTo(td);
+  td.run();
+  uint64_t t = axes[0].c.getOut().getSignal().getTimestamp();
+  EXPECT_EQ(axes[1].c.getOut().getSignal().getTimestamp(), t);
+  td.setParallel(2);
+  td.run();
+  ASSERT_EQ(td.getParallelGroups(), 2u);
+  EXPECT_GT(axes[0].c.getOut().getSignal().getTimestamp(), t);
+  EXPECT_EQ(axes[1].c.getOut().getSignal().getTimestamp(), axes[0].c.getOut().getSignal().getTimestamp());
+}
+
+TEST(controlTimeDomainTest, cycleScope) {
+  uint64_t before = System::getCycleTimeNs();
+  {
+    System::Cycle outer(1000);
+    EXPECT_EQ(System::getCycleTimeNs(), 1000u);
+    {
+      System::Cycle inner(2000);
+      EXPECT_EQ(System::getCycleTimeNs(), 2000u);
+    }
+    EXPECT_EQ(System::getCycleTimeNs(), 1000u);
+  }
+  EXPECT_GE(System::getCycleTimeNs(), before);
+  EXPECT_NE(System::getCycleTimeNs(), 1000u);
+}
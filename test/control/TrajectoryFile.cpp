@@ -0,0 +1,120 @@
+#include <eeros/control/TrajectoryFile.hpp>
+#include <eeros/core/Fault.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace eeros;
+using namespace eeros::control;
+
+// Test reading the text format
+TEST(controlTrajectoryFileTest, text) {
+  TrajectoryFile f("path1.txt");
+  EXPECT_FALSE(f.isMapped());
+  ASSERT_EQ(f.size(), 9u);
+  EXPECT_DOUBLE_EQ(f[0].duration, 0.08);
+  EXPECT_DOUBLE_EQ(f[0].end, 0.08);
+  EXPECT_DOUBLE_EQ(f[1].jerk, 10000);
+  EXPECT_DOUBLE_EQ(f[1].end, 0.32);
+  EXPECT_DOUBLE_EQ(f[2].acc, 2400);
+  EXPECT_DOUBLE_EQ(f[2].vel, 288);
+  EXPECT_DOUBLE_EQ(f[2].pos, 23.04);
+  EXPECT_THROW(TrajectoryFile("missing.txt"), Fault);
+}
+
+// Test converting to the binary format and mapping it
+TEST(controlTrajectoryFileTest, binary) {
+  TrajectoryFile t("path1.txt");
+  EXPECT_EQ(TrajectoryFile::convert("path1.txt", "path1.bin"), 9u);
+  TrajectoryFile b("path1.bin");
+  EXPECT_TRUE(b.isMapped());
+  ASSERT_EQ(b.size(), t.size());
+  for (std::size_t i = 0; i < t.size(); i++) {
+    EXPECT_EQ(b[i].duration, t[i].duration);
+    EXPECT_EQ(b[i].jerk, t[i].jerk);
+    EXPECT_EQ(b[i].acc, t[i].acc);
+    EXPECT_EQ(b[i].vel, t[i].vel);
+    EXPECT_EQ(b[i].pos, t[i].pos);
+    EXPECT_EQ(b[i].end, t[i].end);
+  }
+  std::remove("path1.bin");
+}
+
+// Test that corrupt binary files are rejected
+TEST(controlTrajectoryFileTest, corrupt) {
+  TrajectoryFile::convert("path1.txt", "corrupt.bin");
+  {
+    std::fstream file("corrupt.bin", std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(100);
+    file.put(0x55);
+  }
+  try {
+    TrajectoryFile f("corrupt.bin");
+    FAIL();
+  } catch (Fault const& e) {
+    EXPECT_EQ(e.what(), std::string("Trajectory file 'corrupt.bin' has a wrong checksum"));
+  }
+  TrajectoryFile::convert("path1.txt", "corrupt.bin");
+  {
+    std::ifstream in("corrupt.bin", std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ofstream out("corrupt.bin", std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size() - 8);
+  }
+  EXPECT_THROW(TrajectoryFile("corrupt.bin"), Fault);
+  std::remove("corrupt.bin");
+}
+
+namespace {
+
+// number of mappings of a file in this process
+int mappings(const std::string& filename) {
+  std::ifstream maps("/proc/self/maps");
+  std::string line;
+  int n = 0;
+  while (std::getline(maps, line)) {
+    if (line.size() >= filename.size() && line.compare(line.size() - filename.size(), filename.size(), filename) == 0) n++;
+  }
+  return n;
+}
+
+}
+
+// Test that a rejected binary file is unmapped
+TEST(controlTrajectoryFileTest, noMappingOnFailure) {
+  TrajectoryFile::convert("path1.txt", "unmapped.bin");
+  {
+    TrajectoryFile f("unmapped.bin");
+    EXPECT_EQ(mappings("/unmapped.bin"), 1);
+  }
+  EXPECT_EQ(mappings("/unmapped.bin"), 0);
+  {
+    std::fstream file("unmapped.bin", std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(100);
+    file.put(0x55);
+  }
+  for (int i = 0; i < 3; i++) EXPECT_THROW(TrajectoryFile("unmapped.bin"), Fault);  // checksum
+  EXPECT_EQ(mappings("/unmapped.bin"), 0);
+  {
+    std::fstream file("unmapped.bin", std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(8);
+    file.put(0x7f);
+  }
+  EXPECT_THROW(TrajectoryFile("unmapped.bin"), Fault);  // version
+  EXPECT_EQ(mappings("/unmapped.bin"), 0);
+  std::remove("unmapped.bin");
+}
+
+// Test the segment lookup
+TEST(controlTrajectoryFileTest, find) {
+  TrajectoryFile f("path1.txt");
+  EXPECT_EQ(f.find(-1), 0u);
+  EXPECT_EQ(f.find(0), 0u);
+  EXPECT_EQ(f.find(0.08), 0u);
+  EXPECT_EQ(f.find(0.1), 1u);
+  EXPECT_EQ(f.find(0.3), 1u);
+  EXPECT_EQ(f.find(0.33), 2u);
+  EXPECT_EQ(f.find(f[8].end), 8u);
+  EXPECT_EQ(f.find(f[8].end + 1), 9u);
+}
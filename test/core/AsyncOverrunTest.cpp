@@ -0,0 +1,91 @@
+#include <eeros/task/Async.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace eeros;
+
+namespace {
+
+// activates a task which runs 20 ms every 5 ms, the first activation starts an overrun streak
+int activate(task::Async& async, std::atomic<int>& runs, int activations) {
+	for (int i = 0; i < activations; i++) {
+		async.run();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(25 * activations));
+	return runs;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	std::cout << "Async overrun test started" << std::endl;
+	logger::Logger::setDefaultStreamLogger(std::cout);
+	
+	int error = 0;
+	std::atomic<int> runs(0);
+	task::Lambda slow([&]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		runs++;
+	});
+	
+	{
+		task::Async async(slow);
+		int n = activate(async, runs, 8);
+		std::cout << "  coalesce: " << n << " runs, " << async.getOverrunCount() << " overruns, " 
+		          << async.getSkippedCount() << " skipped" << std::endl;
+		if (async.getOverrunCount() == 0 || async.getSkippedCount() == 0) {
+			std::cout << "  -> Failure: overruns not detected" << std::endl;
+			error++;
+		}
+		if (n + (int)async.getSkippedCount() != 8) {
+			std::cout << "  -> Failure: runs and skipped activations do not add up to 8" << std::endl;
+			error++;
+		}
+		if (async.counter.latency.count != n) {
+			std::cout << "  -> Failure: wake latency measured " << async.counter.latency.count << " times" << std::endl;
+			error++;
+		}
+	}
+	
+	runs = 0;
+	{
+		task::Async async(slow);
+		async.setOverrunPolicy(task::OverrunPolicy::queue);
+		int n = activate(async, runs, 8);
+		std::cout << "  queue: " << n << " runs, " << async.getOverrunCount() << " overruns, " 
+		          << async.getSkippedCount() << " skipped" << std::endl;
+		if (n != 8 || async.getSkippedCount() != 0) {
+			std::cout << "  -> Failure: queued activations lost" << std::endl;
+			error++;
+		}
+		if (async.getOverrunCount() == 0) {
+			std::cout << "  -> Failure: overruns not detected" << std::endl;
+			error++;
+		}
+	}
+	
+	runs = 0;
+	{
+		task::Lambda fast([&]() { runs++; });
+		task::Async async(fast);
+		for (int i = 0; i < 20; i++) {
+			async.run();
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		std::cout << "  no overrun: " << runs << " runs, mean wake latency " << async.counter.latency.mean << " s" << std::endl;
+		if (runs != 20 || async.getOverrunCount() != 0) {
+			std::cout << "  -> Failure: unexpected overruns" << std::endl;
+			error++;
+		}
+	}
+	
+	std::cout << "Async overrun test finished with " << error << " error(s)" << std::endl;
+	return error;
+}
@@ -0,0 +1,54 @@
+#include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/task/Periodic.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+
+#include <iostream>
+#include <vector>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "Harmonic rounding test started" << std::endl;
+	logger::Logger::setDefaultStreamLogger(std::cout);
+	
+	int error = 0;
+	std::vector<uint64_t> times;
+	
+	Executor& executor = Executor::instance();
+	executor.useSimulatedTime(0.43);
+	
+	task::Lambda mainLambda;
+	task::Periodic mainTask("main", 0.001, mainLambda);
+	executor.setMainTask(mainTask);
+	
+	// 0.043 / 0.001 evaluates to 42.99999999999999, the number of base periods
+	// is rounded to the nearest integer and not truncated to 42
+	task::Lambda lambda([&]() { times.push_back(System::getTimeNs()); });
+	task::Periodic task("t43", 0.043, lambda);
+	executor.add(task);
+	
+	try {
+		executor.run();
+	} catch (std::exception& e) {
+		std::cout << "  -> Failure: " << e.what() << std::endl;
+		error++;
+	}
+	
+	if (times.size() != 10) {
+		std::cout << "  -> Failure: harmonic task ran " << times.size() << " times instead of 10" << std::endl;
+		error++;
+	}
+	for (std::size_t i = 1; i < times.size(); i++) {
+		if (times[i] - times[i - 1] != 43000000) {
+			std::cout << "  -> Failure: harmonic task period is " << times[i] - times[i - 1] << " ns" << std::endl;
+			error++;
+			break;
+		}
+	}
+	
+	if (error == 0) std::cout << "Harmonic rounding test succeeded" << std::endl;
+	else std::cout << "Harmonic rounding test failed with " << error << " error(s)" << std::endl;
+	return error;
+}
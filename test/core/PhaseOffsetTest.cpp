@@ -0,0 +1,75 @@
+#include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/task/Periodic.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "Phase offset test started" << std::endl;
+	logger::Logger::setDefaultStreamLogger(std::cout);
+	
+	int error = 0;
+	std::map<uint64_t, int> activations;	// number of harmonic tasks run per base tick
+	std::vector<uint64_t> fixedTicks;
+	auto tick = []() { return System::getTimeNs() / 1000000 - 1; };
+	
+	Executor& executor = Executor::instance();
+	executor.useSimulatedTime(1.0);
+	executor.useAutoPhase();
+	
+	task::Lambda mainLambda;
+	task::Periodic mainTask("main", 0.001, mainLambda);
+	executor.setMainTask(mainTask);
+	
+	task::Lambda l2([&]() { activations[tick()]++; });
+	task::Lambda l4([&]() { activations[tick()]++; });
+	task::Lambda l10([&]() { activations[tick()]++; });
+	task::Lambda l5([&]() { fixedTicks.push_back(tick()); });
+	task::Periodic t2("t2", 0.002, l2);
+	task::Periodic t4("t4", 0.004, l4);
+	task::Periodic t10("t10", 0.010, l10);
+	task::Periodic t5("t5", 0.005, l5);
+	t5.setPhase(3);
+	t5.setExpectedRunTime(1e-9);
+	executor.add(t2);
+	executor.add(t4);
+	executor.add(t10);
+	executor.add(t5);
+	executor.run();
+	
+	int peak = 0, runs = 0;
+	for (auto& a: activations) {
+		peak = std::max(peak, a.second);
+		runs += a.second;
+	}
+	std::cout << "  " << runs << " activations, at most " << peak << " per base tick" << std::endl;
+	if (runs != 500 + 250 + 100) {
+		std::cout << "  -> Failure: harmonic tasks ran " << runs << " times instead of 850" << std::endl;
+		error++;
+	}
+	if (peak > 2) {
+		std::cout << "  -> Failure: activations not spread, " << peak << " tasks on the same base tick" << std::endl;
+		error++;
+	}
+	for (auto t: fixedTicks) {
+		if ((t + 1) % 5 != 3) {
+			std::cout << "  -> Failure: periodic with fixed phase 3 ran on tick " << t << std::endl;
+			error++;
+			break;
+		}
+	}
+	if (fixedTicks.size() != 200) {
+		std::cout << "  -> Failure: periodic with fixed phase ran " << fixedTicks.size() << " times instead of 200" << std::endl;
+		error++;
+	}
+	
+	if (error == 0) std::cout << "Phase offset test succeeded" << std::endl;
+	else std::cout << "Phase offset test failed with " << error << " error(s)" << std::endl;
+	return error;
+}
@@ -0,0 +1,64 @@
+#include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/task/Periodic.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "Simulated executor test started" << std::endl;
+	logger::Logger::setDefaultStreamLogger(std::cout);
+	
+	int error = 0;
+	int mainCount = 0, slowCount = 0;
+	std::vector<uint64_t> slowTimes;
+	
+	Executor& executor = Executor::instance();
+	executor.useSimulatedTime(10.0);
+	
+	task::Lambda mainLambda([&]() { mainCount++; });
+	task::Periodic mainTask("main", 0.001, mainLambda);
+	executor.setMainTask(mainTask);
+	
+	task::Lambda slowLambda([&]() { slowCount++; slowTimes.push_back(System::getTimeNs()); });
+	task::Periodic slowTask("slow", 0.01, slowLambda);
+	executor.add(slowTask);
+	
+	auto start = std::chrono::steady_clock::now();
+	executor.run();
+	double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	
+	std::cout << "  10 s simulated in " << wallTime << " s" << std::endl;
+	if (mainCount != 10000) {
+		std::cout << "  -> Failure: main task ran " << mainCount << " times instead of 10000" << std::endl;
+		error++;
+	}
+	if (slowCount != 1000) {
+		std::cout << "  -> Failure: harmonic task ran " << slowCount << " times instead of 1000" << std::endl;
+		error++;
+	}
+	for (std::size_t i = 1; i < slowTimes.size(); i++) {
+		if (slowTimes[i] - slowTimes[i - 1] != 10000000) {
+			std::cout << "  -> Failure: harmonic task period is " << slowTimes[i] - slowTimes[i - 1] << " ns" << std::endl;
+			error++;
+			break;
+		}
+	}
+	if (System::getTimeNs() != 10000000000ull) {
+		std::cout << "  -> Failure: simulated time is " << System::getTimeNs() << " ns instead of 10 s" << std::endl;
+		error++;
+	}
+	if (wallTime > 5.0) {
+		std::cout << "  -> Failure: simulation did not run faster than realtime" << std::endl;
+		error++;
+	}
+	
+	if (error == 0) std::cout << "Simulated executor test succeeded" << std::endl;
+	else std::cout << "Simulated executor test failed with " << error << " error(s)" << std::endl;
+	return error;
+}
@@ -0,0 +1,117 @@
+#include <eeros/core/Watchdog.hpp>
+#include <eeros/task/Async.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace eeros;
+
+namespace {
+
+// output which records the values set by the watchdog
+class EnableOutput : public hal::Output<bool> {
+ public:
+	EnableOutput() : hal::Output<bool>("enable", nullptr), value(true), sets(0) { safe = false; }
+	virtual bool get() { return value; }
+	virtual void set(bool v) { value = v; sets++; }
+	std::atomic<bool> value;
+	std::atomic<int> sets;
+};
+
+// kicks a heartbeat every ms for the given time
+void kick(Watchdog::Heartbeat& hb, int ms) {
+	for (int i = 0; i < ms; i++) {
+		hb.kick();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+}
+
+int main(int argc, char* argv[]) {
+	std::cout << "Watchdog test started" << std::endl;
+	logger::Logger::setDefaultStreamLogger(std::cout);
+
+	int error = 0;
+	{
+		Watchdog watchdog(20);
+		EnableOutput enable;
+		watchdog.addSafeOutput(enable);
+		Watchdog::Heartbeat& hb = watchdog.add("control", 0.001, 5);
+		Watchdog::Heartbeat& idle = watchdog.add("idle", 0.001, 5);
+
+		kick(hb, 100);
+		if (watchdog.getMissCount() != 0 || !enable.value) {
+			std::cout << "  -> Failure: miss detected while kicking" << std::endl;
+			error++;
+		}
+
+		// task hangs
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		Statistics latency = watchdog.getDetectionLatency();
+		std::cout << "  hang: " << hb.getMissCount() << " miss(es), detection latency " << latency.max << " s" << std::endl;
+		if (hb.getMissCount() != 1 || !hb.isMissing()) {
+			std::cout << "  -> Failure: hang detected " << hb.getMissCount() << " times" << std::endl;
+			error++;
+		}
+		if (enable.value || enable.sets != 1) {
+			std::cout << "  -> Failure: output not set to its safe value once" << std::endl;
+			error++;
+		}
+		if (latency.count != 1 || latency.max < 0 || latency.max > 0.02) {
+			std::cout << "  -> Failure: detection latency not bounded" << std::endl;
+			error++;
+		}
+		if (idle.getMissCount() != 0) {
+			std::cout << "  -> Failure: heartbeat missed before its first kick" << std::endl;
+			error++;
+		}
+
+		// task recovers
+		kick(hb, 20);
+		if (hb.isMissing() || hb.getMissCount() != 1) {
+			std::cout << "  -> Failure: heartbeat did not recover" << std::endl;
+			error++;
+		}
+		hb.disarm();
+		std::this_thread::sleep_for(std::chrono::milliseconds(30));
+		if (hb.getMissCount() != 1) {
+			std::cout << "  -> Failure: disarmed heartbeat missed" << std::endl;
+			error++;
+		}
+	}
+
+	{
+		// second activation of an async task blocks
+		Watchdog watchdog(20);
+		std::atomic<int> runs(0);
+		std::atomic<bool> hang(false);
+		task::Lambda driver([&]() {
+			runs++;
+			while (hang) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		});
+		task::Async async(driver);
+		Watchdog::Heartbeat& hb = watchdog.add("driver", 0.002, 3);
+		async.setHeartbeat(hb);
+		for (int i = 0; i < 50; i++) {
+			if (i == 25) hang = true;
+			async.run();
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		std::cout << "  async: " << runs << " runs, " << hb.getMissCount() << " miss(es)" << std::endl;
+		if (hb.getMissCount() != 1 || !hb.isMissing()) {
+			std::cout << "  -> Failure: hanging async task not detected" << std::endl;
+			error++;
+		}
+		hang = false;
+		async.stop();
+		async.join();
+	}
+
+	std::cout << "Watchdog test finished with " << error << " error(s)" << std::endl;
+	return error;
+}
@@ -0,0 +1,47 @@
+#include <eeros/hal/HAL.hpp>
+#include <eeros/core/Fault.hpp>
+#include <gtest/gtest.h>
+#include <dlfcn.h>
+
+using namespace eeros;
+using namespace eeros::hal;
+
+static int featureValue = 0;
+static InputInterface* featureObj = nullptr;
+
+extern "C" void halFeatureTestSet(InputInterface* obj, int value) {
+	featureObj = obj;
+	featureValue = value;
+}
+
+class FeatureTestInput : public Input<double> {
+public:
+	FeatureTestInput(std::string id, void* libHandle) : Input<double>(id, libHandle) { }
+	virtual double get() { return 0.0; }
+};
+
+static FeatureTestInput featureTestIn("halFeatureTestIn", dlopen(nullptr, RTLD_NOW));
+
+TEST(halFeatureTest, callFeatureHandle){
+	HAL& hal = HAL::instance();
+	auto setValue = hal.feature<void(int)>(&featureTestIn, "halFeatureTestSet");
+	EXPECT_TRUE(setValue.isValid());
+	setValue(5);
+	EXPECT_EQ(featureValue, 5);
+	EXPECT_EQ(featureObj, &featureTestIn);
+	hal.callInputFeature(&featureTestIn, "halFeatureTestSet", 7);
+	EXPECT_EQ(featureValue, 7);
+}
+
+TEST(halFeatureTest, invalidFeature){
+	HAL& hal = HAL::instance();
+	Feature<InputInterface, void(int)> f;
+	EXPECT_FALSE(f.isValid());
+	try{
+		hal.feature<void(int)>(&featureTestIn, "halFeatureTestUnknown");
+		FAIL();
+	}
+	catch(eeros::Fault const & err){
+		EXPECT_EQ(err.what(), std::string("could not find method in dynamic library: halFeatureTestUnknown"));
+	}
+}
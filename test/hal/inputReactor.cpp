@@ -0,0 +1,149 @@
+#include <eeros/hal/InputReactor.hpp>
+#include <eeros/hal/Mouse.hpp>
+#include <eeros/hal/SpaceNavigator.hpp>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+using namespace eeros;
+using namespace eeros::hal;
+
+class PipeDevice : public InputReactor::Device {
+ public:
+	PipeDevice(int fd) : fd(fd), bytes(0), drains(0) { }
+	virtual bool drain() {
+		drains++;
+		char buf[16];
+		while (true) {
+			ssize_t n = read(fd, buf, sizeof(buf));
+			if (n < 0) return true;
+			if (n == 0) return false;
+			bytes += n;
+		}
+	}
+	int fd;
+	std::atomic<int> bytes;
+	std::atomic<int> drains;
+};
+
+// waits up to one second for a condition set by the reactor thread
+template < typename F >
+bool waitFor(F condition) {
+	for (int i = 0; i < 1000; i++) {
+		if (condition()) return true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return condition();
+}
+
+class Fifo {
+ public:
+	Fifo(std::string path) : path(path) {
+		unlink(path.c_str());
+		mkfifo(path.c_str(), 0600);
+	}
+	~Fifo() {
+		if (fd >= 0) close(fd);
+		unlink(path.c_str());
+	}
+	void open() { fd = ::open(path.c_str(), O_WRONLY); }
+	void write(const void* data, size_t len) { EXPECT_EQ(::write(fd, data, len), (ssize_t)len); }
+	std::string path;
+	int fd = -1;
+};
+
+class halInputReactorTest : public ::testing::Test {
+ protected:
+	void SetUp() override {
+		std::cout.setstate(std::ios_base::badbit);
+		logger::Logger::setDefaultStreamLogger(std::cout);
+	}
+	void TearDown() override {
+		std::cout.clear();
+	}
+};
+
+TEST_F(halInputReactorTest, shared){
+	auto r1 = InputReactor::instance();
+	auto r2 = InputReactor::instance();
+	EXPECT_EQ(r1, r2);
+	EXPECT_EQ(r1->getDevices(), 0u);
+}
+
+TEST_F(halInputReactorTest, drain){
+	int p[2];
+	ASSERT_EQ(pipe2(p, O_NONBLOCK), 0);
+	PipeDevice d(p[0]);
+	auto r = InputReactor::instance();
+	r->add(p[0], &d);
+	EXPECT_EQ(r->getDevices(), 1u);
+	EXPECT_EQ(::write(p[1], "abc", 3), 3);
+	EXPECT_TRUE(waitFor([&]() { return d.bytes == 3; }));
+	EXPECT_EQ(::write(p[1], "0123456789012345678901234567890123456789", 40), 40);
+	EXPECT_TRUE(waitFor([&]() { return d.bytes == 43; }));
+	r->remove(p[0]);
+	EXPECT_EQ(r->getDevices(), 0u);
+	int drains = d.drains;
+	EXPECT_EQ(::write(p[1], "x", 1), 1);
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_EQ(d.drains, drains);
+	close(p[0]);
+	close(p[1]);
+}
+
+TEST_F(halInputReactorTest, removedAtEnd){
+	int p[2];
+	ASSERT_EQ(pipe2(p, O_NONBLOCK), 0);
+	PipeDevice d(p[0]);
+	auto r = InputReactor::instance();
+	r->add(p[0], &d);
+	close(p[1]);
+	EXPECT_TRUE(waitFor([&]() { return r->getDevices() == 0; }));
+	close(p[0]);
+}
+
+TEST_F(halInputReactorTest, mouse){
+	Fifo fifo("/tmp/eerosTestMouse");
+	Mouse mouse(fifo.path, 20);
+	fifo.open();
+	EXPECT_FALSE(mouse.update());
+	struct input_event e[4] = { };
+	e[0].type = EV_REL; e[0].code = REL_X; e[0].value = 5;
+	e[1].type = EV_REL; e[1].code = REL_X; e[1].value = 3;
+	e[2].type = EV_KEY; e[2].code = BTN_RIGHT; e[2].value = 1;
+	e[3].type = EV_SYN;
+	fifo.write(e, sizeof(e));
+	EXPECT_TRUE(waitFor([&]() { return mouse.update(); }));
+	EXPECT_EQ(mouse.getState().value.axis.x, 8);
+	EXPECT_TRUE(mouse.getState().value.button.right);
+	EXPECT_FALSE(mouse.getState().value.button.left);
+	EXPECT_TRUE(mouse.getButton(BTN_RIGHT));
+	EXPECT_FALSE(mouse.getButton(BTN_LEFT));
+	EXPECT_EQ(mouse.getState().sequence, 1u);
+}
+
+TEST_F(halInputReactorTest, spaceNavigatorRaw){
+	Fifo fifo("/tmp/eerosTestSpaceNav_raw");
+	SpaceNavigator sn(fifo.path);
+	fifo.open();
+	uint8_t position[14] = {0x01, 10, 0, 0xF6, 0xFF, 0, 0, 0x02, 1, 0, 2, 0, 3, 0};
+	fifo.write(position, 5);	// packets may arrive in pieces
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	EXPECT_FALSE(sn.update());
+	fifo.write(position + 5, 9);
+	EXPECT_TRUE(waitFor([&]() { return sn.update(); }));
+	EXPECT_EQ(sn.getState().value.axis[0], 10);
+	EXPECT_EQ(sn.getState().value.axis[1], -10);
+	EXPECT_EQ(sn.getState().value.rotAxis[2], 3);
+	uint8_t button[3] = {0x03, 0x02, 0x00};
+	fifo.write(button, 3);
+	EXPECT_TRUE(waitFor([&]() { return sn.update(); }));
+	EXPECT_FALSE(sn.getState().value.button[0]);
+	EXPECT_TRUE(sn.getState().value.button[1]);
+	EXPECT_TRUE(sn.getButton(SpaceNav::Button::R));
+}
@@ -0,0 +1,79 @@
+#include <eeros/hal/SampleBuffer.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <thread>
+
+using namespace eeros;
+using namespace eeros::hal;
+
+TEST(halSampleBufferTest, initial){
+	SampleBuffer<int> buf;
+	buf.fill(7);
+	EXPECT_FALSE(buf.update());
+	EXPECT_EQ(buf.get().value, 7);
+	EXPECT_EQ(buf.get().sequence, 0u);
+	EXPECT_EQ(buf.get().timestamp, 0u);
+}
+
+TEST(halSampleBufferTest, publish){
+	SampleBuffer<int> buf;
+	buf.back() = 1;
+	buf.publish(100);
+	EXPECT_TRUE(buf.update());
+	EXPECT_EQ(buf.get().value, 1);
+	EXPECT_EQ(buf.get().timestamp, 100u);
+	EXPECT_EQ(buf.get().sequence, 1u);
+	EXPECT_FALSE(buf.update());
+	EXPECT_EQ(buf.get().value, 1);
+	buf.publish(2, 200);
+	EXPECT_TRUE(buf.update());
+	EXPECT_EQ(buf.get().value, 2);
+	EXPECT_EQ(buf.get().sequence, 2u);
+	EXPECT_EQ(buf.getDropped(), 0u);
+}
+
+TEST(halSampleBufferTest, latestWins){
+	SampleBuffer<int> buf;
+	for (int i = 1; i <= 5; i++) buf.publish(i, i);
+	EXPECT_TRUE(buf.update());
+	EXPECT_EQ(buf.get().value, 5);
+	EXPECT_EQ(buf.get().sequence, 5u);
+	EXPECT_EQ(buf.getDropped(), 4u);
+	EXPECT_FALSE(buf.update());
+}
+
+// A producer thread writes scans whose elements all hold the sequence number,
+// the consumer must never see a scan mixing two sequence numbers
+TEST(halSampleBufferTest, noTornSamples){
+	using Scan = std::array<uint64_t, 1024>;
+	SampleBuffer<Scan> buf;
+	std::atomic<bool> done(false);
+	std::thread producer([&]() {
+		for (uint64_t s = 1; s <= 20000; s++) {
+			Scan& scan = buf.back();
+			for (auto& v : scan) v = s;
+			buf.publish(s);
+		}
+		done = true;
+	});
+	uint64_t last = 0, received = 0;
+	bool torn = false;
+	while (true) {
+		bool finished = done;
+		if (!buf.update()) {
+			if (finished) break;
+			continue;
+		}
+		auto& sample = buf.get();
+		for (auto v : sample.value) torn = torn || v != sample.sequence;
+		EXPECT_GT(sample.sequence, last);
+		EXPECT_EQ(sample.timestamp, sample.sequence);
+		last = sample.sequence;
+		received++;
+	}
+	producer.join();
+	EXPECT_FALSE(torn);
+	EXPECT_EQ(buf.get().sequence, 20000u);
+	EXPECT_EQ(received + buf.getDropped(), 20000u);
+}
@@ -0,0 +1,164 @@
+#include <eeros/hal/sim/Generator.hpp>
+#include <eeros/hal/sim/Channels.hpp>
+#include <eeros/hal/HAL.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/core/Fault.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include <dlfcn.h>
+
+using namespace eeros;
+using namespace eeros::hal;
+using namespace eeros::hal::sim;
+
+TEST(halSimGeneratorTest, constant){
+	Generator g0;
+	EXPECT_DOUBLE_EQ(g0.get(0), 0.0);
+	Generator g1("constant value=2.5");
+	EXPECT_DOUBLE_EQ(g1.get(0), 2.5);
+	EXPECT_DOUBLE_EQ(g1.get(1000000000), 2.5);
+}
+
+TEST(halSimGeneratorTest, sine){
+	Generator g("sine amplitude=2; frequency=1; offset=1");
+	EXPECT_NEAR(g.get(0), 1.0, 1e-12);
+	EXPECT_NEAR(g.get(250000000), 3.0, 1e-12);
+	EXPECT_NEAR(g.get(750000000), -1.0, 1e-12);
+}
+
+TEST(halSimGeneratorTest, square){
+	Generator g("square amplitude=1 frequency=10 duty=0.5");
+	EXPECT_DOUBLE_EQ(g.get(0), 1.0);
+	EXPECT_DOUBLE_EQ(g.get(40000000), 1.0);
+	EXPECT_DOUBLE_EQ(g.get(60000000), 0.0);
+	EXPECT_DOUBLE_EQ(g.get(110000000), 1.0);
+}
+
+TEST(halSimGeneratorTest, noiseIsReproducible){
+	Generator g1("noise mean=0 stddev=0.5 seed=7");
+	Generator g2("noise mean=0 stddev=0.5 seed=7");
+	for(int i = 0; i < 100; i++) EXPECT_DOUBLE_EQ(g1.get(i), g2.get(i));
+}
+
+TEST(halSimGeneratorTest, fileReplay){
+	std::string path = "/tmp/eerosSimGenerator.txt";
+	{
+		std::ofstream file(path);
+		file << "0.0 1.0\n0.1 2.0\n0.2 3.0\n";
+	}
+	Generator g("file path=" + path);
+	EXPECT_DOUBLE_EQ(g.get(0), 1.0);
+	EXPECT_DOUBLE_EQ(g.get(150000000), 2.0);
+	EXPECT_DOUBLE_EQ(g.get(500000000), 3.0);
+	EXPECT_DOUBLE_EQ(g.get(50000000), 1.0);
+	unlink(path.c_str());
+}
+
+TEST(halSimGeneratorTest, invalidConfig){
+	EXPECT_THROW(Generator("triangle"), eeros::Fault);
+	EXPECT_THROW(Generator("loopback delay=1"), eeros::Fault);
+	EXPECT_THROW(Generator("sine amplitude=abc"), eeros::Fault);
+}
+
+TEST(halSimChannelTest, loopback){
+	SimAnalogOut out("simLoopOut", nullptr, 1, 0, -10, 10, "V");
+	SimAnalogIn in("simLoopIn", nullptr, 1, 0, -10, 10, "V", "loopback source=simLoopOut");
+	out.set(4.5);
+	EXPECT_DOUBLE_EQ(in.get(), 4.5);
+	SimDigOut dout("simLoopDigOut", nullptr, false);
+	SimDigIn din("simLoopDigIn", nullptr, false, "loopback source=simLoopDigOut");
+	dout.set(true);
+	EXPECT_TRUE(din.get());
+	dout.set(false);
+	EXPECT_FALSE(din.get());
+}
+
+TEST(halSimChannelTest, delayedValue){
+	SimAnalogOut out("simDelayOut", nullptr, 1, 0, -10, 10, "V");
+	out.keepHistory(1000000000);
+	uint64_t before = System::getTimeNs();
+	out.set(1.0);
+	uint64_t between = System::getTimeNs();
+	while(System::getTimeNs() == between);
+	out.set(2.0);
+	EXPECT_DOUBLE_EQ(out.valueAt(before - 1), 0.0);
+	EXPECT_DOUBLE_EQ(out.valueAt(between), 1.0);
+	EXPECT_DOUBLE_EQ(out.valueAt(System::getTimeNs()), 2.0);
+}
+
+TEST(halSimChannelTest, historyWraps){
+	SimAnalogOut out("simWrapOut", nullptr, 1, 0, -1e6, 1e6, "V");
+	std::vector<uint64_t> times;
+	for (unsigned int i = 1; i <= 2 * SimOutput::historySize; i++) {
+		uint64_t t = System::getTimeNs();
+		while (System::getTimeNs() == t);
+		out.set(i);
+		times.push_back(System::getTimeNs());
+	}
+	EXPECT_DOUBLE_EQ(out.valueAt(times.back()), 2.0 * SimOutput::historySize);
+	EXPECT_DOUBLE_EQ(out.valueAt(times[SimOutput::historySize + 10]), SimOutput::historySize + 11.0);
+	EXPECT_DOUBLE_EQ(out.valueAt(0), SimOutput::historySize + 1.0);  // oldest kept
+}
+
+TEST(halSimChannelTest, readWhileWriting){
+	SimAnalogOut out("simConcurrentOut", nullptr, 1, 0, -1e9, 1e9, "V");
+	SimAnalogIn in("simConcurrentIn", nullptr, 1, 0, -1e9, 1e9, "V", "loopback source=simConcurrentOut");
+	std::atomic<bool> done(false);
+	std::thread writer([&]() {
+		for (int i = 1; i <= 200000; i++) out.set(i);
+		done = true;
+	});
+	double prev = 0;
+	bool monotonic = true;
+	while (!done) {
+		double v = in.get();
+		monotonic = monotonic && v >= prev;
+		prev = v;
+	}
+	writer.join();
+	EXPECT_TRUE(monotonic);
+	EXPECT_DOUBLE_EQ(in.get(), 200000.0);
+}
+
+TEST(halSimChannelTest, generatorFeature){
+	SimAnalogIn in("simFeatureIn", dlopen(nullptr, RTLD_NOW), 1, 0, -10, 10, "V", "");
+	EXPECT_DOUBLE_EQ(in.get(), 0.0);
+	HAL::instance().callInputFeature(&in, "simSetValue", 3.0);
+	EXPECT_DOUBLE_EQ(in.get(), 3.0);
+	auto setGenerator = HAL::instance().feature<void(std::string)>(&in, "simSetGenerator");
+	setGenerator("constant value=-1");
+	EXPECT_DOUBLE_EQ(in.get(), -1.0);
+}
+
+TEST(halSimChannelTest, scaleAndRange){
+	SimAnalogOut out("simScaleOut", nullptr, 2, 1, -5, 5, "V");
+	SimAnalogIn raw("simScaleRaw", nullptr, 1, 0, -100, 100, "V", "loopback source=simScaleOut");
+	SimAnalogIn in("simScaleIn", nullptr, 2, 1, -5, 5, "V", "loopback source=simScaleOut");
+	out.set(3.0);
+	EXPECT_DOUBLE_EQ(out.get(), 3.0);
+	EXPECT_DOUBLE_EQ(raw.get(), 7.0);
+	EXPECT_DOUBLE_EQ(in.get(), 3.0);
+	out.set(8.0);
+	EXPECT_DOUBLE_EQ(out.get(), 5.0);
+	EXPECT_DOUBLE_EQ(raw.get(), 11.0);
+	out.set(-8.0);
+	EXPECT_DOUBLE_EQ(out.get(), -5.0);
+	EXPECT_DOUBLE_EQ(in.get(), -5.0);
+	SimAnalogIn limited("simScaleLimited", nullptr, 0.5, 0, -1, 1, "V", "constant value=2");
+	EXPECT_DOUBLE_EQ(limited.get(), 1.0);
+}
+
+TEST(halSimChannelTest, missingSourceIsFault){
+	SimAnalogIn in("simFaultIn", nullptr, 1, 0, -10, 10, "V", "loopback source=simFaultOut");
+	EXPECT_NO_THROW(in.get());
+	EXPECT_DOUBLE_EQ(in.get(), 0.0);
+	EXPECT_TRUE(in.hasFault());
+	SimAnalogOut out("simFaultOut", nullptr, 1, 0, -10, 10, "V");
+	out.set(2.0);
+	EXPECT_DOUBLE_EQ(in.get(), 2.0);
+	EXPECT_FALSE(in.hasFault());
+}
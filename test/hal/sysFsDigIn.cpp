@@ -0,0 +1,147 @@
+#include <eeros/hal/SysFsDigIn.hpp>
+#include <eeros/core/Fault.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace eeros;
+using namespace eeros::hal;
+
+// Regular files stand in for the sysfs gpio files
+static std::string createGpioDir() {
+	char dir[] = "/tmp/eerosGpioXXXXXX";
+	if(mkdtemp(dir) == nullptr) return "";
+	return std::string(dir) + "/";
+}
+
+static void writeValue(std::string path, std::string value) {
+	std::ofstream file(path + "value", std::ios::trunc);
+	file << value;
+}
+
+static void removeGpioDir(std::string path) {
+	unlink((path + "value").c_str());
+	unlink((path + "edge").c_str());
+	rmdir(path.c_str());
+}
+
+TEST(halSysFsDigInTest, readValue){
+	std::string path = createGpioDir();
+	writeValue(path, "0\n");
+	{
+		SysFsDigIn in("gpioTestIn", nullptr, path);
+		EXPECT_FALSE(in.get());
+		writeValue(path, "1\n");
+		EXPECT_TRUE(in.get());
+		EXPECT_TRUE(in.get());
+		writeValue(path, "0\n");
+		EXPECT_FALSE(in.get());
+	}
+	removeGpioDir(path);
+}
+
+TEST(halSysFsDigInTest, readInvertedValue){
+	std::string path = createGpioDir();
+	writeValue(path, "1\n");
+	{
+		SysFsDigIn in("gpioTestIn", nullptr, path, true);
+		EXPECT_FALSE(in.get());
+		writeValue(path, "0\n");
+		EXPECT_TRUE(in.get());
+	}
+	removeGpioDir(path);
+}
+
+TEST(halSysFsDigInTest, configureEdge){
+	std::string path = createGpioDir();
+	writeValue(path, "0\n");
+	{
+		SysFsDigIn in("gpioTestIn", nullptr, path, false, SysFsEdge::rising);
+		std::ifstream edgeFile(path + "edge");
+		std::string edge;
+		edgeFile >> edge;
+		EXPECT_EQ(edge, "rising");
+		EXPECT_FALSE(in.fetchEdge());
+		EXPECT_EQ(in.getEdgeCount(), 0u);
+		EXPECT_FALSE(in.get());
+	}
+	removeGpioDir(path);
+}
+
+TEST(halSysFsDigInTest, missingValueFile){
+	try{
+		SysFsDigIn in("gpioTestIn", nullptr, std::string("/tmp/eerosGpioMissing"));
+		FAIL();
+	}
+	catch(eeros::Fault const & err){
+		EXPECT_EQ(err.what(), std::string("Failed to open value file /tmp/eerosGpioMissing/value!"));
+	}
+}
+
+TEST(halSysFsDigInTest, latchRisingEdge){
+	std::string path = createGpioDir();
+	writeValue(path, "0\n");
+	{
+		SysFsDigIn in("gpioTestIn", nullptr, path, true, SysFsEdge::rising);
+		EXPECT_TRUE(in.get());
+		writeValue(path, "1\n");
+		EXPECT_FALSE(in.get());
+		EXPECT_TRUE(in.fetchEdge());
+		EXPECT_FALSE(in.fetchEdge());
+		EXPECT_EQ(in.getEdgeCount(), 1u);
+		EXPECT_FALSE(in.get());
+		EXPECT_FALSE(in.fetchEdge());
+		writeValue(path, "0\n");
+		EXPECT_TRUE(in.get());
+		EXPECT_FALSE(in.fetchEdge());
+		EXPECT_EQ(in.getEdgeCount(), 1u);
+	}
+	removeGpioDir(path);
+}
+
+TEST(halSysFsDigInTest, latchFallingAndBothEdges){
+	std::string path = createGpioDir();
+	writeValue(path, "1\n");
+	{
+		SysFsDigIn falling("gpioTestIn", nullptr, path, false, SysFsEdge::falling);
+		SysFsDigIn both("gpioTestIn", nullptr, path, false, SysFsEdge::both);
+		writeValue(path, "0\n");
+		EXPECT_FALSE(falling.get());
+		EXPECT_FALSE(both.get());
+		EXPECT_TRUE(falling.fetchEdge());
+		EXPECT_TRUE(both.fetchEdge());
+		writeValue(path, "1\n");
+		EXPECT_TRUE(falling.get());
+		EXPECT_TRUE(both.get());
+		EXPECT_FALSE(falling.fetchEdge());
+		EXPECT_TRUE(both.fetchEdge());
+		EXPECT_FALSE(both.fetchEdge());
+		EXPECT_EQ(falling.getEdgeCount(), 1u);
+		EXPECT_EQ(both.getEdgeCount(), 2u);
+	}
+	removeGpioDir(path);
+}
+
+static int openFds() {
+	int n = 0;
+	DIR* d = opendir("/proc/self/fd");
+	while(readdir(d) != nullptr) n++;
+	closedir(d);
+	return n;
+}
+
+TEST(halSysFsDigInTest, noLeakOnFailure){
+	std::string path = createGpioDir();
+	writeValue(path, "0\n");
+	// a directory in place of the edge file makes configuring the edge fail
+	mkdir((path + "edge").c_str(), 0700);
+	int fds = openFds();
+	EXPECT_THROW(SysFsDigIn in("gpioTestIn", nullptr, path, false, SysFsEdge::rising), Fault);
+	EXPECT_EQ(openFds(), fds);
+	rmdir((path + "edge").c_str());
+	removeGpioDir(path);
+}
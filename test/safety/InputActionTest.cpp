@@ -0,0 +1,172 @@
+#include <eeros/safety/SafetySystem.hpp>
+#include <eeros/safety/InputAction.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::safety;
+
+template < typename T >
+class TestInput : public hal::Input<T> {
+ public:
+  TestInput(std::string id, T value) : hal::Input<T>(id, nullptr), value(value), reads(0) { }
+  virtual T get() { reads++; return value; }
+  T value;
+  int reads;
+};
+
+class CountingAction : public InputAction {
+ public:
+  CountingAction(hal::InputInterface& input, SafetyEvent& event) : InputAction(input), event(event), checks(0) { }
+  virtual bool check(SafetyContext* context) {
+    if (++checks == 3) {
+      context->triggerEvent(event);
+      return true;
+    }
+    return false;
+  }
+  SafetyEvent& event;
+  int checks;
+};
+
+// counts the checks of a value check and never triggers its event
+class QuietCheck : public CheckInputAction<bool> {
+ public:
+  QuietCheck(hal::Input<bool>& input, SafetyEvent& event) : CheckInputAction<bool>(input, true, event), checks(0) { }
+  virtual bool check(SafetyContext* context) {
+    checks++;
+    return false;
+  }
+  int checks;
+};
+
+class InputActionProperties : public SafetyProperties {
+ public:
+  InputActionProperties() : e1("e1"), e2("e2"), sl1("1"), sl2("2"), sl3("3") {
+    addLevel(sl1);
+    addLevel(sl2);
+    addLevel(sl3);
+    sl1.addEvent(e1, sl2, kPublicEvent);
+    sl1.addEvent(e2, sl3, kPublicEvent);
+    sl2.addEvent(e2, sl3, kPublicEvent);
+    setEntryLevel(sl1);
+  }
+  SafetyEvent e1, e2;
+  SafetyLevel sl1, sl2, sl3;
+};
+
+class safetyInputActionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::cout.setstate(std::ios_base::badbit);
+    logger::Logger::setDefaultStreamLogger(std::cout);
+  }
+};
+
+// Test checking a digital input for a value
+TEST_F(safetyInputActionTest, check) {
+  InputActionProperties sp;
+  TestInput<bool> in("in", true);
+  std::unique_ptr<InputAction> a(check(in, true, sp.e1));
+  sp.sl1.setInputAction(a.get());
+  SafetySystem ss(sp, 1);
+  ss.run();
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+  EXPECT_EQ(in.reads, 2);
+  in.value = false;
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl2);
+}
+
+// Test checking an analog input for a range
+TEST_F(safetyInputActionTest, range) {
+  InputActionProperties sp;
+  TestInput<double> in("in", 0.5);
+  std::unique_ptr<InputAction> a(range(in, 0.0, 1.0, sp.e1));
+  sp.sl1.setInputAction(a.get());
+  SafetySystem ss(sp, 1);
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+  in.value = 1.0;
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+  in.value = 1.5;
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl2);
+}
+
+// Test checking an analog input for leaving a range
+TEST_F(safetyInputActionTest, offRange) {
+  InputActionProperties sp;
+  TestInput<int> in("in", 5);
+  std::unique_ptr<InputAction> a(range(&in, 0, 10, sp.e1, true));
+  sp.sl1.setInputAction(a.get());
+  SafetySystem ss(sp, 1);
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl2);
+}
+
+// Test that ignored inputs are never read
+TEST_F(safetyInputActionTest, ignore) {
+  InputActionProperties sp;
+  TestInput<bool> in("in", false);
+  std::unique_ptr<InputAction> a(ignore(in));
+  sp.sl1.setInputAction(a.get());
+  SafetySystem ss(sp, 1);
+  for (int i = 0; i < 5; i++) ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+  EXPECT_EQ(in.reads, 0);
+  EXPECT_EQ(a->getInput(), &in);
+}
+
+// Test that actions without a compiled form are still checked
+TEST_F(safetyInputActionTest, custom) {
+  InputActionProperties sp;
+  TestInput<bool> in("in", false);
+  CountingAction a(in, sp.e1);
+  sp.sl1.setInputActions({&a});
+  SafetySystem ss(sp, 1);
+  ss.run();
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl2);
+  EXPECT_EQ(a.checks, 3);
+}
+
+// Test many inputs in one level, all are evaluated in order
+TEST_F(safetyInputActionTest, many) {
+  InputActionProperties sp;
+  std::vector<std::unique_ptr<TestInput<int>>> in;
+  std::vector<std::unique_ptr<InputAction>> a;
+  std::vector<InputAction*> actions;
+  for (int i = 0; i < 100; i++) {
+    in.emplace_back(new TestInput<int>("in" + std::to_string(i), i));
+    a.emplace_back(check(*in.back(), i, sp.e1));
+    actions.push_back(a.back().get());
+  }
+  sp.sl1.setInputActions(actions);
+  sp.sl2.setInputActions(actions);
+  SafetySystem ss(sp, 1);
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+  for (auto& i : in) EXPECT_EQ(i->reads, 1);
+  in[50]->value = -1;
+  ss.run();
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl2);
+  for (auto& i : in) EXPECT_EQ(i->reads, 2);
+}
+
+// Test that an overridden check() of a derived action is called instead of the compiled check
+TEST_F(safetyInputActionTest, overriddenCheck) {
+  InputActionProperties sp;
+  TestInput<bool> in("in", false);
+  QuietCheck a(in, sp.e1);
+  sp.sl1.setInputActions({&a});
+  SafetySystem ss(sp, 1);
+  for (int i = 0; i < 3; i++) ss.run();
+  EXPECT_EQ(a.checks, 3);
+  EXPECT_EQ(in.reads, 0);
+  EXPECT_TRUE(ss.getCurrentLevel() == sp.sl1);
+}
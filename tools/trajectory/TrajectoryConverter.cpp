@@ -0,0 +1,25 @@
+#include <eeros/control/TrajectoryFile.hpp>
+#include <eeros/core/Fault.hpp>
+#include <iostream>
+
+using namespace eeros;
+using namespace eeros::control;
+
+/*
+ * Converts a trajectory for PathPlannerCubic from text to binary format.
+ */
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <text file> <binary file>" << std::endl;
+    return 1;
+  }
+  try {
+    std::size_t n = TrajectoryFile::convert(argv[1], argv[2]);
+    TrajectoryFile check(argv[2]);
+    std::cout << "Converted " << n << " segments, duration " << (n > 0 ? check[n - 1].end : 0) << " s" << std::endl;
+  } catch (Fault const& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}